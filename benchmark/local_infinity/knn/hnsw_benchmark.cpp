@@ -19,6 +19,7 @@ import stl;
 import third_party;
 import hnsw_alg;
 import vec_store_type;
+import lvq_vec_store;
 import compilation_config;
 import virtual_store;
 import status;
@@ -60,6 +61,7 @@ String BenchmarkTypeToString(BenchmarkType benchmark_type) {
 enum class BuildType : i8 {
     PLAIN,
     LVQ,
+    LVQ4,
     CompressToLVQ,
     LSGBuild,
     LSGCompressToLVQ,
@@ -71,6 +73,8 @@ String BuildTypeToString(BuildType build_type) {
             return "plain";
         case BuildType::LVQ:
             return "lvq";
+        case BuildType::LVQ4:
+            return "lvq4";
         case BuildType::CompressToLVQ:
             return "clvq";
         case BuildType::LSGBuild:
@@ -94,6 +98,7 @@ public:
         Map<String, BuildType> build_type_map = {
             {"plain", BuildType::PLAIN},
             {"lvq", BuildType::LVQ},
+            {"lvq4", BuildType::LVQ4},
             {"clvq", BuildType::CompressToLVQ},
             {"lsg", BuildType::LSGBuild},
             {"clvq_lsg", BuildType::LSGCompressToLVQ},
@@ -176,6 +181,7 @@ using LabelT = u32;
 using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
 using HnswLSG = KnnHnsw<PlainL2VecStoreType<float, true>, LabelT>;
 using HnswLVQ = KnnHnsw<LVQL2VecStoreType<float, i8>, LabelT>;
+using HnswLVQ4 = KnnHnsw<LVQL2VecStoreType<float, LVQ4>, LabelT>;
 
 // SharedPtr<String> index_name = MakeShared<String>("index_name");
 // String filename = "filename";
@@ -435,6 +441,10 @@ int main(int argc, char *argv[]) {
                     Build<HnswLVQ, HnswLVQ>(option);
                     break;
                 }
+                case BuildType::LVQ4: {
+                    Build<HnswLVQ4, HnswLVQ4>(option);
+                    break;
+                }
                 case BuildType::CompressToLVQ: {
                     Build<Hnsw, HnswLVQ>(option);
                     break;
@@ -462,6 +472,10 @@ int main(int argc, char *argv[]) {
                     Query<HnswLVQ>(option);
                     break;
                 }
+                case BuildType::LVQ4: {
+                    Query<HnswLVQ4>(option);
+                    break;
+                }
                 case BuildType::LSGBuild: {
                     Query<HnswLSG>(option);
                     break;
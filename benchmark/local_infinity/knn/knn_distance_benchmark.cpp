@@ -0,0 +1,194 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iostream>
+#include <random>
+
+import stl;
+import third_party;
+import profiler;
+import simd_init;
+import hnsw_simd_func;
+
+using namespace infinity;
+
+// Compare the int8 / uint8 / 4-bit HNSW distance kernels of every instruction set the host supports.
+// Each kernel computes the distance between a query and all vectors of a base set which doesn't fit in L2 cache,
+// that is the access pattern of the HNSW search.
+
+namespace {
+
+constexpr SizeT kBaseNum = 1 << 15;
+constexpr SizeT kRound = 20;
+
+template <typename T>
+UniquePtr<T[]> RandomCodes(SizeT n, std::mt19937 &gen) {
+    auto ret = MakeUniqueForOverwrite<T[]>(n);
+    std::uniform_int_distribution<i32> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    for (SizeT i = 0; i < n; ++i) {
+        ret[i] = dist(gen);
+    }
+    return ret;
+}
+
+template <typename T>
+void Bench(const String &name, i32 (*func)(const T *, const T *, SizeT), const T *query, const T *base, SizeT dim, SizeT code_size) {
+    i64 checksum = 0;
+    BaseProfiler profiler;
+    profiler.Begin();
+    for (SizeT round = 0; round < kRound; ++round) {
+        for (SizeT i = 0; i < kBaseNum; ++i) {
+            checksum += func(query, base + i * code_size, dim);
+        }
+    }
+    profiler.End();
+    f64 ns_per_dist = static_cast<f64>(profiler.Elapsed()) / (kRound * kBaseNum);
+    std::cout << fmt::format("{:<24} dim: {:<5} {:>8.2f} ns/dist, {:>6.2f} GB/s, checksum: {}",
+                             name,
+                             dim,
+                             ns_per_dist,
+                             code_size * sizeof(T) / ns_per_dist,
+                             checksum)
+              << std::endl;
+}
+
+void BenchDim(SizeT dim) {
+    std::mt19937 gen(dim);
+    auto i8_query = RandomCodes<i8>(dim, gen);
+    auto i8_base = RandomCodes<i8>(dim * kBaseNum, gen);
+    auto u8_query = RandomCodes<u8>(dim, gen);
+    auto u8_base = RandomCodes<u8>(dim * kBaseNum, gen);
+    const SizeT u4_size = (dim + 1) / 2;
+    auto u4_query = RandomCodes<u8>(u4_size, gen);
+    auto u4_base = RandomCodes<u8>(u4_size * kBaseNum, gen);
+
+    // i8 inner product, the distance of 8-bit LVQ
+    Bench<i8>("I8IPBF", &I8IPBF, i8_query.get(), i8_base.get(), dim, dim);
+#if defined(__SSE2__)
+    Bench<i8>("I8IPSSE", &I8IPSSEResidual, i8_query.get(), i8_base.get(), dim, dim);
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        Bench<i8>("I8IPAVX", &I8IPAVXResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        Bench<i8>("I8IPAVXVNNI", &I8IPAVXVNNIResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        Bench<i8>("I8IPAVX512", &I8IPAVX512Residual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        Bench<i8>("I8IPAVX512VNNI", &I8IPAVX512VNNIResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+
+    // i8 l2
+    Bench<i8>("I8L2BF", &I8L2BF, i8_query.get(), i8_base.get(), dim, dim);
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        Bench<i8>("I8L2AVX2", &I8L2AVX2Residual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        Bench<i8>("I8L2AVXVNNI", &I8L2AVXVNNIResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        Bench<i8>("I8L2AVX512BW", &I8L2AVX512BWResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        Bench<i8>("I8L2AVX512VNNI", &I8L2AVX512VNNIResidual, i8_query.get(), i8_base.get(), dim, dim);
+    }
+#endif
+
+    // u8 l2
+    Bench<u8>("U8L2BF", &U8L2BF, u8_query.get(), u8_base.get(), dim, dim);
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        Bench<u8>("U8L2AVX2", &U8L2AVX2Residual, u8_query.get(), u8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        Bench<u8>("U8L2AVXVNNI", &U8L2AVXVNNIResidual, u8_query.get(), u8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        Bench<u8>("U8L2AVX512BW", &U8L2AVX512BWResidual, u8_query.get(), u8_base.get(), dim, dim);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        Bench<u8>("U8L2AVX512VNNI", &U8L2AVX512VNNIResidual, u8_query.get(), u8_base.get(), dim, dim);
+    }
+#endif
+
+    // 4-bit inner product, the distance of 4-bit LVQ
+    Bench<u8>("U4IPBF", &U4IPBF, u4_query.get(), u4_base.get(), dim, u4_size);
+#if defined(__SSE2__)
+    Bench<u8>("U4IPSSE2", &U4IPSSE2, u4_query.get(), u4_base.get(), dim, u4_size);
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        Bench<u8>("U4IPAVX2", &U4IPAVX2, u4_query.get(), u4_base.get(), dim, u4_size);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        Bench<u8>("U4IPAVXVNNI", &U4IPAVXVNNI, u4_query.get(), u4_base.get(), dim, u4_size);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        Bench<u8>("U4IPAVX512BW", &U4IPAVX512BW, u4_query.get(), u4_base.get(), dim, u4_size);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        Bench<u8>("U4IPAVX512VNNI", &U4IPAVX512VNNI, u4_query.get(), u4_base.get(), dim, u4_size);
+    }
+#endif
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::cout << "Supported simd types: ";
+    for (const char *simd_type : GetSupportedSimdTypesList()) {
+        std::cout << simd_type << " ";
+    }
+    std::cout << std::endl;
+    Vector<SizeT> dims = {128, 200, 768, 960};
+    if (argc > 1) {
+        dims.clear();
+        for (int i = 1; i < argc; ++i) {
+            dims.push_back(std::stoul(argv[i]));
+        }
+    }
+    for (SizeT dim : dims) {
+        BenchDim(dim);
+    }
+    return 0;
+}
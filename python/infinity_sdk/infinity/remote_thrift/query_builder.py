@@ -319,6 +319,9 @@ class InfinityThriftQueryBuilder(ABC):
             fusion_expr.optional_match_tensor_expr = make_match_tensor_expr(
                 vector_column_name=fusion_params["field"], embedding_data=fusion_params["query_tensor"],
                 embedding_data_type=fusion_params["element_type"], method_type="maxsim", extra_option=None)
+            for k, v in fusion_params.items():
+                if k in ["rerank_keep_ratio", "rerank_threads"]:
+                    final_option_text += f";{k}={v}"
         else:
             raise InfinityException(ErrorCode.INVALID_EXPRESSION, "Invalid fusion method")
         fusion_expr.options_text = final_option_text
@@ -1,3 +1,4 @@
+import os
 import time
 
 from numpy import dtype
@@ -78,3 +79,87 @@ class TestIndex:
 
             print("uninit cluster")
             db_obj1.drop_table(table_name)
+
+    def test_replicate_index(self, cluster: InfinityCluster):
+        with cluster:
+            cluster.add_node("node1", "conf/leader.toml")
+            cluster.add_node("node2", "conf/follower_replicate_index.toml")
+            # the log of node2 is flushed when it is removed, only the part written by this run is checked
+            follower_log = "/var/infinity/follower/log/infinity.log"
+            follower_log_offset = os.path.getsize(follower_log) if os.path.exists(follower_log) else 0
+
+            print("init nodes")
+            cluster.set_leader("node1")
+            cluster.set_follower("node2")
+            time.sleep(1)
+
+            table_name = "test_index2"
+
+            print("create indexes in node1")
+            infinity1 = cluster.client("node1")
+            db_obj1 = infinity1.get_database("default_db")
+            db_obj1.drop_table(table_name, ConflictType.Ignore)
+
+            table_obj1 = db_obj1.create_table(
+                table_name, {"c1": {"type": "int"}, "c2": {"type": "vector,4,float"}}
+            )
+            table_obj1.create_index(
+                "idx1", index.IndexInfo("c1", index.IndexType.Secondary)
+            )
+            table_obj1.create_index(
+                "idx2",
+                index.IndexInfo(
+                    "c2",
+                    index.IndexType.Hnsw,
+                    {"M": "16", "ef_construction": "50", "metric": "l2"},
+                ),
+            )
+
+            print("insert in node1")
+            # the rows stay in the memory index of leader, node2 has no hnsw chunk and no hnsw memory index for them
+            table_obj1.insert(
+                [
+                    {"c1": 1, "c2": [1.0, 1.0, 1.0, 1.0]},
+                    {"c1": 2, "c2": [2.0, 2.0, 2.0, 2.0]},
+                    {"c1": 3, "c2": [3.0, 3.0, 3.0, 3.0]},
+                ]
+            )
+            res_gt = pd.DataFrame(
+                {
+                    "c1": (1, 2),
+                }
+            ).astype({"c1": dtype("int32")})
+            res1, extra_result = table_obj1.output(["c1"]).filter("c1 < 3").to_df()
+            pd.testing.assert_frame_equal(res1, res_gt)
+
+            print("select with the indexes in node2")
+            time.sleep(1)
+            infinity2 = cluster.client("node2")
+            db_obj2 = infinity2.get_database("default_db")
+            table_obj2 = db_obj2.get_table(table_name)
+            res2, extra_result = table_obj2.output(["c1"]).filter("c1 < 3").to_df()
+            pd.testing.assert_frame_equal(res2, res_gt)
+
+            res1, extra_result = (
+                table_obj1.output(["c1"])
+                .match_dense("c2", [3.0] * 4, "float", "l2", 2)
+                .to_df()
+            )
+            res2, extra_result = (
+                table_obj2.output(["c1"])
+                .match_dense("c2", [3.0] * 4, "float", "l2", 2)
+                .to_df()
+            )
+            assert list(res2["c1"]) == [3, 2]
+            pd.testing.assert_frame_equal(res1, res2)
+
+            print("check no hnsw insert in node2")
+            cluster.remove_node("node2")
+            with open(follower_log, "r", errors="ignore") as f:
+                f.seek(follower_log_offset)
+                follower_log_content = f.read()
+            assert f"Table default_db.{table_name} index idx1 segment 0 MemIndexInsert." in follower_log_content
+            assert f"Table default_db.{table_name} index idx2 segment 0 MemIndexInsert." not in follower_log_content
+
+            print("uninit cluster")
+            db_obj1.drop_table(table_name)
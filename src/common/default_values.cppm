@@ -183,6 +183,9 @@ export {
     constexpr u32 DEFAULT_MATCH_TEXT_OPTION_TOP_N = 10;
     constexpr u32 DEFAULT_MATCH_TENSOR_OPTION_TOP_N = 10;
     constexpr u32 DEFAULT_FUSION_OPTION_TOP_N = 100;
+    constexpr f32 DEFAULT_MATCH_TENSOR_RERANK_KEEP_RATIO = 1.0f; // 1.0: no binary first stage
+    constexpr u32 DEFAULT_MATCH_TENSOR_RERANK_THREAD_NUM = 1;
+    constexpr SizeT MATCH_TENSOR_RERANK_MIN_DOCS_PER_THREAD = 64;
 
     constexpr SizeT DEFAULT_BUFFER_MANAGER_SIZE = 8 * 1024lu * 1024lu * 1024lu; // 8Gib
     constexpr SizeT DEFAULT_BUFFER_MANAGER_LRU_COUNT = 7;
@@ -190,6 +193,7 @@ export {
 
     constexpr SizeT DEFAULT_MEMINDEX_MEMORY_QUOTA = 4 * 1024lu * 1024lu * 1024lu; // 4GB
     constexpr std::string_view DEFAULT_MEMINDEX_MEMORY_QUOTA_STR = "4GB";         // 4GB
+    constexpr SizeT DEFAULT_MEMINDEX_DUMP_WORKER = 2;
 
     constexpr SizeT DEFAULT_LOG_FILE_SIZE = 64 * 1024lu * 1024lu;  // 64MB
     constexpr std::string_view DEFAULT_LOG_FILE_SIZE_STR = "64MB"; // 64MB
@@ -211,6 +215,12 @@ export {
     constexpr std::string_view DEFAULT_OBJECT_STORAGE_DISK_CACHE_DIR = "/var/infinity/localdiskcache";
     constexpr std::string_view DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT_STR = "128GB";         // 128GB
     constexpr SizeT DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT = 128 * 1024lu * 1024lu * 1024lu; // 128GB
+    constexpr std::string_view DEFAULT_OBJECT_STORAGE_DISK_CACHE_PIN_POLICY = "index";       // none, index or data
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_TRANSFER_WORKER_NUM = 8;
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE = 16 * 1024lu * 1024lu; // 16MB, S3 requires 5MB at least for a multipart part
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_PREFETCH_WORKER_NUM = 4;
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_PREFETCH_QUEUE_SIZE = 1024;
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_PREFETCH_HISTORY_SIZE = 64 * 1024;
 
     // network
     constexpr SizeT DEFAULT_HTTP_PORT = 23820;
@@ -223,6 +233,8 @@ export {
     constexpr SizeT DEFAULT_PEER_CONNECT_TIMEOUT = 2000; // 2 seconds
     constexpr SizeT DEFAULT_PEER_RECV_TIMEOUT = 0;       // not set
     constexpr SizeT DEFAULT_PEER_SEND_TIMEOUT = 0;       // not set
+    constexpr SizeT DEFAULT_PEER_LOG_SYNC_WINDOW = 16;   // log batches sent to a node and not acked yet
+    constexpr bool DEFAULT_PEER_REPLICATE_INDEX = false;
 
     // config name
     constexpr std::string_view VERSION_OPTION_NAME = "version";
@@ -239,6 +251,7 @@ export {
     constexpr std::string_view PEER_CONNECT_TIMEOUT_OPTION_NAME = "peer_connect_timeout";
     constexpr std::string_view PEER_RECV_TIMEOUT_OPTION_NAME = "peer_recv_timeout";
     constexpr std::string_view PEER_SEND_TIMEOUT_OPTION_NAME = "peer_send_timeout";
+    constexpr std::string_view PEER_REPLICATE_INDEX_OPTION_NAME = "peer_replicate_index";
 
     constexpr std::string_view POSTGRES_PORT_OPTION_NAME = "postgres_port";
     constexpr std::string_view HTTP_PORT_OPTION_NAME = "http_port";
@@ -274,17 +287,23 @@ export {
     constexpr std::string_view OBJECT_STORAGE_DISK_CACHE_DIR_OPTION_NAME = "disk_cache_dir";
     constexpr std::string_view OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME = "disk_cache_limit";
     constexpr std::string_view OBJECT_STORAGE_DISK_CACHE_LRU_COUNT_OPTION_NAME = "disk_cache_lru_count";
+    constexpr std::string_view OBJECT_STORAGE_DISK_CACHE_PIN_POLICY_OPTION_NAME = "disk_cache_pin_policy";
 
     constexpr std::string_view BUFFER_MANAGER_SIZE_OPTION_NAME = "buffer_manager_size";
     constexpr std::string_view LRU_NUM_OPTION_NAME = "lru_num";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
     constexpr std::string_view MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "memindex_memory_quota";
+    constexpr std::string_view DENSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "dense_memindex_memory_quota";
+    constexpr std::string_view SPARSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "sparse_memindex_memory_quota";
+    constexpr std::string_view FULLTEXT_MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "fulltext_memindex_memory_quota";
+    constexpr std::string_view TABLE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "table_memindex_memory_quota";
     constexpr std::string_view RESULT_CACHE_OPTION_NAME = "result_cache";
     constexpr std::string_view CACHE_RESULT_CAPACITY_OPTION_NAME = "cache_result_capacity";
     constexpr std::string_view DENSE_INDEX_BUILDING_WORKER_OPTION_NAME = "dense_index_building_worker";
     constexpr std::string_view SPARSE_INDEX_BUILDING_WORKER_OPTION_NAME = "sparse_index_building_worker";
     constexpr std::string_view FULLTEXT_INDEX_BUILDING_WORKER_OPTION_NAME = "fulltext_index_building_worker";
     constexpr std::string_view BOTTOM_EXECUTOR_WORKER_OPTION_NAME = "bottom_executor_worker";
+    constexpr std::string_view MEMINDEX_DUMP_WORKER_OPTION_NAME = "memindex_dump_worker";
 
     constexpr std::string_view WAL_DIR_OPTION_NAME = "wal_dir";
     constexpr std::string_view WAL_COMPACT_THRESHOLD_OPTION_NAME = "wal_compact_threshold";
@@ -347,6 +347,57 @@ export int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim)
 
 #endif
 
+// vpdpbusd multiplies u8 by i8, so pv1 is biased to u8 by xor with 0x80, and 128 * sum(pv2) is subtracted at last
+#if defined(__AVX512VNNI__)
+
+export int32_t I8IPAVX512VNNI(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    const int8_t *pend1 = pv1 + (dim & ~63);
+    const __m512i highest_bit = _mm512_set1_epi8(0x80);
+    const __m512i ones = _mm512_set1_epi8(1);
+    __m512i sum = _mm512_setzero_si512();
+    __m512i sum2 = _mm512_setzero_si512();
+    while (pv1 < pend1) {
+        __m512i v1 = _mm512_xor_si512(_mm512_loadu_si512((__m512i_u *)pv1), highest_bit);
+        __m512i v2 = _mm512_loadu_si512((__m512i_u *)pv2);
+        sum = _mm512_dpbusd_epi32(sum, v1, v2);
+        sum2 = _mm512_dpbusd_epi32(sum2, ones, v2);
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return _mm512_reduce_add_epi32(sum) - 128 * _mm512_reduce_add_epi32(sum2);
+}
+
+export int32_t I8IPAVX512VNNIResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    return I8IPAVX512VNNI(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+
+#endif
+
+#if defined(__AVXVNNI__)
+
+export int32_t I8IPAVXVNNI(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    const int8_t *pend1 = pv1 + (dim & ~31);
+    const __m256i highest_bit = _mm256_set1_epi8(0x80);
+    const __m256i ones = _mm256_set1_epi8(1);
+    __m256i sum = _mm256_setzero_si256();
+    __m256i sum2 = _mm256_setzero_si256();
+    while (pv1 < pend1) {
+        __m256i v1 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)pv1), highest_bit);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        sum = _mm256_dpbusd_avx_epi32(sum, v1, v2);
+        sum2 = _mm256_dpbusd_avx_epi32(sum2, ones, v2);
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum) - 128 * hsum_8x32_avx2(sum2);
+}
+
+export int32_t I8IPAVXVNNIResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    return I8IPAVXVNNI(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
+}
+
+#endif
+
 //------------------------------//------------------------------//------------------------------
 
 export int32_t I8L2BF(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
@@ -385,6 +436,56 @@ export int32_t I8L2AVX512BWResidual(const int8_t *pv1, const int8_t *pv2, SizeT
 }
 #endif
 
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+export int32_t I8L2AVX512VNNI(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    const int8_t *pEnd1 = pv1 + (dim & ~(63u));
+    const __m512i fix_high_bit = _mm512_set1_epi8(-128); // turn i8 to u8 by adding 128 (equivalent to xor with -128)
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pEnd1) {
+        __m512i v1 = _mm512_xor_si512(_mm512_loadu_si512((__m512i *)pv1), fix_high_bit);
+        __m512i v2 = _mm512_xor_si512(_mm512_loadu_si512((__m512i *)pv2), fix_high_bit);
+        __m512i diff_abs = abs_sub_epu8_avx512(v1, v2);
+        // vpdpwssd fuses the square and the accumulation of diff_abs
+        __m512i diff_abs_lo = _mm512_unpacklo_epi8(diff_abs, _mm512_setzero_si512());
+        __m512i diff_abs_hi = _mm512_unpackhi_epi8(diff_abs, _mm512_setzero_si512());
+        sum = _mm512_dpwssd_epi32(sum, diff_abs_lo, diff_abs_lo);
+        sum = _mm512_dpwssd_epi32(sum, diff_abs_hi, diff_abs_hi);
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return hsum_epi32_avx512(sum);
+}
+
+export int32_t I8L2AVX512VNNIResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    return I8L2AVX512VNNI(pv1, pv2, dim) + I8L2BF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+#endif
+
+#if defined(__AVXVNNI__)
+export int32_t I8L2AVXVNNI(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    const int8_t *pEnd1 = pv1 + (dim & ~(31u));
+    const __m256i fix_high_bit = _mm256_set1_epi8(-128); // turn i8 to u8 by adding 128 (equivalent to xor with -128)
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)pv1), fix_high_bit);
+        __m256i v2 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)pv2), fix_high_bit);
+        __m256i diff_abs = abs_sub_epu8_avx2(v1, v2);
+        // vpdpwssd fuses the square and the accumulation of diff_abs
+        __m256i diff_abs_lo = _mm256_unpacklo_epi8(diff_abs, _mm256_setzero_si256());
+        __m256i diff_abs_hi = _mm256_unpackhi_epi8(diff_abs, _mm256_setzero_si256());
+        sum = _mm256_dpwssd_avx_epi32(sum, diff_abs_lo, diff_abs_lo);
+        sum = _mm256_dpwssd_avx_epi32(sum, diff_abs_hi, diff_abs_hi);
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum);
+}
+
+export int32_t I8L2AVXVNNIResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    return I8L2AVXVNNI(pv1, pv2, dim) + I8L2BF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
+}
+#endif
+
 #if defined(__AVX2__)
 export int32_t I8L2AVX2(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
     const int8_t *pEnd1 = pv1 + (dim & ~(31u));
@@ -897,6 +998,54 @@ export int32_t U8L2AVX512BWResidual(const uint8_t *pv1, const uint8_t *pv2, Size
 }
 #endif
 
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+export int32_t U8L2AVX512VNNI(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const uint8_t *pEnd1 = pv1 + (dim & ~(63u));
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pEnd1) {
+        __m512i v1 = _mm512_loadu_si512((__m512i *)pv1);
+        __m512i v2 = _mm512_loadu_si512((__m512i *)pv2);
+        __m512i diff_abs = abs_sub_epu8_avx512(v1, v2);
+        // vpdpwssd fuses the square and the accumulation of diff_abs
+        __m512i diff_abs_lo = _mm512_unpacklo_epi8(diff_abs, _mm512_setzero_si512());
+        __m512i diff_abs_hi = _mm512_unpackhi_epi8(diff_abs, _mm512_setzero_si512());
+        sum = _mm512_dpwssd_epi32(sum, diff_abs_lo, diff_abs_lo);
+        sum = _mm512_dpwssd_epi32(sum, diff_abs_hi, diff_abs_hi);
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return hsum_epi32_avx512(sum);
+}
+
+export int32_t U8L2AVX512VNNIResidual(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    return U8L2AVX512VNNI(pv1, pv2, dim) + U8L2BF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+#endif
+
+#if defined(__AVXVNNI__)
+export int32_t U8L2AVXVNNI(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const uint8_t *pEnd1 = pv1 + (dim & ~(31u));
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i *)pv1);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        __m256i diff_abs = abs_sub_epu8_avx2(v1, v2);
+        // vpdpwssd fuses the square and the accumulation of diff_abs
+        __m256i diff_abs_lo = _mm256_unpacklo_epi8(diff_abs, _mm256_setzero_si256());
+        __m256i diff_abs_hi = _mm256_unpackhi_epi8(diff_abs, _mm256_setzero_si256());
+        sum = _mm256_dpwssd_avx_epi32(sum, diff_abs_lo, diff_abs_lo);
+        sum = _mm256_dpwssd_avx_epi32(sum, diff_abs_hi, diff_abs_hi);
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum);
+}
+
+export int32_t U8L2AVXVNNIResidual(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    return U8L2AVXVNNI(pv1, pv2, dim) + U8L2BF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
+}
+#endif
+
 #if defined(__AVX2__)
 export int32_t U8L2AVX2(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
     const uint8_t *pEnd1 = pv1 + (dim & ~(31u));
@@ -951,6 +1100,123 @@ export int32_t U8L2SSE2Residual(const uint8_t *pv1, const uint8_t *pv2, SizeT di
 
 //------------------------------//------------------------------//------------------------------
 
+// 4-bit codes, two dimensions are packed in one byte. The padding nibble of an odd dim is 0 in both vectors.
+// The kernels process (dim + 1) / 2 bytes and the tail bytes are handled by U4IPBF.
+
+export int32_t U4IPBF(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    int32_t res = 0;
+    for (SizeT i = 0; i < (dim + 1) / 2; ++i) {
+        res += static_cast<int32_t>(pv1[i] & 0xF) * static_cast<int32_t>(pv2[i] & 0xF);
+        res += static_cast<int32_t>(pv1[i] >> 4) * static_cast<int32_t>(pv2[i] >> 4);
+    }
+    return res;
+}
+
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+export int32_t U4IPAVX512VNNI(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const SizeT bytes = (dim + 1) / 2;
+    const uint8_t *pEnd1 = pv1 + (bytes & ~(63u));
+    const __m512i low_mask = _mm512_set1_epi8(0xF);
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pEnd1) {
+        __m512i v1 = _mm512_loadu_si512((__m512i *)pv1);
+        __m512i v2 = _mm512_loadu_si512((__m512i *)pv2);
+        sum = _mm512_dpbusd_epi32(sum, _mm512_and_si512(v1, low_mask), _mm512_and_si512(v2, low_mask));
+        sum = _mm512_dpbusd_epi32(sum, _mm512_and_si512(_mm512_srli_epi16(v1, 4), low_mask), _mm512_and_si512(_mm512_srli_epi16(v2, 4), low_mask));
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return hsum_epi32_avx512(sum) + U4IPBF(pv1, pv2, (bytes & 63) * 2);
+}
+#endif
+
+#if defined(__AVX512BW__)
+export int32_t U4IPAVX512BW(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const SizeT bytes = (dim + 1) / 2;
+    const uint8_t *pEnd1 = pv1 + (bytes & ~(63u));
+    const __m512i low_mask = _mm512_set1_epi8(0xF);
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pEnd1) {
+        __m512i v1 = _mm512_loadu_si512((__m512i *)pv1);
+        __m512i v2 = _mm512_loadu_si512((__m512i *)pv2);
+        // codes are at most 15, so the i16 sums of maddubs can't saturate
+        __m512i mul_lo = _mm512_maddubs_epi16(_mm512_and_si512(v1, low_mask), _mm512_and_si512(v2, low_mask));
+        __m512i mul_hi =
+            _mm512_maddubs_epi16(_mm512_and_si512(_mm512_srli_epi16(v1, 4), low_mask), _mm512_and_si512(_mm512_srli_epi16(v2, 4), low_mask));
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_add_epi16(mul_lo, mul_hi), _mm512_set1_epi16(1)));
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return hsum_epi32_avx512(sum) + U4IPBF(pv1, pv2, (bytes & 63) * 2);
+}
+#endif
+
+#if defined(__AVXVNNI__)
+export int32_t U4IPAVXVNNI(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const SizeT bytes = (dim + 1) / 2;
+    const uint8_t *pEnd1 = pv1 + (bytes & ~(31u));
+    const __m256i low_mask = _mm256_set1_epi8(0xF);
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i *)pv1);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        sum = _mm256_dpbusd_avx_epi32(sum, _mm256_and_si256(v1, low_mask), _mm256_and_si256(v2, low_mask));
+        sum = _mm256_dpbusd_avx_epi32(sum, _mm256_and_si256(_mm256_srli_epi16(v1, 4), low_mask), _mm256_and_si256(_mm256_srli_epi16(v2, 4), low_mask));
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum) + U4IPBF(pv1, pv2, (bytes & 31) * 2);
+}
+#endif
+
+#if defined(__AVX2__)
+export int32_t U4IPAVX2(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const SizeT bytes = (dim + 1) / 2;
+    const uint8_t *pEnd1 = pv1 + (bytes & ~(31u));
+    const __m256i low_mask = _mm256_set1_epi8(0xF);
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i *)pv1);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        // codes are at most 15, so the i16 sums of maddubs can't saturate
+        __m256i mul_lo = _mm256_maddubs_epi16(_mm256_and_si256(v1, low_mask), _mm256_and_si256(v2, low_mask));
+        __m256i mul_hi =
+            _mm256_maddubs_epi16(_mm256_and_si256(_mm256_srli_epi16(v1, 4), low_mask), _mm256_and_si256(_mm256_srli_epi16(v2, 4), low_mask));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_add_epi16(mul_lo, mul_hi), _mm256_set1_epi16(1)));
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum) + U4IPBF(pv1, pv2, (bytes & 31) * 2);
+}
+#endif
+
+#if defined(__SSE2__)
+export int32_t U4IPSSE2(const uint8_t *pv1, const uint8_t *pv2, SizeT dim) {
+    const SizeT bytes = (dim + 1) / 2;
+    const uint8_t *pEnd1 = pv1 + (bytes & ~(15u));
+    const __m128i low_mask = _mm_set1_epi16(0xF);
+    __m128i sum = _mm_setzero_si128();
+    while (pv1 < pEnd1) {
+        __m128i v1 = _mm_loadu_si128((__m128i *)pv1);
+        __m128i v2 = _mm_loadu_si128((__m128i *)pv2);
+        // unpack bytes to i16 lanes, then split the nibbles of each lane
+        __m128i v1_lo = _mm_unpacklo_epi8(v1, _mm_setzero_si128());
+        __m128i v2_lo = _mm_unpacklo_epi8(v2, _mm_setzero_si128());
+        __m128i v1_hi = _mm_unpackhi_epi8(v1, _mm_setzero_si128());
+        __m128i v2_hi = _mm_unpackhi_epi8(v2, _mm_setzero_si128());
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_and_si128(v1_lo, low_mask), _mm_and_si128(v2_lo, low_mask)));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_srli_epi16(v1_lo, 4), _mm_srli_epi16(v2_lo, 4)));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_and_si128(v1_hi, low_mask), _mm_and_si128(v2_hi, low_mask)));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_srli_epi16(v1_hi, 4), _mm_srli_epi16(v2_hi, 4)));
+        pv1 += 16;
+        pv2 += 16;
+    }
+    return hsum_epi32_sse2(sum) + U4IPBF(pv1, pv2, (bytes & 15) * 2);
+}
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
 export float F32L2BF(const float *pv1, const float *pv2, SizeT dim) {
     float res = 0;
     for (SizeT i = 0; i < dim; i++) {
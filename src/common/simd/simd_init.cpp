@@ -192,11 +192,21 @@ F32DistanceFuncType Get_HNSW_F32Cos_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_64_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNI;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8IPAVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8IPAVX;
@@ -211,11 +221,21 @@ I8DistanceFuncType Get_HNSW_I8IP_64_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_32_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8IPAVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8IPAVX;
@@ -230,11 +250,21 @@ I8DistanceFuncType Get_HNSW_I8IP_32_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_16_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8IPAVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8IPAVXResidual;
@@ -249,11 +279,21 @@ I8DistanceFuncType Get_HNSW_I8IP_16_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8IPAVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8IPAVXResidual;
@@ -268,11 +308,21 @@ I8DistanceFuncType Get_HNSW_I8IP_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8L2_64_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &I8L2AVX512VNNI;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &I8L2AVX512BW;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8L2AVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8L2AVX2;
@@ -287,11 +337,21 @@ I8DistanceFuncType Get_HNSW_I8L2_64_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8L2_32_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &I8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &I8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8L2AVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8L2AVX2;
@@ -306,11 +366,21 @@ I8DistanceFuncType Get_HNSW_I8L2_32_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8L2_16_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &I8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &I8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8L2AVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8L2AVX2Residual;
@@ -325,11 +395,21 @@ I8DistanceFuncType Get_HNSW_I8L2_16_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8L2_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &I8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &I8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &I8L2AVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &I8L2AVX2Residual;
@@ -363,11 +443,21 @@ I8CosDistanceFuncType Get_HNSW_I8Cos_ptr() {
 }
 
 U8DistanceFuncType Get_HNSW_U8L2_64_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &U8L2AVX512VNNI;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &U8L2AVX512BW;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &U8L2AVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &U8L2AVX2;
@@ -382,11 +472,21 @@ U8DistanceFuncType Get_HNSW_U8L2_64_ptr() {
 }
 
 U8DistanceFuncType Get_HNSW_U8L2_32_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &U8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &U8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &U8L2AVXVNNI;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &U8L2AVX2;
@@ -401,11 +501,21 @@ U8DistanceFuncType Get_HNSW_U8L2_32_ptr() {
 }
 
 U8DistanceFuncType Get_HNSW_U8L2_16_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &U8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &U8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &U8L2AVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &U8L2AVX2Residual;
@@ -420,11 +530,21 @@ U8DistanceFuncType Get_HNSW_U8L2_16_ptr() {
 }
 
 U8DistanceFuncType Get_HNSW_U8L2_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &U8L2AVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512BW__)
     if (IsAVX512BWSupported()) {
         return &U8L2AVX512BWResidual;
     }
 #endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &U8L2AVXVNNIResidual;
+    }
+#endif
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
         return &U8L2AVX2Residual;
@@ -533,6 +653,35 @@ U8CosDistanceFuncType Get_HNSW_U8Cos_ptr() {
     return &U8CosBF;
 }
 
+U4DistanceFuncType Get_HNSW_U4IP_ptr() {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        return &U4IPAVX512VNNI;
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        return &U4IPAVX512BW;
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        return &U4IPAVXVNNI;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &U4IPAVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        return &U4IPSSE2;
+    }
+#endif
+    return &U4IPBF;
+}
+
 MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr() {
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
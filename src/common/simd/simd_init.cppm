@@ -26,6 +26,8 @@ export using infinity::IsSSE2Supported;
 export using infinity::IsAVX2Supported;
 export using infinity::IsAVX512Supported;
 export using infinity::IsAVX512BWSupported;
+export using infinity::IsAVX512VNNISupported;
+export using infinity::IsAVXVNNISupported;
 
 export using F32DistanceFuncType = f32 (*)(const f32 *, const f32 *, SizeT);
 export using I8DistanceFuncType = i32 (*)(const i8 *, const i8 *, SizeT);
@@ -34,6 +36,8 @@ export using U8DistanceFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
 // dimension in hamming distance is in bytes
 export using U8HammingDistanceFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
 export using U8CosDistanceFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
+// 4-bit codes packed in bytes, dimension is the number of codes
+export using U4DistanceFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
 export using MaxSimF32BitIPFuncType = f32 (*)(const f32 *, const u8 *, SizeT);
 export using MaxSimI32BitIPFuncType = i32 (*)(const i32 *, const u8 *, SizeT);
 export using MaxSimI64BitIPFuncType = i64 (*)(const i64 *, const u8 *, SizeT);
@@ -76,6 +80,8 @@ export U8DistanceFuncType Get_HNSW_U8IP_16_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_32_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_64_ptr();
 export U8CosDistanceFuncType Get_HNSW_U8Cos_ptr();
+// HNSW U4
+export U4DistanceFuncType Get_HNSW_U4IP_ptr();
 // MaxSim IP
 export MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr();
 export MaxSimI32BitIPFuncType GetMaxSimI32BitIPFuncPtr();
@@ -24,6 +24,8 @@ struct SupportedSimdTypes {
     bool is_avx2_ = NGT::CpuInfo::isAVX2();
     bool is_avx512_ = NGT::CpuInfo::isAVX512();
     bool is_avx512bw_ = NGT::CpuInfo::isAVX512BW();
+    bool is_avx512vnni_ = NGT::CpuInfo::isAVX512VNNI();
+    bool is_avxvnni_ = NGT::CpuInfo::isAVXVNNI();
 };
 
 const SupportedSimdTypes &GetSupportedSimdTypes() {
@@ -43,4 +45,8 @@ bool IsAVX512Supported() { return GetSupportedSimdTypes().is_avx512_; }
 
 bool IsAVX512BWSupported() { return GetSupportedSimdTypes().is_avx512bw_; }
 
+bool IsAVX512VNNISupported() { return GetSupportedSimdTypes().is_avx512vnni_; }
+
+bool IsAVXVNNISupported() { return GetSupportedSimdTypes().is_avxvnni_; }
+
 } // namespace infinity
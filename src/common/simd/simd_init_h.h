@@ -23,5 +23,7 @@ bool IsSSE2Supported();
 bool IsAVX2Supported();
 bool IsAVX512Supported();
 bool IsAVX512BWSupported();
+bool IsAVX512VNNISupported();
+bool IsAVXVNNISupported();
 
 } // namespace infinity
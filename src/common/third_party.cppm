@@ -104,8 +104,23 @@ export using minio::s3::BucketExistsArgs;
 export using minio::s3::BucketExistsResponse;
 export using minio::s3::MakeBucketArgs;
 export using minio::s3::MakeBucketResponse;
+export using minio::s3::StatObjectArgs;
+export using minio::s3::StatObjectResponse;
+export using minio::s3::GetObjectArgs;
+export using minio::s3::GetObjectResponse;
+export using minio::s3::CreateMultipartUploadArgs;
+export using minio::s3::CreateMultipartUploadResponse;
+export using minio::s3::UploadPartArgs;
+export using minio::s3::UploadPartResponse;
+export using minio::s3::CompleteMultipartUploadArgs;
+export using minio::s3::CompleteMultipartUploadResponse;
+export using minio::s3::Part;
 } // namespace s3
 
+namespace http {
+export using minio::http::DataFunctionArgs;
+} // namespace http
+
 namespace creds {
 export using minio::creds::StaticProvider;
 } // namespace creds
@@ -0,0 +1,63 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <exception>
+#include <future>
+
+export module parallel_for;
+
+import stl;
+
+namespace infinity {
+
+// Run func(begin, end) on [0, n) split into at most task_num contiguous ranges.
+// The first range runs on the caller thread and the others on thread_pool. It returns after all ranges are done, and
+// rethrows the first exception thrown by any of them. func must not call ParallelFor on the same pool, the caller waits
+// for the pool and a nested call may wait for itself.
+export template <typename Func>
+void ParallelFor(ThreadPool &thread_pool, SizeT n, SizeT task_num, Func &&func) {
+    task_num = std::min(task_num, n);
+    if (task_num <= 1) {
+        func(SizeT(0), n);
+        return;
+    }
+    const SizeT step = (n + task_num - 1) / task_num;
+    Vector<std::future<void>> futures;
+    futures.reserve(task_num - 1);
+    for (SizeT begin = step; begin < n; begin += step) {
+        futures.emplace_back(thread_pool.push([&func, begin, end = std::min(begin + step, n)](int) { func(begin, end); }));
+    }
+    std::exception_ptr first_error{};
+    try {
+        func(SizeT(0), step);
+    } catch (...) {
+        first_error = std::current_exception();
+    }
+    for (auto &future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+} // namespace infinity
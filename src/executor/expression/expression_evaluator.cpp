@@ -196,7 +196,7 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
         UnrecoverableError(error_message);
     }
 
-    output_column_vector = input_data_block_->column_vectors[column_index];
+    output_column_vector = input_data_block_->SelectedColumn(column_index);
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
@@ -239,7 +239,7 @@ void ExpressionEvaluator::Execute(const SharedPtr<FilterFulltextExpression> &exp
     if (input_data_block_->column_vectors.empty()) {
         UnrecoverableError("Input data block is empty");
     }
-    const auto *expect_rowid_col = input_data_block_->column_vectors.back().get();
+    const auto *expect_rowid_col = input_data_block_->SelectedColumn(input_data_block_->column_count() - 1).get();
     if (expect_rowid_col->data_type()->type() != LogicalType::kRowID) {
         UnrecoverableError("Input data type last column is not rowid");
     }
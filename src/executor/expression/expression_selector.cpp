@@ -29,11 +29,50 @@ import internal_types;
 import third_party;
 import data_type;
 import logger;
+import function_expression;
+import expression_type;
 
 import infinity_exception;
 
 namespace infinity {
 
+namespace {
+
+bool IsConjunction(const SharedPtr<BaseExpression> &expr, bool &is_and) {
+    if (expr->type() != ExpressionType::kFunction || expr->arguments().size() != 2) {
+        return false;
+    }
+    const String &function_name = static_cast<const FunctionExpression *>(expr.get())->ScalarFunctionName();
+    if (function_name == "AND") {
+        is_and = true;
+        return true;
+    }
+    if (function_name == "OR") {
+        is_and = false;
+        return true;
+    }
+    return false;
+}
+
+// a AND (b AND c) -> [a, b, c]
+void FlattenConjunction(const SharedPtr<BaseExpression> &expr,
+                        SharedPtr<ExpressionState> &state,
+                        bool is_and,
+                        Vector<Pair<SharedPtr<BaseExpression>, SharedPtr<ExpressionState>>> &terms) {
+    for (SizeT idx = 0; idx < 2; ++idx) {
+        SharedPtr<BaseExpression> &child_expr = expr->arguments()[idx];
+        SharedPtr<ExpressionState> &child_state = state->Children()[idx];
+        bool child_is_and = false;
+        if (IsConjunction(child_expr, child_is_and) && child_is_and == is_and) {
+            FlattenConjunction(child_expr, child_state, is_and, terms);
+        } else {
+            terms.emplace_back(child_expr, child_state);
+        }
+    }
+}
+
+} // namespace
+
 SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                  SharedPtr<ExpressionState> &state,
                                  const DataBlock *input_data_block,
@@ -47,9 +86,9 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
 
     Select(expr, state, count, input_select, output_true_select, output_false_select);
 
-    // Shrink the input data block into output data block
+    // The output data block shares the columns of the input, the selected rows are copied when the block is materialized
     // this Init function will throw if output_data_block is already initialized before
-    output_data_block->Init(input_data_block, output_true_select);
+    output_data_block->InitSelected(input_data_block, output_true_select);
     return output_true_select->Size();
 }
 
@@ -77,14 +116,148 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
                                 SharedPtr<Selection> &output_true_select) {
+    SharedPtr<Selection> input_rows = MakeShared<Selection>();
+    input_rows->Initialize(count);
+    for (SizeT idx = 0; idx < count; ++idx) {
+        input_rows->Append(idx);
+    }
+    SelectRows(expr, state, input_rows, output_true_select);
+}
+
+void ExpressionSelector::SelectRows(const SharedPtr<BaseExpression> &expr,
+                                    SharedPtr<ExpressionState> &state,
+                                    const SharedPtr<Selection> &input_rows,
+                                    SharedPtr<Selection> &output_rows) {
+    SizeT row_count = input_rows->Size();
+    if (row_count == 0) {
+        return;
+    }
+    bool is_and = false;
+    if (IsConjunction(expr, is_and)) {
+        SelectConjunction(expr, state, is_and, input_rows, output_rows);
+        return;
+    }
+
+    // evaluate the expression on the rows of input_rows only
+    DataBlock selected_block;
+    selected_block.InitSelected(input_data_, input_rows);
+
     SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
     bool_column->Initialize(ColumnVectorType::kCompactBit);
 
     ExpressionEvaluator expr_evaluator;
-    expr_evaluator.Init(input_data_);
+    expr_evaluator.Init(&selected_block);
     expr_evaluator.Execute(expr, state, bool_column);
 
-    Select(bool_column, count, output_true_select, true);
+    if (row_count == input_data_->row_count()) {
+        // input_rows are all the rows
+        Select(bool_column, row_count, output_rows, true);
+        return;
+    }
+    SharedPtr<Selection> selected_rows = MakeShared<Selection>();
+    selected_rows->Initialize(row_count);
+    Select(bool_column, row_count, selected_rows, true);
+    for (SizeT idx = 0; idx < selected_rows->Size(); ++idx) {
+        output_rows->Append(input_rows->Get(selected_rows->Get(idx)));
+    }
+}
+
+void ExpressionSelector::SelectConjunction(const SharedPtr<BaseExpression> &expr,
+                                           SharedPtr<ExpressionState> &state,
+                                           bool is_and,
+                                           const SharedPtr<Selection> &input_rows,
+                                           SharedPtr<Selection> &output_rows) {
+    Vector<Pair<SharedPtr<BaseExpression>, SharedPtr<ExpressionState>>> terms;
+    FlattenConjunction(expr, state, is_and, terms);
+    Vector<ConjunctionTermStats> &term_stats = conjunction_stats_[expr.get()];
+    if (term_stats.size() != terms.size()) {
+        term_stats.assign(terms.size(), ConjunctionTermStats());
+    }
+
+    // AND: the undecided rows are the rows passing all the terms so far
+    // OR: the undecided rows are the rows failing all the terms so far, the passing rows of each term are kept apart
+    SharedPtr<Selection> undecided_rows = input_rows;
+    Vector<SharedPtr<Selection>> or_selected_rows;
+    for (SizeT term_idx : TermOrder(expr.get(), is_and, terms.size())) {
+        SizeT undecided_count = undecided_rows->Size();
+        if (undecided_count == 0) {
+            break;
+        }
+        auto &[term_expr, term_state] = terms[term_idx];
+        SharedPtr<Selection> term_rows = MakeShared<Selection>();
+        term_rows->Initialize(undecided_count);
+
+        auto begin_time = Clock::now();
+        SelectRows(term_expr, term_state, undecided_rows, term_rows);
+        auto cost = ElapsedFromStart(Clock::now(), begin_time);
+
+        ConjunctionTermStats &stats = term_stats[term_idx];
+        stats.input_rows_ += undecided_count;
+        stats.selected_rows_ += term_rows->Size();
+        stats.cost_ns_ += cost.count();
+        if (stats.input_rows_ > (1u << 20)) {
+            // decay, so that the order follows the data
+            stats.input_rows_ /= 2;
+            stats.selected_rows_ /= 2;
+            stats.cost_ns_ /= 2;
+        }
+
+        if (is_and) {
+            undecided_rows = std::move(term_rows);
+            continue;
+        }
+        SharedPtr<Selection> remaining_rows = MakeShared<Selection>();
+        remaining_rows->Initialize(undecided_count);
+        SizeT term_row_count = term_rows->Size();
+        for (SizeT idx = 0, term_pos = 0; idx < undecided_count; ++idx) {
+            SizeT row_idx = undecided_rows->Get(idx);
+            if (term_pos < term_row_count && term_rows->Get(term_pos) == row_idx) {
+                ++term_pos;
+            } else {
+                remaining_rows->Append(row_idx);
+            }
+        }
+        or_selected_rows.emplace_back(std::move(term_rows));
+        undecided_rows = std::move(remaining_rows);
+    }
+
+    if (is_and) {
+        for (SizeT idx = 0; idx < undecided_rows->Size(); ++idx) {
+            output_rows->Append(undecided_rows->Get(idx));
+        }
+        return;
+    }
+    // the passing rows of the terms are disjoint, output them in row order
+    Vector<SizeT> selected_rows;
+    for (const auto &term_rows : or_selected_rows) {
+        for (SizeT idx = 0; idx < term_rows->Size(); ++idx) {
+            selected_rows.push_back(term_rows->Get(idx));
+        }
+    }
+    std::sort(selected_rows.begin(), selected_rows.end());
+    for (SizeT row_idx : selected_rows) {
+        output_rows->Append(row_idx);
+    }
+}
+
+Vector<SizeT> ExpressionSelector::TermOrder(const BaseExpression *conjunction, bool is_and, SizeT term_count) {
+    Vector<SizeT> order(term_count);
+    std::iota(order.begin(), order.end(), 0);
+    auto iter = conjunction_stats_.find(conjunction);
+    if (iter == conjunction_stats_.end() || iter->second.size() != term_count) {
+        return order;
+    }
+    // Rank by cost per decided row: a term of AND decides the rows it drops, a term of OR the rows it passes.
+    // Smoothed, so that a term not evaluated yet looks cheap and gets measured.
+    Vector<double> ranks(term_count);
+    for (SizeT idx = 0; idx < term_count; ++idx) {
+        const ConjunctionTermStats &stats = iter->second[idx];
+        double pass_rate = (stats.selected_rows_ + 1.0) / (stats.input_rows_ + 2.0);
+        double row_cost = (stats.cost_ns_ + 1.0) / (stats.input_rows_ + 1.0);
+        ranks[idx] = row_cost / (is_and ? 1.0 - pass_rate : pass_rate);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](SizeT left, SizeT right) { return ranks[left] < ranks[right]; });
+    return order;
 }
 
 void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable) {
@@ -25,6 +25,13 @@ export module expression_selector;
 namespace infinity {
 class ColumnVector;
 
+// Observed cost and selectivity of a term of an AND / OR, accumulated over the blocks selected by one filter task.
+export struct ConjunctionTermStats {
+    u64 input_rows_{};
+    u64 selected_rows_{};
+    u64 cost_ns_{};
+};
+
 export class ExpressionSelector {
 public:
     SizeT Select(const SharedPtr<BaseExpression> &expr,
@@ -44,8 +51,27 @@ public:
 
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
+    // Evaluation order of the terms of conjunction, cheapest and most decisive first. Exposed for tests.
+    Vector<SizeT> TermOrder(const BaseExpression *conjunction, bool is_and, SizeT term_count);
+
 private:
+    // Append the rows of input_rows (row indexes of input_data_, ascending) for which expr is true to output_rows.
+    // AND / OR are evaluated term by term, each term only on the rows not decided by the previous ones.
+    void SelectRows(const SharedPtr<BaseExpression> &expr,
+                    SharedPtr<ExpressionState> &state,
+                    const SharedPtr<Selection> &input_rows,
+                    SharedPtr<Selection> &output_rows);
+
+    void SelectConjunction(const SharedPtr<BaseExpression> &expr,
+                           SharedPtr<ExpressionState> &state,
+                           bool is_and,
+                           const SharedPtr<Selection> &input_rows,
+                           SharedPtr<Selection> &output_rows);
+
     const DataBlock *input_data_{nullptr};
+
+    // keyed by the AND / OR expression, terms in the order of the flattened expression
+    HashMap<const BaseExpression *, Vector<ConjunctionTermStats>> conjunction_stats_{};
 };
 
 } // namespace infinity
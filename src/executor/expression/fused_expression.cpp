@@ -0,0 +1,368 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+module fused_expression;
+
+import stl;
+import base_expression;
+import function_expression;
+import value_expression;
+import expression_state;
+import expression_evaluator;
+import expression_type;
+import column_vector;
+import logical_type;
+import internal_types;
+import value;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT kChunkSize = 1024;
+
+bool IsLeafType(LogicalType type) {
+    switch (type) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// binary function over two doubles
+const FunctionExpression *DoubleFunction(const SharedPtr<BaseExpression> &expr) {
+    if (expr->type() != ExpressionType::kFunction || expr->arguments().size() != 2) {
+        return nullptr;
+    }
+    for (const auto &argument : expr->arguments()) {
+        if (argument->Type().type() != LogicalType::kDouble) {
+            return nullptr;
+        }
+    }
+    return static_cast<const FunctionExpression *>(expr.get());
+}
+
+template <typename T>
+void LoadColumn(const ColumnVector &column, SizeT begin, SizeT len, DoubleT *__restrict dst) {
+    const auto *src = reinterpret_cast<const T *>(column.data());
+    if (column.vector_type() == ColumnVectorType::kConstant) {
+        std::fill(dst, dst + len, static_cast<DoubleT>(src[0]));
+        return;
+    }
+    src += begin;
+    for (SizeT i = 0; i < len; ++i) {
+        dst[i] = static_cast<DoubleT>(src[i]);
+    }
+}
+
+inline void CheckFinite(const DoubleT *__restrict values, SizeT len, u8 *__restrict valid) {
+    for (SizeT i = 0; i < len; ++i) {
+        valid[i] &= static_cast<u8>(std::isfinite(values[i]));
+    }
+}
+
+template <typename Op>
+inline void Arithmetic(DoubleT *__restrict left, const DoubleT *__restrict right, SizeT len, u8 *__restrict valid, Op op) {
+    for (SizeT i = 0; i < len; ++i) {
+        left[i] = op(left[i], right[i]);
+    }
+    CheckFinite(left, len, valid);
+}
+
+template <typename Op>
+inline void Compare(DoubleT *__restrict left, const DoubleT *__restrict right, SizeT len, Op op) {
+    for (SizeT i = 0; i < len; ++i) {
+        left[i] = op(left[i], right[i]) ? 1.0 : 0.0;
+    }
+}
+
+} // namespace
+
+SharedPtr<FusedExpression> FusedExpression::Compile(const SharedPtr<BaseExpression> &expr) {
+    const FunctionExpression *root = DoubleFunction(expr);
+    if (root == nullptr) {
+        return nullptr;
+    }
+    static const HashMap<String, OpCode> compare_ops = {
+        {"<", OpCode::kLess},
+        {"<=", OpCode::kLessEqual},
+        {">", OpCode::kGreater},
+        {">=", OpCode::kGreaterEqual},
+        {"=", OpCode::kEqual},
+        {"<>", OpCode::kNotEqual},
+    };
+    auto fused = MakeShared<FusedExpression>();
+    SizeT depth = 0;
+    if (auto iter = compare_ops.find(root->ScalarFunctionName()); iter != compare_ops.end() && expr->Type().type() == LogicalType::kBoolean) {
+        fused->CompileNode(expr->arguments()[0], depth);
+        fused->CompileNode(expr->arguments()[1], depth);
+        fused->Push({iter->second}, depth);
+        fused->boolean_result_ = true;
+    } else if (expr->Type().type() == LogicalType::kDouble) {
+        fused->CompileNode(expr, depth);
+        if (fused->program_.back().op_ == OpCode::kLoadLeaf) {
+            return nullptr;
+        }
+    } else {
+        return nullptr;
+    }
+    if (fused->OperationCount() < 2) {
+        return nullptr;
+    }
+    return fused;
+}
+
+void FusedExpression::CompileNode(const SharedPtr<BaseExpression> &expr, SizeT &depth) {
+    static const HashMap<String, OpCode> arithmetic_ops = {
+        {"+", OpCode::kAdd},
+        {"-", OpCode::kSubtract},
+        {"*", OpCode::kMultiply},
+        {"/", OpCode::kDivide},
+    };
+    if (const FunctionExpression *function_expr = DoubleFunction(expr); function_expr != nullptr && expr->Type().type() == LogicalType::kDouble) {
+        if (auto iter = arithmetic_ops.find(function_expr->ScalarFunctionName()); iter != arithmetic_ops.end()) {
+            CompileNode(expr->arguments()[0], depth);
+            CompileNode(expr->arguments()[1], depth);
+            Push({iter->second}, depth);
+            return;
+        }
+    }
+    if (expr->type() == ExpressionType::kCast && expr->Type().type() == LogicalType::kDouble) {
+        // numeric to double casts are exact conversions, done when the value is loaded
+        const SharedPtr<BaseExpression> &child = expr->arguments()[0];
+        if (IsLeafType(child->Type().type())) {
+            CompileNode(child, depth);
+            return;
+        }
+    }
+    LogicalType type = expr->Type().type();
+    if (expr->type() == ExpressionType::kValue && IsLeafType(type)) {
+        const Value &value = static_cast<const ValueExpression *>(expr.get())->GetValue();
+        DoubleT constant = 0;
+        switch (type) {
+            case LogicalType::kTinyInt:
+                constant = value.GetValue<TinyIntT>();
+                break;
+            case LogicalType::kSmallInt:
+                constant = value.GetValue<SmallIntT>();
+                break;
+            case LogicalType::kInteger:
+                constant = value.GetValue<IntegerT>();
+                break;
+            case LogicalType::kBigInt:
+                constant = value.GetValue<BigIntT>();
+                break;
+            case LogicalType::kFloat:
+                constant = value.GetValue<FloatT>();
+                break;
+            default:
+                constant = value.GetValue<DoubleT>();
+                break;
+        }
+        ++constant_count_;
+        Push({OpCode::kConstant, 0, constant}, depth);
+        return;
+    }
+    if (!IsLeafType(type)) {
+        UnrecoverableError(fmt::format("Unexpected operand type of fused expression: {}", expr->Type().ToString()));
+    }
+    leaves_.push_back({expr, type});
+    Push({OpCode::kLoadLeaf, leaves_.size() - 1}, depth);
+}
+
+void FusedExpression::Push(const Instruction &instruction, SizeT &depth) {
+    program_.push_back(instruction);
+    if (instruction.op_ == OpCode::kLoadLeaf || instruction.op_ == OpCode::kConstant) {
+        ++depth;
+        stack_depth_ = std::max(stack_depth_, depth);
+    } else {
+        --depth;
+    }
+}
+
+Vector<SharedPtr<ExpressionState>> FusedExpression::CreateLeafStates() const {
+    Vector<SharedPtr<ExpressionState>> leaf_states;
+    leaf_states.reserve(leaves_.size());
+    for (const Leaf &leaf : leaves_) {
+        leaf_states.emplace_back(ExpressionState::CreateState(leaf.expr_));
+    }
+    return leaf_states;
+}
+
+bool FusedExpression::Execute(ExpressionEvaluator &evaluator, Vector<SharedPtr<ExpressionState>> &leaf_states, SharedPtr<ColumnVector> &output_column) const {
+    SizeT leaf_count = leaves_.size();
+    Vector<const ColumnVector *> leaf_columns(leaf_count);
+    SizeT row_count = 0;
+    bool has_flat_leaf = false;
+    for (SizeT leaf_idx = 0; leaf_idx < leaf_count; ++leaf_idx) {
+        SharedPtr<ColumnVector> &leaf_output = leaf_states[leaf_idx]->OutputColumnVector();
+        evaluator.Execute(leaves_[leaf_idx].expr_, leaf_states[leaf_idx], leaf_output);
+        leaf_columns[leaf_idx] = leaf_output.get();
+        switch (leaf_output->vector_type()) {
+            case ColumnVectorType::kFlat: {
+                row_count = leaf_output->Size();
+                has_flat_leaf = true;
+                break;
+            }
+            case ColumnVectorType::kConstant: {
+                break;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+    if (!has_flat_leaf) {
+        // constant result
+        return false;
+    }
+
+    Vector<DoubleT> stack(stack_depth_ * kChunkSize);
+    Vector<u8> valid(kChunkSize);
+    auto &output_null = output_column->nulls_ptr_;
+    output_null->SetAllTrue();
+    auto *output_ptr = boolean_result_ ? nullptr : reinterpret_cast<DoubleT *>(output_column->data());
+
+    for (SizeT begin = 0; begin < row_count; begin += kChunkSize) {
+        SizeT len = std::min(kChunkSize, row_count - begin);
+        std::fill_n(valid.data(), len, 1);
+        SizeT top = 0;
+        for (const Instruction &instruction : program_) {
+            DoubleT *left = stack.data() + (top >= 2 ? top - 2 : 0) * kChunkSize;
+            const DoubleT *right = left + kChunkSize;
+            switch (instruction.op_) {
+                case OpCode::kLoadLeaf: {
+                    DoubleT *dst = stack.data() + top * kChunkSize;
+                    const ColumnVector &column = *leaf_columns[instruction.leaf_idx_];
+                    switch (leaves_[instruction.leaf_idx_].type_) {
+                        case LogicalType::kTinyInt:
+                            LoadColumn<TinyIntT>(column, begin, len, dst);
+                            break;
+                        case LogicalType::kSmallInt:
+                            LoadColumn<SmallIntT>(column, begin, len, dst);
+                            break;
+                        case LogicalType::kInteger:
+                            LoadColumn<IntegerT>(column, begin, len, dst);
+                            break;
+                        case LogicalType::kBigInt:
+                            LoadColumn<BigIntT>(column, begin, len, dst);
+                            break;
+                        case LogicalType::kFloat:
+                            LoadColumn<FloatT>(column, begin, len, dst);
+                            break;
+                        default:
+                            LoadColumn<DoubleT>(column, begin, len, dst);
+                            break;
+                    }
+                    const auto &leaf_null = column.nulls_ptr_;
+                    if (!leaf_null->IsAllTrue()) {
+                        bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+                        for (SizeT i = 0; i < len; ++i) {
+                            valid[i] &= static_cast<u8>(leaf_null->IsTrue(is_constant ? 0 : begin + i));
+                        }
+                    }
+                    ++top;
+                    break;
+                }
+                case OpCode::kConstant: {
+                    DoubleT *dst = stack.data() + top * kChunkSize;
+                    std::fill_n(dst, len, instruction.constant_);
+                    ++top;
+                    break;
+                }
+                case OpCode::kAdd: {
+                    Arithmetic(left, right, len, valid.data(), [](DoubleT a, DoubleT b) { return a + b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kSubtract: {
+                    Arithmetic(left, right, len, valid.data(), [](DoubleT a, DoubleT b) { return a - b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kMultiply: {
+                    Arithmetic(left, right, len, valid.data(), [](DoubleT a, DoubleT b) { return a * b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kDivide: {
+                    // x / 0 is infinite or NaN, so NULL as DivFunction gives
+                    Arithmetic(left, right, len, valid.data(), [](DoubleT a, DoubleT b) { return a / b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kLess: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a < b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kLessEqual: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a <= b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kGreater: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a > b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kGreaterEqual: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a >= b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kEqual: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a == b; });
+                    --top;
+                    break;
+                }
+                case OpCode::kNotEqual: {
+                    Compare(left, right, len, [](DoubleT a, DoubleT b) { return a != b; });
+                    --top;
+                    break;
+                }
+            }
+        }
+
+        const DoubleT *result = stack.data();
+        if (boolean_result_) {
+            for (SizeT i = 0; i < len; ++i) {
+                output_column->buffer_->SetCompactBit(begin + i, result[i] != 0);
+            }
+        } else {
+            std::copy_n(result, len, output_ptr + begin);
+        }
+        for (SizeT i = 0; i < len; ++i) {
+            if (!valid[i]) {
+                output_null->SetFalse(begin + i);
+            }
+        }
+    }
+    output_column->Finalize(row_count);
+    return true;
+}
+
+} // namespace infinity
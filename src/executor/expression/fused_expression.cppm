@@ -0,0 +1,85 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module fused_expression;
+
+import stl;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import column_vector;
+import logical_type;
+
+namespace infinity {
+
+// An expression tree of double arithmetic (+ - * /), numeric casts to double, and optionally a comparison at the
+// root, compiled into a stack program once per plan. The program runs over chunks of rows in scratch buffers, so the
+// tree is evaluated without an intermediate ColumnVector per node and every step is a plain loop the compiler can
+// vectorize. Sub expressions of other kinds are the leaves and are evaluated by ExpressionEvaluator.
+// Results, including NULL for NaN / infinite intermediate values, are the same as evaluating the tree node by node.
+export class FusedExpression {
+public:
+    // nullptr if the tree has less than two operations to fuse
+    static SharedPtr<FusedExpression> Compile(const SharedPtr<BaseExpression> &expr);
+
+    Vector<SharedPtr<ExpressionState>> CreateLeafStates() const;
+
+    // False if the leaves don't have a flat column, the expression should be evaluated by ExpressionEvaluator then.
+    bool Execute(ExpressionEvaluator &evaluator, Vector<SharedPtr<ExpressionState>> &leaf_states, SharedPtr<ColumnVector> &output_column) const;
+
+    [[nodiscard]] SizeT OperationCount() const { return program_.size() - leaves_.size() - constant_count_; }
+
+    [[nodiscard]] SizeT LeafCount() const { return leaves_.size(); }
+
+private:
+    enum class OpCode : u8 {
+        kLoadLeaf,
+        kConstant,
+        kAdd,
+        kSubtract,
+        kMultiply,
+        kDivide,
+        kLess,
+        kLessEqual,
+        kGreater,
+        kGreaterEqual,
+        kEqual,
+        kNotEqual,
+    };
+
+    struct Instruction {
+        OpCode op_{};
+        SizeT leaf_idx_{};
+        DoubleT constant_{};
+    };
+
+    struct Leaf {
+        SharedPtr<BaseExpression> expr_{};
+        LogicalType type_{};
+    };
+
+    void CompileNode(const SharedPtr<BaseExpression> &expr, SizeT &depth);
+
+    void Push(const Instruction &instruction, SizeT &depth);
+
+    Vector<Instruction> program_{};
+    Vector<Leaf> leaves_{};
+    SizeT constant_count_{};
+    SizeT stack_depth_{};
+    bool boolean_result_{false};
+};
+
+} // namespace infinity
@@ -38,6 +38,11 @@ public:
 #endif
     }
 
+    void Reset(QueryContext *query_context_ptr) {
+        query_context_ptr_ = query_context_ptr;
+        fragment_id_ = 0;
+    }
+
     SharedPtr<PlanFragment> BuildFragment(const Vector<PhysicalOperator *> &physical_plans);
 
 private:
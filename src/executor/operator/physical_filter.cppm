@@ -48,6 +48,8 @@ public:
 
     SizeT TaskletCount() override { return left_->TaskletCount(); }
 
+    bool AcceptSelectedInput() const override { return true; }
+
     inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
 
 private:
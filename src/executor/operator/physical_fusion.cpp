@@ -60,12 +60,9 @@ namespace infinity {
 
 struct DocScore {
     RowID row_id_;
-    u64 from_input_data_block_id_;
-    u32 from_block_idx_;
-    u32 from_row_idx_;
     float fusion_score_;
-    Vector<float> child_scores_;
-    Vector<bool> mask_;
+    // index of the last child which contributed to fusion_score_
+    SizeT last_child_idx_;
 };
 
 PhysicalFusion::PhysicalFusion(const u64 id,
@@ -113,12 +110,14 @@ void PhysicalFusion::Init(QueryContext* query_context) {
 }
 
 // Refers to https://www.elastic.co/guide/en/elasticsearch/reference/current/rrf.html
-void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
+void PhysicalFusion::ExecuteRRFWeighted(QueryContext *query_context,
+                                        const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
                                         Vector<UniquePtr<DataBlock>> &output_data_block_array) const {
     SizeT num_children = 2 + other_children_.size();
     SizeT rank_constant = 60;
     SizeT topn = DEFAULT_FUSION_OPTION_TOP_N;
     Vector<float> weights;
+    Optional<float> min_score;
     if (fusion_expr_->options_.get() != nullptr) {
         if (auto it = fusion_expr_->options_->options_.find("window_size"); it != fusion_expr_->options_->options_.end()) {
             long l = std::strtol(it->second.c_str(), NULL, 10);
@@ -150,8 +149,14 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
                     weights.push_back(value);
                 }
             }
+            if (auto it = fusion_expr_->options_->options_.find("min_score"); it != fusion_expr_->options_->options_.end()) {
+                min_score = std::stof(it->second);
+            }
         }
     }
+    Vector<bool> min_heaps;
+    // upper bound of the score a doc can still gain from children [i, num_children)
+    Vector<double> remaining_max_scores;
     if (fusion_method_ == FusionMethod::kWeightedSum) {
         SizeT num_weights = weights.size();
         if (num_weights < num_children) {
@@ -159,15 +164,29 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
                 weights.push_back(1.0F);
             }
         }
+        min_heaps = GetChildrenMinHeap();
+        remaining_max_scores.resize(num_children + 1, 0.0);
+        for (SizeT i = num_children; i > 0; --i) {
+            remaining_max_scores[i - 1] = remaining_max_scores[i] + std::max(weights[i - 1], 0.0F);
+        }
     }
 
+    // 1 accumulate every doc's fusion_score child by child
+    SizeT input_row_count = 0;
+    for (const auto &[fragment_id, input_blocks] : input_data_blocks) {
+        for (const UniquePtr<DataBlock> &input_data_block : input_blocks) {
+            input_row_count += input_data_block->row_count();
+        }
+    }
     Vector<DocScore> rescore_vec;
-    Map<RowID, SizeT> rescore_map; // row_id to index of rescore_vec_
-    // 1 Prepare rescore_vec
+    rescore_vec.reserve(input_row_count);
+    FlatHashMap<u64, u32> rescore_map; // row_id to index of rescore_vec
+    rescore_map.reserve(input_row_count);
+    Vector<double> child_scores;
     SizeT fragment_idx = 0;
     for (const auto &[fragment_id, input_blocks] : input_data_blocks) {
+        assert(fragment_idx < num_children);
         SizeT base_rank = 1;
-        u32 from_block_idx = 0;
         for (const UniquePtr<DataBlock> &input_data_block : input_blocks) {
             if (input_data_block->column_count() != GetOutputTypes()->size()) {
                 String error_message = fmt::format("input_data_block column count {} is incorrect, expect {}.",
@@ -180,115 +199,104 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
             SizeT row_n = input_data_block->row_count();
             auto &row_score_column = *input_data_block->column_vectors[input_data_block->column_count() - 2];
             auto row_scores = reinterpret_cast<float *>(row_score_column.data());
+            // 1.1 score of this child for the whole block
+            child_scores.resize(row_n);
+            if (fusion_method_ == FusionMethod::kRRF) {
+                for (SizeT i = 0; i < row_n; ++i) {
+                    child_scores[i] = 1.0F / (rank_constant + base_rank + i);
+                }
+            } else {
+                assert(fusion_method_ == FusionMethod::kWeightedSum);
+                // Normalize the child score in R to [0, 1]
+                const double weight = weights[fragment_idx];
+                if (min_heaps[fragment_idx]) {
+                    for (SizeT i = 0; i < row_n; ++i) {
+                        child_scores[i] = weight * (std::atan(row_scores[i]) / M_PI + 0.5);
+                    }
+                } else {
+                    for (SizeT i = 0; i < row_n; ++i) {
+                        child_scores[i] = weight * (1.0 - (std::atan(row_scores[i]) / M_PI + 0.5));
+                    }
+                }
+            }
+            // 1.2 add the scores to the docs
             for (SizeT i = 0; i < row_n; i++) {
-                RowID docId = row_ids[i];
-                if (rescore_map.find(docId) == rescore_map.end()) {
-                    DocScore doc;
-                    doc.row_id_ = docId;
-                    doc.from_input_data_block_id_ = fragment_id;
-                    doc.from_block_idx_ = from_block_idx;
-                    doc.from_row_idx_ = i;
-                    doc.child_scores_.resize(num_children, 0.0f);
-                    doc.mask_.resize(num_children, false);
-                    rescore_vec.push_back(doc);
-                    rescore_map[docId] = rescore_vec.size() - 1;
+                const u64 doc_key = row_ids[i].ToUint64();
+                u32 doc_idx = 0;
+                if (min_score.has_value() && child_scores[i] + remaining_max_scores[fragment_idx + 1] < *min_score) {
+                    // a doc first seen here can't reach min_score, only update the docs seen in previous children
+                    auto it = rescore_map.find(doc_key);
+                    if (it == rescore_map.end()) {
+                        continue;
+                    }
+                    doc_idx = it->second;
+                } else {
+                    auto [it, inserted] = rescore_map.try_emplace(doc_key, static_cast<u32>(rescore_vec.size()));
+                    if (inserted) {
+                        rescore_vec.push_back(DocScore{row_ids[i], 0.0f, num_children});
+                    }
+                    doc_idx = it->second;
                 }
-                SizeT doc_idx = rescore_map[docId];
                 DocScore &doc = rescore_vec[doc_idx];
-                assert(fragment_idx < num_children);
-                doc.mask_[fragment_idx] = true;
-                if (fusion_method_ == FusionMethod::kRRF) {
-                    doc.child_scores_[fragment_idx] = base_rank + i;
-                } else {
-                    assert(fusion_method_ == FusionMethod::kWeightedSum);
-                    doc.child_scores_[fragment_idx] = row_scores[i];
+                if (doc.last_child_idx_ == fragment_idx) {
+                    // duplicated row in one child, keep the first one
+                    continue;
                 }
+                doc.last_child_idx_ = fragment_idx;
+                doc.fusion_score_ += child_scores[i];
             }
             base_rank += row_n;
-            from_block_idx++;
         }
         fragment_idx++;
     }
 
-    // 2 calculate every doc's fusion_score
-    if (fusion_method_ == FusionMethod::kRRF) {
-        for (auto &doc : rescore_vec) {
-            doc.fusion_score_ = 0.0f;
-            for (auto &rank : doc.child_scores_) {
-                if (rank < 1.0F)
-                    continue;
-                doc.fusion_score_ += 1.0F / (rank_constant + rank);
-            }
-        }
-    } else {
-        Vector<bool> min_heaps(num_children, false);
-        for (SizeT i = 0; i < num_children; i++) {
-            PhysicalOperator *child_op = nullptr;
-            if (i == 0)
-                child_op = left();
-            else if (i == 1)
-                child_op = right();
-            else
-                child_op = other_children_[i - 2].get();
-            auto child_type = child_op->operator_type();
-            switch (child_type) {
-                case PhysicalOperatorType::kKnnScan: {
-                    PhysicalKnnScan *phy_knn_scan = static_cast<PhysicalKnnScan *>(child_op);
-                    min_heaps[i] = phy_knn_scan->IsKnnMinHeap();
-                    break;
-                }
-                case PhysicalOperatorType::kMergeKnn: {
-                    PhysicalMergeKnn *phy_merge_knn = static_cast<PhysicalMergeKnn *>(child_op);
-                    min_heaps[i] = phy_merge_knn->IsKnnMinHeap();
-                    break;
-                }
-                case PhysicalOperatorType::kMatchTensorScan:
-                case PhysicalOperatorType::kMergeMatchTensor:
-                case PhysicalOperatorType::kMatchSparseScan:
-                case PhysicalOperatorType::kMergeMatchSparse:
-                case PhysicalOperatorType::kMatch: {
-                    min_heaps[i] = true;
-                    break;
-                }
-                case PhysicalOperatorType::kReadCache: {
-                    PhysicalReadCache *phy_read_cache = static_cast<PhysicalReadCache *>(child_op);
-                    min_heaps[i] = phy_read_cache->is_min_heap();
-                    break;
-                }
-                default: {
-                    String error_message = fmt::format("Cannot determine heap type of operator {}", int(child_op->operator_type()));
-                    UnrecoverableError(error_message);
-                }
-            }
+    // 2 select the topn docs with a bounded heap, docs with the same fusion_score keep their input order
+    const auto better_doc = [&rescore_vec](const u32 lhs, const u32 rhs) {
+        const float lhs_score = rescore_vec[lhs].fusion_score_;
+        const float rhs_score = rescore_vec[rhs].fusion_score_;
+        return lhs_score > rhs_score || (lhs_score == rhs_score && lhs < rhs);
+    };
+    Vector<u32> top_docs;
+    top_docs.reserve(std::min(topn, rescore_vec.size()));
+    for (u32 doc_idx = 0; doc_idx < rescore_vec.size(); ++doc_idx) {
+        if (min_score.has_value() && rescore_vec[doc_idx].fusion_score_ < *min_score) {
+            continue;
         }
-        for (auto &doc : rescore_vec) {
-            doc.fusion_score_ = 0.0f;
-            for (SizeT i = 0; i < num_children; ++i) {
-                if (!doc.mask_[i])
-                    continue;
-                // Normalize the child score in R to [0, 1]
-                double normalized_score = std::atan(doc.child_scores_[i]) / M_PI + 0.5;
-                if (!min_heaps[i])
-                    normalized_score = 1.0 - normalized_score;
-                doc.fusion_score_ += weights[i] * normalized_score;
-            }
+        if (top_docs.size() < topn) {
+            top_docs.push_back(doc_idx);
+            std::push_heap(top_docs.begin(), top_docs.end(), better_doc);
+        } else if (better_doc(doc_idx, top_docs.front())) {
+            // heap top is the worst doc
+            std::pop_heap(top_docs.begin(), top_docs.end(), better_doc);
+            top_docs.back() = doc_idx;
+            std::push_heap(top_docs.begin(), top_docs.end(), better_doc);
         }
     }
+    std::sort_heap(top_docs.begin(), top_docs.end(), better_doc);
 
-    // 3 sort docs in reverse per their fusion_score
-    std::stable_sort(std::begin(rescore_vec), std::end(rescore_vec), [](const DocScore &lhs, const DocScore &rhs) noexcept {
-        return lhs.fusion_score_ > rhs.fusion_score_;
-    });
-    if (rescore_vec.size() > topn) {
-        rescore_vec.resize(topn);
+    // 3 generate output data blocks
+    Vector<Pair<RowID, float>> results;
+    results.reserve(top_docs.size());
+    for (const u32 doc_idx : top_docs) {
+        const DocScore &doc = rescore_vec[doc_idx];
+        results.emplace_back(doc.row_id_, doc.fusion_score_);
     }
+    OutputResult(query_context, results, output_data_block_array);
+}
 
-    // 4 generate output data blocks
+void PhysicalFusion::OutputResult(QueryContext *query_context,
+                                  const Vector<Pair<RowID, float>> &results,
+                                  Vector<UniquePtr<DataBlock>> &output_data_block_array) const {
+    const Vector<SizeT> &column_ids = base_table_ref_->column_ids_;
+    const SizeT column_n = GetOutputTypes()->size() - 2;
+    if (column_ids.size() != column_n) {
+        UnrecoverableError(fmt::format("Fusion output column count {} is incorrect, expect {}.", column_n, column_ids.size()));
+    }
+    OutputToDataBlockHelper output_to_data_block_helper;
     UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
     output_data_block->Init(*GetOutputTypes());
-    SizeT row_count = 0;
-    for (DocScore &doc : rescore_vec) {
-        // 4.1 get every doc's columns from input data blocks
+    u32 row_count = 0;
+    for (const auto &[row_id, score] : results) {
         if (row_count == output_data_block->capacity()) {
             output_data_block->Finalize();
             output_data_block_array.push_back(std::move(output_data_block));
@@ -296,19 +304,72 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
             output_data_block->Init(*GetOutputTypes());
             row_count = 0;
         }
-        const auto &input_blocks = input_data_blocks.at(doc.from_input_data_block_id_);
-        SizeT column_n = GetOutputTypes()->size() - 2;
+        // the table columns are fetched block by block after all rows are added
+        const u32 output_block_idx = output_data_block_array.size();
+        const BlockID block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        const BlockOffset block_offset = row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
         for (SizeT i = 0; i < column_n; ++i) {
-            output_data_block->column_vectors[i]->AppendWith(*input_blocks[doc.from_block_idx_]->column_vectors[i], doc.from_row_idx_, 1);
+            if (!late_materialize_) {
+                output_to_data_block_helper.AddOutputJobInfo(row_id.segment_id_, block_id, column_ids[i], block_offset, output_block_idx, i, row_count);
+            }
+            output_data_block->column_vectors[i]->Finalize(output_data_block->column_vectors[i]->Size() + 1);
         }
-        // 4.2 add hidden columns: score, row_id
-        Value v = Value::MakeFloat(doc.fusion_score_);
+        // hidden columns: score, row_id
+        Value v = Value::MakeFloat(score);
         output_data_block->column_vectors[column_n]->AppendValue(v);
-        output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id_, 1);
+        output_data_block->column_vectors[column_n + 1]->AppendWith(row_id, 1);
         row_count++;
     }
     output_data_block->Finalize();
     output_data_block_array.push_back(std::move(output_data_block));
+    output_to_data_block_helper.OutputToDataBlock(query_context->storage()->buffer_manager(),
+                                                  base_table_ref_->block_index_.get(),
+                                                  output_data_block_array);
+}
+
+Vector<bool> PhysicalFusion::GetChildrenMinHeap() const {
+    SizeT num_children = 2 + other_children_.size();
+    Vector<bool> min_heaps(num_children, false);
+    for (SizeT i = 0; i < num_children; i++) {
+        PhysicalOperator *child_op = nullptr;
+        if (i == 0)
+            child_op = left();
+        else if (i == 1)
+            child_op = right();
+        else
+            child_op = other_children_[i - 2].get();
+        auto child_type = child_op->operator_type();
+        switch (child_type) {
+            case PhysicalOperatorType::kKnnScan: {
+                PhysicalKnnScan *phy_knn_scan = static_cast<PhysicalKnnScan *>(child_op);
+                min_heaps[i] = phy_knn_scan->IsKnnMinHeap();
+                break;
+            }
+            case PhysicalOperatorType::kMergeKnn: {
+                PhysicalMergeKnn *phy_merge_knn = static_cast<PhysicalMergeKnn *>(child_op);
+                min_heaps[i] = phy_merge_knn->IsKnnMinHeap();
+                break;
+            }
+            case PhysicalOperatorType::kMatchTensorScan:
+            case PhysicalOperatorType::kMergeMatchTensor:
+            case PhysicalOperatorType::kMatchSparseScan:
+            case PhysicalOperatorType::kMergeMatchSparse:
+            case PhysicalOperatorType::kMatch: {
+                min_heaps[i] = true;
+                break;
+            }
+            case PhysicalOperatorType::kReadCache: {
+                PhysicalReadCache *phy_read_cache = static_cast<PhysicalReadCache *>(child_op);
+                min_heaps[i] = phy_read_cache->is_min_heap();
+                break;
+            }
+            default: {
+                String error_message = fmt::format("Cannot determine heap type of operator {}", int(child_op->operator_type()));
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+    return min_heaps;
 }
 
 void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
@@ -341,17 +402,29 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
         const auto error_info = "Fusion MatchTensor match_method option is invalid.";
         RecoverableError(Status::NotSupport(error_info));
     }
-    // prepare topn
-    u32 topn = DEFAULT_MATCH_TENSOR_OPTION_TOP_N;
-    // find topn
+    // prepare topn and rerank options
+    MatchTensorRerankOptions rerank_options;
     if (fusion_expr_->options_.get() != nullptr) {
         const auto &options = fusion_expr_->options_->options_;
         if (auto topn_it = options.find("topn"); topn_it != options.end()) {
             if (const int topn_int = std::stoi(topn_it->second); topn_int > 0) {
-                topn = topn_int;
+                rerank_options.topn_ = topn_int;
+            }
+        }
+        if (auto ratio_it = options.find("rerank_keep_ratio"); ratio_it != options.end()) {
+            const float keep_ratio = std::stof(ratio_it->second);
+            if (keep_ratio <= 0.0f || keep_ratio > 1.0f) {
+                RecoverableError(Status::InvalidParameterValue("rerank_keep_ratio", ratio_it->second, "value in (0, 1]"));
+            }
+            rerank_options.keep_ratio_ = keep_ratio;
+        }
+        if (auto threads_it = options.find("rerank_threads"); threads_it != options.end()) {
+            if (const int thread_num = std::stoi(threads_it->second); thread_num > 0) {
+                rerank_options.thread_num_ = thread_num;
             }
         }
     }
+    const u32 topn = rerank_options.topn_;
     BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
     Vector<MatchTensorRerankDoc> rerank_docs;
     // 1. prepare query target rows
@@ -382,8 +455,14 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
     std::sort(rerank_docs.begin(), rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
         return lhs.row_id_ < rhs.row_id_;
     });
-    // 3. calculate score
-    CalculateFusionMatchTensorRerankerScores(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *fusion_expr_->match_tensor_expr_);
+    // 3. calculate score, candidates may be pruned by the binary first stage
+    CalculateFusionMatchTensorRerankerScores(rerank_docs,
+                                             buffer_mgr,
+                                             column_data_type,
+                                             column_id,
+                                             block_index,
+                                             *fusion_expr_->match_tensor_expr_,
+                                             rerank_options);
     // 4. sort by score
     std::sort(rerank_docs.begin(), rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
         return lhs.score_ > rhs.score_;
@@ -392,32 +471,12 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
         rerank_docs.erase(rerank_docs.begin() + topn, rerank_docs.end());
     }
     // 5. generate output data blocks
-    UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
-    output_data_block->Init(*GetOutputTypes());
-    u32 row_count = 0;
-    for (MatchTensorRerankDoc &doc : rerank_docs) {
-        if (row_count == output_data_block->capacity()) {
-            output_data_block->Finalize();
-            output_data_block_array.push_back(std::move(output_data_block));
-            output_data_block = DataBlock::MakeUniquePtr();
-            output_data_block->Init(*GetOutputTypes());
-            row_count = 0;
-        }
-        const auto &input_blocks = input_data_blocks.at(doc.from_input_data_block_id_);
-        const u32 block_idx = doc.from_block_idx_;
-        const u32 row_idx = doc.from_row_idx_;
-        const ColumnID column_n = GetOutputTypes()->size() - 2;
-        for (ColumnID i = 0; i < column_n; ++i) {
-            output_data_block->column_vectors[i]->AppendWith(*input_blocks[block_idx]->column_vectors[i], row_idx, 1);
-        }
-        // 4.2 add hidden columns: score, row_id
-        Value v = Value::MakeFloat(doc.score_);
-        output_data_block->column_vectors[column_n]->AppendValue(v);
-        output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id_, 1);
-        row_count++;
+    Vector<Pair<RowID, float>> results;
+    results.reserve(rerank_docs.size());
+    for (const MatchTensorRerankDoc &doc : rerank_docs) {
+        results.emplace_back(doc.row_id_, doc.score_);
     }
-    output_data_block->Finalize();
-    output_data_block_array.push_back(std::move(output_data_block));
+    OutputResult(query_context, results, output_data_block_array);
 }
 
 bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -433,7 +492,7 @@ bool PhysicalFusion::ExecuteFirstOp(QueryContext *query_context, FusionOperatorS
         return false;
     }
     if (fusion_method_ == FusionMethod::kRRF || fusion_method_ == FusionMethod::kWeightedSum) {
-        ExecuteRRFWeighted(fusion_operator_state->input_data_blocks_, fusion_operator_state->data_block_array_);
+        ExecuteRRFWeighted(query_context, fusion_operator_state->input_data_blocks_, fusion_operator_state->data_block_array_);
         fusion_operator_state->input_data_blocks_.clear();
         fusion_operator_state->SetComplete();
         return true;
@@ -29,6 +29,7 @@ import infinity_exception;
 import internal_types;
 import data_type;
 import logger;
+import default_values;
 
 namespace infinity {
 struct DataBlock;
@@ -70,12 +71,20 @@ private:
     bool ExecuteFirstOp(QueryContext *query_context, FusionOperatorState *fusion_operator_state) const;
     bool ExecuteNotFirstOp(QueryContext *query_context, OperatorState *operator_state) const;
     // RRF and WeightedSum have multiple input sources, must be first fusion op
-    void ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
+    void ExecuteRRFWeighted(QueryContext *query_context,
+                            const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
                             Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
+    // whether a higher score of each child means a better result
+    Vector<bool> GetChildrenMinHeap() const;
     // MatchTensor may have multiple or single input source, can be first or not first fusion op
     void ExecuteMatchTensor(QueryContext *query_context,
                             const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
                             Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
+    // The children only output score and row_id, see SetLateMaterialize. The table columns of the result rows are
+    // fetched here, batched by block, unless this operator is late materialized too.
+    void OutputResult(QueryContext *query_context,
+                      const Vector<Pair<RowID, float>> &results,
+                      Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
 
     FusionMethod fusion_method_;
     SharedPtr<Vector<String>> output_names_;
@@ -92,4 +101,12 @@ export struct MatchTensorRerankDoc {
         : row_id_(row_id), from_input_data_block_id_(from_input_data_block_id), from_block_idx_(from_block_idx), from_row_idx_(from_row_idx) {}
 };
 
+export struct MatchTensorRerankOptions {
+    u32 topn_ = DEFAULT_MATCH_TENSOR_OPTION_TOP_N;
+    // fraction of candidates kept by the binary MaxSim first stage, only survivors get the full precision MaxSim
+    f32 keep_ratio_ = DEFAULT_MATCH_TENSOR_RERANK_KEEP_RATIO;
+    // candidates are split into RowID ranges scored by separate threads
+    u32 thread_num_ = DEFAULT_MATCH_TENSOR_RERANK_THREAD_NUM;
+};
+
 } // namespace infinity
@@ -278,7 +278,11 @@ bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *ope
     };
     append_data_block();
     // 4.2 output
+    ResultCacheManager *cache_mgr = query_context->storage()->result_cache_manager();
+    const bool add_cache = cache_result_ && cache_mgr != nullptr;
     {
+        // a cached result is read by other queries, so it is always complete
+        const bool fill_columns = !late_materialize_ || add_cache;
         OutputToDataBlockHelper output_to_data_block_helper;
         u32 output_block_idx = output_data_blocks.size() - 1;
         Vector<SizeT> &column_ids = base_table_ref_->column_ids_;
@@ -302,8 +306,10 @@ bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *ope
             u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
             SizeT column_id = 0;
             for (; column_id < column_n; ++column_id) {
-                output_to_data_block_helper
-                    .AddOutputJobInfo(segment_id, block_id, column_ids[column_id], block_offset, output_block_idx, column_id, output_block_row_id);
+                if (fill_columns) {
+                    output_to_data_block_helper
+                        .AddOutputJobInfo(segment_id, block_id, column_ids[column_id], block_offset, output_block_idx, column_id, output_block_row_id);
+                }
                 output_block_ptr->column_vectors[column_id]->Finalize(output_block_ptr->column_vectors[column_id]->Size() + 1);
             }
             Value v = Value::MakeFloat(score_result[output_id]);
@@ -317,8 +323,7 @@ bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *ope
                                                       output_data_blocks);
     }
     operator_state->SetComplete();
-    ResultCacheManager *cache_mgr = query_context->storage()->result_cache_manager();
-    if (cache_result_ && cache_mgr != nullptr) {
+    if (add_cache) {
         AddCache(query_context, cache_mgr, output_data_blocks);
     }
     LOG_DEBUG(fmt::format("PhysicalMatch Part 4: Output data time: {} ms",
@@ -32,6 +32,7 @@ import infinity_exception;
 import hash_table;
 import column_def;
 import column_vector;
+import approx_sketch;
 
 namespace infinity {
 
@@ -143,6 +144,10 @@ void PhysicalMergeAggregate::GroupByMergeAggregateExecute(MergeAggregateOperator
                     HandleAggregateFunction<DoubleT>(function_name, op_state, col_idx, input_block_row_id, block_row_id);
                     break;
                 }
+                case LogicalType::kEmbedding: {
+                    HandleSketchFunction(function_name, op_state, col_idx, input_block_row_id, block_row_id);
+                    break;
+                }
                 default: {
                     String error_message = "Input value type not Implement";
                     UnrecoverableError(error_message);
@@ -192,6 +197,10 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
                     HandleAggregateFunction<DoubleT>(function_name, op_state, col_idx);
                     break;
                 }
+                case LogicalType::kEmbedding: {
+                    HandleSketchFunction(function_name, op_state, col_idx);
+                    break;
+                }
                 default: {
                     String error_message = "Input value type not Implement";
                     UnrecoverableError(error_message);
@@ -225,6 +234,28 @@ void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name
     }
 }
 
+void PhysicalMergeAggregate::HandleSketchFunction(const String &function_name,
+                                                  MergeAggregateOperatorState *op_state,
+                                                  SizeT col_idx,
+                                                  const Pair<SizeT, SizeT> &input_block_row_id,
+                                                  const Pair<SizeT, SizeT> &output_block_row_id) {
+    SizeT input_row_id = input_block_row_id.second;
+    const auto &[output_block_id, output_row_id] = output_block_row_id;
+    const ColumnVector &input_column = *op_state->input_data_block_->column_vectors[col_idx];
+    const ColumnVector &output_column = *op_state->data_block_array_[output_block_id]->column_vectors[col_idx];
+    SizeT sketch_size = output_column.data_type()->Size();
+    const_ptr_t input_ptr = input_column.data() + input_row_id * sketch_size;
+    ptr_t output_ptr = output_column.data() + output_row_id * sketch_size;
+    if (function_name == "HLL_SKETCH") {
+        HyperLogLogSketch::Merge(reinterpret_cast<u8 *>(output_ptr), reinterpret_cast<const u8 *>(input_ptr));
+    } else if (function_name == "TDIGEST_SKETCH") {
+        TDigestSketch::Merge(reinterpret_cast<double *>(output_ptr), reinterpret_cast<const double *>(input_ptr));
+    } else {
+        String error_message = fmt::format("Function type {} not Implement.", function_name);
+        UnrecoverableError(error_message);
+    }
+}
+
 template <typename T>
 void PhysicalMergeAggregate::HandleMin(MergeAggregateOperatorState *op_state,
                                        SizeT col_idx,
@@ -109,6 +109,13 @@ public:
                                  const Pair<SizeT, SizeT> &input_block_row_id = {0, 0},
                                  const Pair<SizeT, SizeT> &output_block_row_id = {0, 0});
 
+    // Merge the sketch of an approximate aggregate in place.
+    void HandleSketchFunction(const String &function_name,
+                              MergeAggregateOperatorState *op_state,
+                              SizeT col_idx,
+                              const Pair<SizeT, SizeT> &input_block_row_id = {0, 0},
+                              const Pair<SizeT, SizeT> &output_block_row_id = {0, 0});
+
     template <typename T>
     Value CreateValue(T value) {
         String error_message = "Unhandled type for makeValue";
@@ -29,6 +29,7 @@ import column_vector;
 import infinity_exception;
 import analyzer_pool;
 import value;
+import fused_expression;
 
 module physical_project;
 
@@ -92,17 +93,17 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
 
             SizeT expression_count = expressions_.size();
 
-            // Prepare the expression states
-            Vector<SharedPtr<ExpressionState>> expr_states;
-            expr_states.reserve(expression_count);
-
-            for (const auto &expr : expressions_) {
-                // expression state
-                expr_states.emplace_back(ExpressionState::CreateState(expr));
-            }
-
             for (SizeT expr_idx = 0; expr_idx < expression_count; ++expr_idx) {
-                evaluator.Execute(expressions_[expr_idx], expr_states[expr_idx], output_data_block->column_vectors[expr_idx]);
+                const SharedPtr<FusedExpression> &fused_expression = fused_expressions_[expr_idx];
+                bool fused = false;
+                if (fused_expression.get() != nullptr) {
+                    Vector<SharedPtr<ExpressionState>> leaf_states = fused_expression->CreateLeafStates();
+                    fused = fused_expression->Execute(evaluator, leaf_states, output_data_block->column_vectors[expr_idx]);
+                }
+                if (!fused) {
+                    SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expressions_[expr_idx]);
+                    evaluator.Execute(expressions_[expr_idx], expr_state, output_data_block->column_vectors[expr_idx]);
+                }
 
                 auto it = highlight_columns_.find(expr_idx);
                 if (it != highlight_columns_.end()) {
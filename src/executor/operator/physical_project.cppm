@@ -28,6 +28,7 @@ import infinity_exception;
 import internal_types;
 import data_type;
 import highlighter;
+import fused_expression;
 
 namespace infinity {
 
@@ -40,7 +41,12 @@ public:
                              SharedPtr<Vector<LoadMeta>> load_metas,
                              Map<SizeT, SharedPtr<HighlightInfo>> highlight_columns)
         : PhysicalOperator(PhysicalOperatorType::kProjection, std::move(left), nullptr, id, load_metas), expressions_(std::move(expressions)),
-          projection_table_index_(table_index), highlight_columns_(std::move(highlight_columns)) {}
+          projection_table_index_(table_index), highlight_columns_(std::move(highlight_columns)) {
+        fused_expressions_.reserve(expressions_.size());
+        for (const auto &expr : expressions_) {
+            fused_expressions_.emplace_back(FusedExpression::Compile(expr));
+        }
+    }
 
     ~PhysicalProject() override = default;
 
@@ -54,6 +60,8 @@ public:
 
     SizeT TaskletCount() override { return left_->TaskletCount(); }
 
+    bool AcceptSelectedInput() const override { return true; }
+
     Vector<SharedPtr<BaseExpression>> expressions_{};
 
     inline u64 TableIndex() const { return projection_table_index_; }
@@ -62,6 +70,8 @@ private:
     //    ExpressionExecutor executor;
     u64 projection_table_index_{};
     Map<SizeT, SharedPtr<HighlightInfo>> highlight_columns_{};
+    // compiled arithmetic of expressions_, nullptr for an expression evaluated by ExpressionEvaluator
+    Vector<SharedPtr<FusedExpression>> fused_expressions_{};
 };
 
 } // namespace infinity
@@ -81,6 +81,9 @@ import index_base;
 import new_catalog;
 import mem_index;
 import chunk_index_meta;
+import hnsw_filter_cost;
+import storage;
+import obj_prefetcher;
 
 namespace infinity {
 
@@ -500,6 +503,26 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
     index_entries_size_ = segment_index_metas_->size();
     LOG_TRACE(fmt::format("KnnScan: brute force task: {}, index task: {}", block_column_entries_size_, index_entries_size_));
 
+    // Each task fetches its files from object storage on demand, fetch the files of all tasks concurrently ahead of them
+    if (ObjPrefetcher *obj_prefetcher = query_context->storage()->obj_prefetcher(); obj_prefetcher != nullptr) {
+        Vector<String> file_paths;
+        for (SegmentIndexMeta &segment_index_meta : *segment_index_metas_) {
+            auto [chunk_ids_ptr, chunk_status] = segment_index_meta.GetChunkIDs1();
+            if (!chunk_status.ok()) {
+                continue;
+            }
+            for (ChunkID chunk_id : *chunk_ids_ptr) {
+                ChunkIndexMeta chunk_index_meta(chunk_id, segment_index_meta);
+                chunk_index_meta.FilePaths(file_paths);
+            }
+        }
+        for (BlockMeta *block_meta : *block_metas_) {
+            ColumnMeta column_meta(knn_column_id, *block_meta);
+            column_meta.FilePaths(file_paths);
+        }
+        obj_prefetcher->Prefetch(file_paths);
+    }
+
     return;
 }
 
@@ -561,6 +584,44 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
     SizeT knn_column_id = GetColumnID();
 
     UniquePtr<QueryDataType[]> buffer_ptr_for_cast;
+    // rows of the block before begin_offset are skipped, they are already searched through an index
+    auto brute_force_block = [&](BlockMeta *block_meta, BlockOffset begin_offset) {
+        ColumnMeta column_meta(knn_column_id, *block_meta);
+        BlockID block_id = block_meta->block_id();
+        SegmentID segment_id = block_meta->segment_meta().segment_id();
+        auto [row_count, status] = block_meta->GetRowCnt1();
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        if (begin_offset >= row_count) {
+            return;
+        }
+        Bitmask bitmask;
+        if (this->CalculateFilterBitmask(segment_id, block_id, row_count, bitmask)) {
+            status = NewCatalog::SetBlockDeleteBitmask(*block_meta, begin_ts, commit_ts, bitmask);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            if (begin_offset > 0) {
+                bitmask.SetFalseRange(0, begin_offset);
+            }
+            ColumnVector column_vector;
+            status = NewCatalog::GetColumnVector(column_meta, row_count, ColumnVectorTipe::kReadOnly, column_vector);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            BruteForceBlockScan<t, ColumnDataType, QueryDataType, C, DistanceDataType>::Execute(merge_heap,
+                                                                                                dist_func,
+                                                                                                knn_query_ptr,
+                                                                                                embedding_dim,
+                                                                                                buffer_ptr_for_cast,
+                                                                                                column_vector,
+                                                                                                segment_id,
+                                                                                                block_id,
+                                                                                                row_count,
+                                                                                                bitmask);
+        }
+    };
     if (u64 block_column_idx =
             knn_scan_function_data->execute_block_scan_job_ ? knn_scan_shared_data->current_block_idx_++ : std::numeric_limits<u64>::max();
         block_column_idx < brute_task_n) {
@@ -568,36 +629,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
         // brute force
         // TODO: now will try to finish all block scan job in the task
         do {
-            BlockMeta *block_meta = knn_scan_shared_data->block_metas_->at(block_column_idx);
-            ColumnMeta column_meta(knn_column_id, *block_meta);
-            BlockID block_id = block_meta->block_id();
-            SegmentID segment_id = block_meta->segment_meta().segment_id();
-            auto [row_count, status] = block_meta->GetRowCnt1();
-            if (!status.ok()) {
-                UnrecoverableError(status.message());
-            }
-            Bitmask bitmask;
-            if (this->CalculateFilterBitmask(segment_id, block_id, row_count, bitmask)) {
-                status = NewCatalog::SetBlockDeleteBitmask(*block_meta, begin_ts, commit_ts, bitmask);
-                if (!status.ok()) {
-                    UnrecoverableError(status.message());
-                }
-                ColumnVector column_vector;
-                status = NewCatalog::GetColumnVector(column_meta, row_count, ColumnVectorTipe::kReadOnly, column_vector);
-                if (!status.ok()) {
-                    UnrecoverableError(status.message());
-                }
-                BruteForceBlockScan<t, ColumnDataType, QueryDataType, C, DistanceDataType>::Execute(merge_heap,
-                                                                                                    dist_func,
-                                                                                                    knn_query_ptr,
-                                                                                                    embedding_dim,
-                                                                                                    buffer_ptr_for_cast,
-                                                                                                    column_vector,
-                                                                                                    segment_id,
-                                                                                                    block_id,
-                                                                                                    row_count,
-                                                                                                    bitmask);
-            }
+            brute_force_block(knn_scan_shared_data->block_metas_->at(block_column_idx), 0);
             block_column_idx = knn_scan_shared_data->current_block_idx_++;
         } while (block_column_idx < brute_task_n);
     } else if (u64 index_idx = knn_scan_shared_data->current_index_idx_++; index_idx < index_task_n) {
@@ -685,6 +717,29 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                     break;
                 }
                 case IndexType::kHnsw: {
+                    if (use_bitmask) {
+                        SizeT ef = 0;
+                        for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                            if (opt_param.param_name_ == "ef") {
+                                ef = std::stoull(opt_param.param_value_);
+                            }
+                        }
+                        const auto *index_hnsw = static_cast<const IndexHnsw *>(index_base);
+                        SizeT filter_row_count = bitmask.CountTrue();
+                        if (HnswFilterCost::PreferScan(segment_row_count, filter_row_count, knn_scan_shared_data->topk_, ef, index_hnsw->M_)) {
+                            // a selective filter makes the graph search visit most of the segment, scan the rows passing it instead
+                            LOG_TRACE(fmt::format("KnnScan: {} index {}/{} scans {} of {} rows",
+                                                  knn_scan_function_data->task_id_,
+                                                  index_idx + 1,
+                                                  index_task_n,
+                                                  filter_row_count,
+                                                  segment_row_count));
+                            for (const auto &block_meta : segment_index_hashmap.at(segment_id).block_map_) {
+                                brute_force_block(block_meta.get(), 0);
+                            }
+                            break;
+                        }
+                    }
                     if constexpr (!(IsAnyOf<ColumnDataType, u8, i8, f32> && std::is_same_v<ColumnDataType, QueryDataType>)) {
                         UnrecoverableError("Invalid data type");
                     } else {
@@ -872,9 +927,19 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 abstract_hnsw);
                         };
 #endif
+                        // rows past the end of the chunks and the mem index are not indexed yet, e.g. on a follower replicating the
+                        // leader's index chunks instead of building them, and are scanned by brute force
+                        SegmentOffset index_end = 0;
                         auto [chunk_ids_ptr, mem_index] = get_chunks();
                         for (ChunkID chunk_id : *chunk_ids_ptr) {
                             ChunkIndexMeta chunk_index_meta(chunk_id, *segment_index_meta);
+                            ChunkIndexMetaInfo *chunk_info = nullptr;
+                            status = chunk_index_meta.GetChunkInfo(chunk_info);
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            index_end =
+                                std::max(index_end, static_cast<SegmentOffset>(chunk_info->base_row_id_.segment_offset_ + chunk_info->row_cnt_));
                             BufferObj *index_buffer = nullptr;
                             status = chunk_index_meta.GetIndexBuffer(index_buffer);
                             if (!status.ok()) {
@@ -889,14 +954,38 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                             abstract_hnsw_search(*abstract_hnsw, false);
 #endif
                         }
-                        if (mem_index && mem_index->memory_hnsw_index_) {
+                        if (mem_index) {
+                            // The mem index being dumped covers the rows before the active one until the dump is committed.
+                            for (const SharedPtr<HnswIndexInMem> &memory_hnsw_index : {mem_index->GetDumpingHnswIndex(), mem_index->GetHnswIndex()}) {
+                                if (!memory_hnsw_index) {
+                                    continue;
+                                }
+                                index_end = std::max(index_end,
+                                                     static_cast<SegmentOffset>(memory_hnsw_index->GetBeginRowID().segment_offset_ +
+                                                                                memory_hnsw_index->GetRowCount()));
 #ifdef INDEX_HANDLER
-                            const HnswHandlerPtr hnsw_handler = mem_index->memory_hnsw_index_->get();
-                            hnsw_search(hnsw_handler, true);
+                                const HnswHandlerPtr hnsw_handler = memory_hnsw_index->get();
+                                hnsw_search(hnsw_handler, true);
 #else
-                            const AbstractHnsw &abstract_hnsw = mem_index->memory_hnsw_index_->get();
-                            abstract_hnsw_search(abstract_hnsw, true);
+                                const AbstractHnsw &abstract_hnsw = memory_hnsw_index->get();
+                                abstract_hnsw_search(abstract_hnsw, true);
 #endif
+                            }
+                        }
+                        if (index_end < segment_row_count) {
+                            LOG_TRACE(fmt::format("KnnScan: {} index {}/{} scans {} rows not indexed",
+                                                  knn_scan_function_data->task_id_,
+                                                  index_idx + 1,
+                                                  index_task_n,
+                                                  segment_row_count - index_end));
+                            const BlockID begin_block_id = index_end / DEFAULT_BLOCK_CAPACITY;
+                            for (const auto &block_meta : segment_index_hashmap.at(segment_id).block_map_) {
+                                const BlockID block_id = block_meta->block_id();
+                                if (block_id >= begin_block_id) {
+                                    const SegmentOffset block_begin = static_cast<SegmentOffset>(block_id) * DEFAULT_BLOCK_CAPACITY;
+                                    brute_force_block(block_meta.get(), block_begin >= index_end ? 0 : index_end - block_begin);
+                                }
+                            }
                         }
                     }
                     break;
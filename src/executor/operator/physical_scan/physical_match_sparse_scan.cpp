@@ -80,6 +80,7 @@ import new_catalog;
 import index_base;
 import column_meta;
 import mem_index;
+import infinity_context;
 
 namespace infinity {
 
@@ -547,6 +548,7 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
             auto query = get_ele(query_vector, query_id);
             BmpSearchOptions options = BMPUtil::ParseBmpSearchOptions(match_sparse_expr_->opt_params_);
             options.use_lock_ = with_lock;
+            options.thread_pool_ = &InfinityContext::instance().GetQueryThreadPool();
             bmp_handler->template SearchIndex<ResultType, DistFunc>(query, topn, options, filter, query_id, segment_id, merge_heap);
         };
 #else
@@ -563,6 +565,7 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
                                       std::is_same_v<typename IndexT::IdxT, typename DistFunc::IndexT>) {
                             BmpSearchOptions options = BMPUtil::ParseBmpSearchOptions(match_sparse_expr_->opt_params_);
                             options.use_lock_ = with_lock;
+                            options.thread_pool_ = &InfinityContext::instance().GetQueryThreadPool();
                             auto [doc_ids, scores] = index->SearchKnn(query, topn, options, filter);
                             SizeT res_n = doc_ids.size();
                             for (SizeT i = 0; i < res_n; ++i) {
@@ -15,6 +15,7 @@
 module;
 
 #include <bit>
+#include <cmath>
 #include <cstdlib>
 #include <memory>
 #include <string>
@@ -89,6 +90,8 @@ import new_catalog;
 import index_base;
 import column_meta;
 import mem_index;
+import infinity_context;
+import parallel_for;
 
 namespace infinity {
 
@@ -969,54 +972,91 @@ void CalculateScoreOnColumnVector(ColumnVector &column_vector,
     ElemTypeDispatch<ExecuteMatchTensorScanTypes, TypeList<>>(parameter_pack, column_elem_type, query_elem_type);
 }
 
+// Rerank docs are sorted by RowID, so consecutive docs mostly fall into the same block.
+// Keep the column vector of the last visited block instead of fetching it again for every doc.
+class RerankColumnLoader {
+public:
+    RerankColumnLoader(BufferManager *buffer_mgr, const ColumnID column_id, const BlockIndex *block_index)
+        : buffer_mgr_(buffer_mgr), column_id_(column_id), block_index_(block_index) {}
+
+    ColumnVector &GetColumnVector(const RowID row_id) {
+        const SegmentID segment_id = row_id.segment_id_;
+        const BlockID block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        if (loaded_ && segment_id == segment_id_ && block_id == block_id_) {
+            return column_vec_;
+        }
+        ColumnVector column_vec;
+        if (!block_index_->segment_block_index_.empty()) {
+            BlockEntry *block_entry = block_index_->segment_block_index_.at(segment_id).block_map_.at(block_id);
+            column_vec = block_entry->GetConstColumnVector(buffer_mgr_, column_id_);
+        } else {
+            BlockMeta *block_meta = block_index_->new_segment_block_index_.at(segment_id).block_map_.at(block_id).get();
+            ColumnMeta column_meta(column_id_, *block_meta);
+            auto [block_row_cnt, status] = block_meta->GetRowCnt1();
+            if (!status.ok()) {
+                UnrecoverableError("GetRowCnt1 failed!");
+            }
+            status = NewCatalog::GetColumnVector(column_meta, block_row_cnt, ColumnVectorTipe::kReadOnly, column_vec);
+            if (!status.ok()) {
+                UnrecoverableError("GetColumnVector failed!");
+            }
+        }
+        column_vec_ = std::move(column_vec);
+        segment_id_ = segment_id;
+        block_id_ = block_id;
+        loaded_ = true;
+        return column_vec_;
+    }
+
+private:
+    BufferManager *buffer_mgr_;
+    const ColumnID column_id_;
+    const BlockIndex *block_index_;
+    bool loaded_ = false;
+    SegmentID segment_id_ = 0;
+    BlockID block_id_ = 0;
+    ColumnVector column_vec_;
+};
+
+// Split rerank docs into contiguous RowID ranges and score them on the query thread pool.
+template <typename Func>
+void ParallelRerankDocs(Span<MatchTensorRerankDoc> rerank_docs, const u32 thread_num, Func &&func) {
+    const SizeT doc_num = rerank_docs.size();
+    const SizeT max_task_num = (doc_num + MATCH_TENSOR_RERANK_MIN_DOCS_PER_THREAD - 1) / MATCH_TENSOR_RERANK_MIN_DOCS_PER_THREAD;
+    const SizeT task_num = std::min<SizeT>(std::max<u32>(thread_num, 1), max_task_num);
+    ParallelFor(InfinityContext::instance().GetQueryThreadPool(), doc_num, task_num, [&](const SizeT begin, const SizeT end) {
+        func(rerank_docs.subspan(begin, end - begin));
+    });
+}
+
 struct RerankerParameterPack {
-    Vector<MatchTensorRerankDoc> &rerank_docs_;
+    Span<MatchTensorRerankDoc> rerank_docs_;
     BufferManager *buffer_mgr_;
     const DataType *column_data_type_;
     const ColumnID column_id_;
     const BlockIndex *block_index_;
     const MatchTensorExpression &match_tensor_expr_;
-    RerankerParameterPack(Vector<MatchTensorRerankDoc> &rerank_docs,
+    const u32 thread_num_;
+    RerankerParameterPack(Span<MatchTensorRerankDoc> rerank_docs,
                           BufferManager *buffer_mgr,
                           const DataType *column_data_type,
                           const ColumnID column_id,
                           const BlockIndex *block_index,
-                          const MatchTensorExpression &match_tensor_expr)
+                          const MatchTensorExpression &match_tensor_expr,
+                          const u32 thread_num)
         : rerank_docs_(rerank_docs), buffer_mgr_(buffer_mgr), column_data_type_(column_data_type), column_id_(column_id), block_index_(block_index),
-          match_tensor_expr_(match_tensor_expr) {}
+          match_tensor_expr_(match_tensor_expr), thread_num_(thread_num) {}
 };
 
 template <typename CalcutateScoreOfRowOp>
-void GetRerankerScore(Vector<MatchTensorRerankDoc> &rerank_docs,
-                      BufferManager *buffer_mgr,
-                      const ColumnID column_id,
-                      const BlockIndex *block_index,
+void GetRerankerScore(Span<MatchTensorRerankDoc> rerank_docs,
+                      RerankColumnLoader &column_loader,
                       const char *query_tensor_ptr,
                       const u32 query_embedding_num,
                       const u32 basic_embedding_dimension) {
     for (auto &doc : rerank_docs) {
-        const RowID row_id = doc.row_id_;
-        const SegmentID segment_id = row_id.segment_id_;
-        const SegmentOffset segment_offset = row_id.segment_offset_;
-        const BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-        const BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-        ColumnVector column_vec;
-        if (!block_index->segment_block_index_.empty()) {
-            BlockEntry *block_entry = block_index->segment_block_index_.at(segment_id).block_map_.at(block_id);
-            column_vec = block_entry->GetConstColumnVector(buffer_mgr, column_id);
-
-        } else {
-            BlockMeta *block_meta = block_index->new_segment_block_index_.at(segment_id).block_map_.at(block_id).get();
-            ColumnMeta column_meta(column_id, *block_meta);
-            auto [block_row_cnt, status] = block_meta->GetRowCnt1();
-            if (!status.ok()) {
-                UnrecoverableError("GetRowCnt1 failed!");
-            }
-            status = NewCatalog::GetColumnVector(column_meta, block_row_cnt, ColumnVectorTipe::kReadOnly, column_vec);
-            if (!status.ok()) {
-                UnrecoverableError("GetRowCnt1 failed!");
-            }
-        }
+        ColumnVector &column_vec = column_loader.GetColumnVector(doc.row_id_);
+        const BlockOffset block_offset = doc.row_id_.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
         doc.score_ = CalcutateScoreOfRowOp::Execute(column_vec, block_offset, query_tensor_ptr, query_embedding_num, basic_embedding_dimension);
     }
 }
@@ -1028,13 +1068,14 @@ void RerankerScoreT(RerankerParameterPack &parameter_pack) {
     const u32 basic_embedding_dimension = parameter_pack.match_tensor_expr_.tensor_basic_embedding_dimension_;
     switch (parameter_pack.match_tensor_expr_.search_method_) {
         case MatchTensorSearchMethod::kMaxSim: {
-            return GetRerankerScore<CalcutateScoreOfRow<MaxSimOp<ColumnElemT, QueryElemT>>>(parameter_pack.rerank_docs_,
-                                                                                            parameter_pack.buffer_mgr_,
-                                                                                            parameter_pack.column_id_,
-                                                                                            parameter_pack.block_index_,
-                                                                                            query_tensor_ptr,
-                                                                                            query_embedding_num,
-                                                                                            basic_embedding_dimension);
+            return ParallelRerankDocs(parameter_pack.rerank_docs_, parameter_pack.thread_num_, [&](Span<MatchTensorRerankDoc> docs) {
+                RerankColumnLoader column_loader(parameter_pack.buffer_mgr_, parameter_pack.column_id_, parameter_pack.block_index_);
+                GetRerankerScore<CalcutateScoreOfRow<MaxSimOp<ColumnElemT, QueryElemT>>>(docs,
+                                                                                         column_loader,
+                                                                                         query_tensor_ptr,
+                                                                                         query_embedding_num,
+                                                                                         basic_embedding_dimension);
+            });
         }
         case MatchTensorSearchMethod::kInvalid: {
             const auto error_message = "Invalid search method!";
@@ -1062,16 +1103,153 @@ struct ExecuteMatchTensorRerankerTypes {
     }
 };
 
+// Binary first stage of the rerank: embeddings are reduced to their sign bits and scored with the hamming MaxSim.
+// Every embedding is padded to whole u32 words so that MaxSimOp<bool, bool> takes its u32 popcount path.
+inline u32 BinaryRerankUnitBytes(const u32 dimension) { return (dimension + 31) / 32 * sizeof(u32); }
+
+template <typename ElemT>
+void BinarizeEmbeddings(const ElemT *src_ptr, const u32 embedding_num, const u32 dimension, u8 *dst_ptr) {
+    const u32 unit_bytes = BinaryRerankUnitBytes(dimension);
+    std::fill_n(dst_ptr, embedding_num * unit_bytes, u8{0});
+    for (u32 i = 0; i < embedding_num; ++i) {
+        const ElemT *src_embedding = src_ptr + i * dimension;
+        u8 *dst_embedding = dst_ptr + i * unit_bytes;
+        for (u32 j = 0; j < dimension; ++j) {
+            if (static_cast<float>(src_embedding[j]) > 0.0f) {
+                dst_embedding[j / 8] |= static_cast<u8>(1u << (j % 8));
+            }
+        }
+    }
+}
+
+template <typename ColumnElemT>
+struct BinaryMaxSimOfRow {
+    // target_buffer is reused across rows, u32 elements keep it aligned for the popcount path
+    static float Score(const Span<const char> raw_data,
+                       const u32 target_embedding_num,
+                       const char *query_bits_ptr,
+                       const u32 query_embedding_num,
+                       const u32 basic_embedding_dimension,
+                       Vector<u32> &target_buffer) {
+        const u32 unit_bytes = BinaryRerankUnitBytes(basic_embedding_dimension);
+        target_buffer.resize(target_embedding_num * unit_bytes / sizeof(u32));
+        auto *target_bits_ptr = reinterpret_cast<u8 *>(target_buffer.data());
+        BinarizeEmbeddings(reinterpret_cast<const ColumnElemT *>(raw_data.data()), target_embedding_num, basic_embedding_dimension, target_bits_ptr);
+        return MaxSimOp<bool, bool>::Score(query_bits_ptr,
+                                           reinterpret_cast<const char *>(target_bits_ptr),
+                                           query_embedding_num,
+                                           target_embedding_num,
+                                           unit_bytes * 8);
+    }
+
+    static float Execute(ColumnVector &column_vector,
+                         const u32 block_offset,
+                         const char *query_bits_ptr,
+                         const u32 query_embedding_num,
+                         const u32 basic_embedding_dimension,
+                         Vector<u32> &target_buffer) {
+        if (column_vector.data_type()->type() == LogicalType::kTensor) {
+            const auto [raw_data, embedding_num] = column_vector.GetTensorRaw(block_offset);
+            return Score(raw_data, embedding_num, query_bits_ptr, query_embedding_num, basic_embedding_dimension, target_buffer);
+        }
+        float maxsim_score = std::numeric_limits<float>::lowest();
+        for (const auto &[raw_data, embedding_num] : column_vector.GetTensorArrayRaw(block_offset)) {
+            const float tensor_score = Score(raw_data, embedding_num, query_bits_ptr, query_embedding_num, basic_embedding_dimension, target_buffer);
+            maxsim_score = std::max(maxsim_score, tensor_score);
+        }
+        return maxsim_score;
+    }
+};
+
+template <typename ColumnElemT>
+void GetBinaryRerankerScore(RerankerParameterPack &parameter_pack) {
+    const MatchTensorExpression &match_tensor_expr = parameter_pack.match_tensor_expr_;
+    const u32 query_embedding_num = match_tensor_expr.num_of_embedding_in_query_tensor_;
+    const u32 basic_embedding_dimension = match_tensor_expr.tensor_basic_embedding_dimension_;
+    Vector<u32> query_bits(query_embedding_num * BinaryRerankUnitBytes(basic_embedding_dimension) / sizeof(u32));
+    BinarizeEmbeddings(reinterpret_cast<const f32 *>(match_tensor_expr.query_embedding_.ptr),
+                       query_embedding_num,
+                       basic_embedding_dimension,
+                       reinterpret_cast<u8 *>(query_bits.data()));
+    const char *query_bits_ptr = reinterpret_cast<const char *>(query_bits.data());
+    ParallelRerankDocs(parameter_pack.rerank_docs_, parameter_pack.thread_num_, [&](Span<MatchTensorRerankDoc> docs) {
+        RerankColumnLoader column_loader(parameter_pack.buffer_mgr_, parameter_pack.column_id_, parameter_pack.block_index_);
+        Vector<u32> target_buffer;
+        for (auto &doc : docs) {
+            ColumnVector &column_vec = column_loader.GetColumnVector(doc.row_id_);
+            const BlockOffset block_offset = doc.row_id_.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+            doc.score_ = BinaryMaxSimOfRow<ColumnElemT>::Execute(column_vec,
+                                                                  block_offset,
+                                                                  query_bits_ptr,
+                                                                  query_embedding_num,
+                                                                  basic_embedding_dimension,
+                                                                  target_buffer);
+        }
+    });
+}
+
+// Keep the best keep_ratio of the candidates by binary MaxSim, and at least topn of them.
+// Only float tensors with f32 query are pruned, other element types are cheap enough to be scored directly.
+void PruneRerankDocsByBinaryMaxSim(Vector<MatchTensorRerankDoc> &rerank_docs,
+                                   const EmbeddingDataType column_elem_type,
+                                   RerankerParameterPack &parameter_pack,
+                                   const MatchTensorRerankOptions &options) {
+    if (options.keep_ratio_ >= 1.0f || parameter_pack.match_tensor_expr_.search_method_ != MatchTensorSearchMethod::kMaxSim ||
+        parameter_pack.match_tensor_expr_.embedding_data_type_ != EmbeddingDataType::kElemFloat) {
+        return;
+    }
+    const SizeT keep_num = std::max<SizeT>(options.topn_, static_cast<SizeT>(std::ceil(rerank_docs.size() * options.keep_ratio_)));
+    if (keep_num >= rerank_docs.size()) {
+        return;
+    }
+    switch (column_elem_type) {
+        case EmbeddingDataType::kElemFloat: {
+            GetBinaryRerankerScore<f32>(parameter_pack);
+            break;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            GetBinaryRerankerScore<f64>(parameter_pack);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            GetBinaryRerankerScore<Float16T>(parameter_pack);
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            GetBinaryRerankerScore<BFloat16T>(parameter_pack);
+            break;
+        }
+        default: {
+            return;
+        }
+    }
+    std::nth_element(rerank_docs.begin(),
+                     rerank_docs.begin() + keep_num,
+                     rerank_docs.end(),
+                     [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept { return lhs.score_ > rhs.score_; });
+    rerank_docs.erase(rerank_docs.begin() + keep_num, rerank_docs.end());
+    LOG_TRACE(fmt::format("MatchTensor rerank: {} candidates survive the binary first stage", rerank_docs.size()));
+    // restore RowID order for block access of the second stage
+    std::sort(rerank_docs.begin(), rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
+        return lhs.row_id_ < rhs.row_id_;
+    });
+}
+
 void CalculateFusionMatchTensorRerankerScores(Vector<MatchTensorRerankDoc> &rerank_docs,
                                               BufferManager *buffer_mgr,
                                               const DataType *column_data_type,
                                               const ColumnID column_id,
                                               const BlockIndex *block_index,
-                                              MatchTensorExpression &src_match_tensor_expr) {
+                                              MatchTensorExpression &src_match_tensor_expr,
+                                              const MatchTensorRerankOptions &options) {
     const auto column_elem_type = static_cast<const EmbeddingInfo *>(column_data_type->type_info().get())->Type();
     const auto [new_search_ptr, new_search_expr] = GetMatchTensorExprForCalculation(src_match_tensor_expr, column_elem_type);
     const auto *match_tensor_expr_ptr = new_search_expr ? new_search_expr.get() : &src_match_tensor_expr;
-    RerankerParameterPack parameter_pack(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *match_tensor_expr_ptr);
+    {
+        RerankerParameterPack parameter_pack(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *match_tensor_expr_ptr, options.thread_num_);
+        PruneRerankDocsByBinaryMaxSim(rerank_docs, column_elem_type, parameter_pack, options);
+    }
+    RerankerParameterPack parameter_pack(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *match_tensor_expr_ptr, options.thread_num_);
     const auto query_elem_type = parameter_pack.match_tensor_expr_.embedding_data_type_;
     ElemTypeDispatch<ExecuteMatchTensorRerankerTypes, TypeList<>>(parameter_pack, column_elem_type, query_elem_type);
 }
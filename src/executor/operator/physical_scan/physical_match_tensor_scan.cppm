@@ -116,13 +116,16 @@ private:
 };
 
 struct MatchTensorRerankDoc;
+struct MatchTensorRerankOptions;
 class BufferManager;
+// rerank_docs must be sorted by RowID, candidates pruned by the binary first stage are removed from it
 export void CalculateFusionMatchTensorRerankerScores(Vector<MatchTensorRerankDoc> &rerank_docs,
                                                      BufferManager *buffer_mgr,
                                                      const DataType *column_data_type,
                                                      ColumnID column_id,
                                                      const BlockIndex *block_index,
-                                                     MatchTensorExpression &src_match_tensor_expr);
+                                                     MatchTensorExpression &src_match_tensor_expr,
+                                                     const MatchTensorRerankOptions &options);
 
 // u8, i8, i16, i32 -> i32
 // i64 -> i64
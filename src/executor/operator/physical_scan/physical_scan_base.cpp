@@ -120,6 +120,11 @@ void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
         } while (row_idx < total_data_row_count);
     }
 
+    ResultCacheManager *cache_mgr = query_context->storage()->result_cache_manager();
+    const bool add_cache = cache_result_ && cache_mgr != nullptr;
+    // a cached result is read by other queries, so it is always complete
+    const bool fill_columns = !late_materialize_ || add_cache;
+
     OutputToDataBlockHelper output_to_data_block_helper;
     SizeT output_block_row_id = 0;
     SizeT output_block_idx = 0;
@@ -143,8 +148,10 @@ void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
 
             SizeT column_n = base_table_ref_->column_ids_.size();
             for (SizeT i = 0; i < column_n; ++i) {
-                SizeT column_id = base_table_ref_->column_ids_[i];
-                output_to_data_block_helper.AddOutputJobInfo(segment_id, block_id, column_id, block_offset, output_block_idx, i, output_block_row_id);
+                if (fill_columns) {
+                    SizeT column_id = base_table_ref_->column_ids_[i];
+                    output_to_data_block_helper.AddOutputJobInfo(segment_id, block_id, column_id, block_offset, output_block_idx, i, output_block_row_id);
+                }
                 output_block_ptr->column_vectors[i]->Finalize(output_block_ptr->column_vectors[i]->Size() + 1);
             }
             output_block_ptr->AppendValueByPtr(column_n, raw_result_dists + top_idx * result_size);
@@ -155,8 +162,7 @@ void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
     }
     output_block_ptr->Finalize();
     output_to_data_block_helper.OutputToDataBlock(query_context->storage()->buffer_manager(), block_index, operator_state->data_block_array_);
-    ResultCacheManager *cache_mgr = query_context->storage()->result_cache_manager();
-    if (cache_result_ && cache_mgr != nullptr) {
+    if (add_cache) {
         AddCache(query_context, cache_mgr, operator_state->data_block_array_);
     }
 }
@@ -3451,6 +3451,26 @@ void PhysicalShow::ExecuteShowConfigs(QueryContext *query_context, ShowOperatorS
             value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
         }
     }
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(PEER_REPLICATE_INDEX_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = global_config->PeerReplicateIndex() ? Value::MakeVarchar("true") : Value::MakeVarchar("false");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Load the index chunks dumped by leader instead of dumping them");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
 
     output_block_ptr->Finalize();
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
@@ -29,6 +29,7 @@ import merge_knn_data;
 import create_index_data;
 import blocking_queue;
 import expression_state;
+import expression_selector;
 import status;
 import internal_types;
 import column_def;
@@ -167,6 +168,9 @@ export struct MergeKnnOperatorState : public OperatorState {
 // Filter
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+
+    // kept across the blocks of the task for the adaptive order of AND / OR terms
+    ExpressionSelector selector_{};
 };
 
 // IndexScan
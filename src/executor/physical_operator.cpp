@@ -50,6 +50,20 @@ SizeT PhysicalOperator::TaskletCount() { return 1; }
 
 String PhysicalOperator::GetName() const { return PhysicalOperatorToString(operator_type_); }
 
+void PhysicalOperator::InputMaterialize(OperatorState *operator_state) const {
+    OperatorState *prev_op_state = operator_state->prev_op_state_;
+    if (prev_op_state == nullptr) {
+        return;
+    }
+    // columns loaded by InputLoad are inserted into all rows of the input block
+    if (AcceptSelectedInput() && (load_metas_.get() == nullptr || load_metas_->empty())) {
+        return;
+    }
+    for (auto &data_block : prev_op_state->data_block_array_) {
+        data_block->Materialize();
+    }
+}
+
 void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *operator_state, HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) {
     if (load_metas_.get() == nullptr || load_metas_->empty()) {
         return;
@@ -78,6 +78,9 @@ public:
 
     void InputLoad(QueryContext *query_context, OperatorState *output_state, HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs);
 
+    // Copy the selected rows of the input data blocks unless the operator reads them through DataBlock::SelectedColumn.
+    void InputMaterialize(OperatorState *output_state) const;
+
     virtual void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) {}
 
     const SharedPtr<Vector<LoadMeta>> &load_metas() const { return load_metas_; }
@@ -86,6 +89,11 @@ public:
 
     void SetCacheResult(bool cache_result) { cache_result_ = cache_result; }
 
+    bool late_materialize() const { return late_materialize_; }
+
+    // Only the score and row_id columns of the output are filled, the parent fetches the table columns of the rows it outputs.
+    void SetLateMaterialize(bool late_materialize) { late_materialize_ = late_materialize; }
+
 protected:
     u64 operator_id_;
     PhysicalOperatorType operator_type_{PhysicalOperatorType::kInvalid};
@@ -96,12 +104,16 @@ protected:
 
     SharedPtr<Vector<LoadMeta>> load_metas_{};
     bool cache_result_;
+    bool late_materialize_{false};
 
 public:
     // Operator
 
     virtual bool ParallelOperator() const { return false; }
 
+    // Input data blocks may carry a selection, see DataBlock::InitSelected
+    virtual bool AcceptSelectedInput() const { return false; }
+
 public:
     // Exchange
     virtual bool IsExchange() const { return false; }
@@ -155,6 +155,30 @@ import logger;
 
 namespace infinity {
 
+namespace {
+
+// For an operator whose parent outputs a subset of its rows and fetches their table columns itself
+void SetLateMaterialize(PhysicalOperator *op) {
+    switch (op->operator_type()) {
+        case PhysicalOperatorType::kKnnScan:
+        case PhysicalOperatorType::kMergeKnn:
+        case PhysicalOperatorType::kMatchSparseScan:
+        case PhysicalOperatorType::kMergeMatchSparse:
+        case PhysicalOperatorType::kMatchTensorScan:
+        case PhysicalOperatorType::kMatch:
+        case PhysicalOperatorType::kFusion: {
+            op->SetLateMaterialize(true);
+            break;
+        }
+        default: {
+            // PhysicalMergeMatchTensor copies the rows of its input, PhysicalReadCache outputs the cached blocks
+            break;
+        }
+    }
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildPhysicalOperator(const SharedPtr<LogicalNode> &logical_operator) const {
 
     UniquePtr<PhysicalOperator> result{nullptr};
@@ -1041,6 +1065,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatchSparseScan(const SharedPt
         match_sparse_scan_op->SetCacheResult(true);
         return match_sparse_scan_op;
     }
+    // the merged top n are fetched by PhysicalMergeMatchSparse
+    SetLateMaterialize(match_sparse_scan_op.get());
     auto merge_match_sparse_op =
         MakeUnique<PhysicalMergeMatchSparse>(query_context_ptr_->GetNextNodeID(),
                                              std::move(match_sparse_scan_op),
@@ -1068,6 +1094,15 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFusion(const SharedPtr<Logical
         UniquePtr<PhysicalOperator> child_phy = BuildPhysicalOperator(logical_fusion->other_children_[i]);
         other_children.push_back(std::move(child_phy));
     }
+    // PhysicalFusion fetches the table columns of the fused top n, the children only provide score and row_id
+    for (PhysicalOperator *child_phy : {left_phy.get(), right_phy.get()}) {
+        if (child_phy != nullptr) {
+            SetLateMaterialize(child_phy);
+        }
+    }
+    for (const auto &child_phy : other_children) {
+        SetLateMaterialize(child_phy.get());
+    }
     return MakeUnique<PhysicalFusion>(logical_fusion->node_id(),
                                       logical_fusion->base_table_ref_,
                                       std::move(left_phy),
@@ -1093,6 +1128,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildKnn(const SharedPtr<LogicalNod
         knn_scan_op->SetCacheResult(true);
         return knn_scan_op;
     } else {
+        // the merged top n are fetched by PhysicalMergeKnn
+        SetLateMaterialize(knn_scan_op.get());
         return MakeUnique<PhysicalMergeKnn>(query_context_ptr_->GetNextNodeID(),
                                             logical_knn_scan->base_table_ref_,
                                             std::move(knn_scan_op),
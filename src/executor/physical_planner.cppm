@@ -37,6 +37,8 @@ public:
 #endif
     }
 
+    void Reset(QueryContext *query_context_ptr) { query_context_ptr_ = query_context_ptr; }
+
     [[nodiscard]] UniquePtr<PhysicalOperator> BuildPhysicalOperator(const SharedPtr<LogicalNode> &logical_operator) const;
 
 private:
@@ -0,0 +1,137 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <type_traits>
+
+module approx;
+
+import stl;
+import new_catalog;
+import aggregate_function;
+import aggregate_function_set;
+import approx_sketch;
+
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+template <typename ValueType>
+struct HLLSketchState {
+public:
+    u8 registers_[HyperLogLogSketch::kRegisterCount];
+
+    inline void Initialize() { HyperLogLogSketch::Initialize(registers_); }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            HyperLogLogSketch::Add(registers_, HyperLogLogSketch::HashDouble(input[idx]));
+        } else {
+            HyperLogLogSketch::Add(registers_, HyperLogLogSketch::Hash(static_cast<u64>(input[idx])));
+        }
+    }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT) { Update(input, idx); }
+
+    inline ptr_t Finalize() { return (ptr_t)registers_; }
+
+    inline static SizeT Size(const DataType &) { return sizeof(HLLSketchState); }
+};
+
+template <typename ValueType>
+struct TDigestSketchState {
+public:
+    // values are buffered and merged into the digest in sorted batches
+    static constexpr SizeT kBufferSize = 512;
+
+    double sketch_[TDigestSketch::kSketchSize];
+    double buffer_[kBufferSize];
+    SizeT buffer_count_{};
+
+    inline void Initialize() {
+        TDigestSketch::Initialize(sketch_);
+        buffer_count_ = 0;
+    }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        double value = static_cast<double>(input[idx]);
+        if (std::isnan(value)) {
+            return;
+        }
+        buffer_[buffer_count_++] = value;
+        if (buffer_count_ == kBufferSize) {
+            Flush();
+        }
+    }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT count) {
+        for (SizeT i = 0; i < count; ++i) {
+            Update(input, idx);
+        }
+    }
+
+    inline ptr_t Finalize() {
+        Flush();
+        return (ptr_t)sketch_;
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(TDigestSketchState); }
+
+private:
+    inline void Flush() {
+        TDigestSketch::AddValues(sketch_, buffer_, buffer_count_);
+        buffer_count_ = 0;
+    }
+};
+
+namespace {
+
+template <template <typename> typename State, typename ValueType>
+void AddSketchFunction(AggregateFunctionSet &function_set, const String &func_name, LogicalType input_type, const DataType &sketch_type) {
+    AggregateFunction function = UnaryAggregate<State<ValueType>, ValueType, EmbeddingT>(func_name, DataType(input_type), sketch_type);
+    function_set.AddFunction(function);
+}
+
+template <template <typename> typename State>
+void AddSketchFunctions(AggregateFunctionSet &function_set, const String &func_name, const DataType &sketch_type) {
+    AddSketchFunction<State, TinyIntT>(function_set, func_name, LogicalType::kTinyInt, sketch_type);
+    AddSketchFunction<State, SmallIntT>(function_set, func_name, LogicalType::kSmallInt, sketch_type);
+    AddSketchFunction<State, IntegerT>(function_set, func_name, LogicalType::kInteger, sketch_type);
+    AddSketchFunction<State, BigIntT>(function_set, func_name, LogicalType::kBigInt, sketch_type);
+    AddSketchFunction<State, FloatT>(function_set, func_name, LogicalType::kFloat, sketch_type);
+    AddSketchFunction<State, DoubleT>(function_set, func_name, LogicalType::kDouble, sketch_type);
+}
+
+} // namespace
+
+void RegisterApproxFunction(NewCatalog *catalog_ptr) {
+    {
+        String func_name = "HLL_SKETCH";
+        SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+        AddSketchFunctions<HLLSketchState>(*function_set_ptr, func_name, HyperLogLogSketch::SketchType());
+        NewCatalog::AddFunctionSet(catalog_ptr, function_set_ptr);
+    }
+    {
+        String func_name = "TDIGEST_SKETCH";
+        SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+        AddSketchFunctions<TDigestSketchState>(*function_set_ptr, func_name, TDigestSketch::SketchType());
+        NewCatalog::AddFunctionSet(catalog_ptr, function_set_ptr);
+    }
+}
+
+} // namespace infinity
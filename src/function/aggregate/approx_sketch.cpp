@@ -0,0 +1,236 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+module approx_sketch;
+
+import stl;
+import data_type;
+import logical_type;
+import internal_types;
+import embedding_info;
+
+namespace infinity {
+
+DataType HyperLogLogSketch::SketchType() {
+    return DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemUInt8, kRegisterCount));
+}
+
+void HyperLogLogSketch::Initialize(u8 *registers) { std::memset(registers, 0, kRegisterCount); }
+
+void HyperLogLogSketch::Add(u8 *registers, u64 hash) {
+    SizeT idx = hash >> (64 - kPrecision);
+    // the guard bit bounds the rank by 64 - kPrecision + 1
+    u64 w = (hash << kPrecision) | (u64(1) << (kPrecision - 1));
+    u8 rank = static_cast<u8>(std::countl_zero(w) + 1);
+    registers[idx] = std::max(registers[idx], rank);
+}
+
+void HyperLogLogSketch::Merge(u8 *dst, const u8 *src) {
+    for (SizeT i = 0; i < kRegisterCount; ++i) {
+        dst[i] = std::max(dst[i], src[i]);
+    }
+}
+
+i64 HyperLogLogSketch::Estimate(const u8 *registers) {
+    constexpr double m = kRegisterCount;
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double sum = 0;
+    SizeT zero_count = 0;
+    for (SizeT i = 0; i < kRegisterCount; ++i) {
+        sum += std::ldexp(1.0, -static_cast<int>(registers[i]));
+        zero_count += registers[i] == 0;
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zero_count > 0) {
+        // linear counting for the small range
+        estimate = m * std::log(m / static_cast<double>(zero_count));
+    }
+    return std::llround(estimate);
+}
+
+u64 HyperLogLogSketch::Hash(u64 value) {
+    // splitmix64 finalizer
+    u64 z = value + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+u64 HyperLogLogSketch::HashDouble(double value) {
+    if (value == 0) {
+        // -0.0 and 0.0 are the same value
+        value = 0;
+    } else if (std::isnan(value)) {
+        value = std::numeric_limits<double>::quiet_NaN();
+    }
+    return Hash(std::bit_cast<u64>(value));
+}
+
+namespace {
+
+inline double ScaleK1(double q) {
+    q = std::clamp(q, 0.0, 1.0);
+    return TDigestSketch::kCompression / (2 * std::numbers::pi) * std::asin(2 * q - 1);
+}
+
+void ReadCentroids(const double *sketch, Vector<Pair<double, double>> &centroids) {
+    SizeT count = static_cast<SizeT>(sketch[3]);
+    const double *ptr = sketch + TDigestSketch::kHeaderSize;
+    for (SizeT i = 0; i < count; ++i) {
+        centroids.emplace_back(ptr[2 * i], ptr[2 * i + 1]);
+    }
+}
+
+} // namespace
+
+DataType TDigestSketch::SketchType() {
+    return DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemDouble, kSketchSize));
+}
+
+void TDigestSketch::Initialize(double *sketch) { std::fill_n(sketch, kSketchSize, 0.0); }
+
+void TDigestSketch::AddValues(double *sketch, double *values, SizeT value_count) {
+    if (value_count == 0) {
+        return;
+    }
+    std::sort(values, values + value_count);
+    double min_value = values[0];
+    double max_value = values[value_count - 1];
+    Vector<Pair<double, double>> existing;
+    if (sketch[0] > 0) {
+        min_value = std::min(min_value, sketch[1]);
+        max_value = std::max(max_value, sketch[2]);
+        existing.reserve(static_cast<SizeT>(sketch[3]));
+        ReadCentroids(sketch, existing);
+    }
+    Vector<Pair<double, double>> centroids;
+    centroids.reserve(existing.size() + value_count);
+    SizeT i = 0;
+    for (const auto &centroid : existing) {
+        for (; i < value_count && values[i] < centroid.first; ++i) {
+            centroids.emplace_back(values[i], 1.0);
+        }
+        centroids.push_back(centroid);
+    }
+    for (; i < value_count; ++i) {
+        centroids.emplace_back(values[i], 1.0);
+    }
+    Compress(sketch, centroids, min_value, max_value);
+}
+
+void TDigestSketch::Merge(double *dst, const double *src) {
+    if (src[0] <= 0) {
+        return;
+    }
+    if (dst[0] <= 0) {
+        std::copy_n(src, kSketchSize, dst);
+        return;
+    }
+    Vector<Pair<double, double>> left;
+    Vector<Pair<double, double>> right;
+    ReadCentroids(dst, left);
+    ReadCentroids(src, right);
+    Vector<Pair<double, double>> centroids(left.size() + right.size());
+    std::merge(left.begin(), left.end(), right.begin(), right.end(), centroids.begin(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+    });
+    Compress(dst, centroids, std::min(dst[1], src[1]), std::max(dst[2], src[2]));
+}
+
+void TDigestSketch::Compress(double *sketch, const Vector<Pair<double, double>> &centroids, double min_value, double max_value) {
+    double total_weight = 0;
+    for (const auto &centroid : centroids) {
+        total_weight += centroid.second;
+    }
+    double *out = sketch + kHeaderSize;
+    SizeT out_count = 0;
+    auto emit = [&](const Pair<double, double> &centroid) {
+        if (out_count == kCentroidCapacity) {
+            // not reachable with the k1 scale, keep the sketch bounded anyway
+            double &mean = out[2 * (out_count - 1)];
+            double &weight = out[2 * (out_count - 1) + 1];
+            weight += centroid.second;
+            mean += (centroid.first - mean) * centroid.second / weight;
+            return;
+        }
+        out[2 * out_count] = centroid.first;
+        out[2 * out_count + 1] = centroid.second;
+        ++out_count;
+    };
+
+    Pair<double, double> current = centroids[0];
+    double weight_before = 0;
+    double k_left = ScaleK1(0);
+    for (SizeT i = 1; i < centroids.size(); ++i) {
+        const auto &next = centroids[i];
+        double q_right = (weight_before + current.second + next.second) / total_weight;
+        if (ScaleK1(q_right) - k_left <= 1) {
+            current.second += next.second;
+            current.first += (next.first - current.first) * next.second / current.second;
+        } else {
+            emit(current);
+            weight_before += current.second;
+            k_left = ScaleK1(weight_before / total_weight);
+            current = next;
+        }
+    }
+    emit(current);
+
+    sketch[0] = total_weight;
+    sketch[1] = min_value;
+    sketch[2] = max_value;
+    sketch[3] = static_cast<double>(out_count);
+}
+
+bool TDigestSketch::Quantile(const double *sketch, double q, double &result) {
+    double total_weight = sketch[0];
+    if (total_weight <= 0) {
+        return false;
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    double min_value = sketch[1];
+    double max_value = sketch[2];
+    SizeT count = static_cast<SizeT>(sketch[3]);
+    const double *centroids = sketch + kHeaderSize;
+    auto mean = [&](SizeT i) { return centroids[2 * i]; };
+    auto weight = [&](SizeT i) { return centroids[2 * i + 1]; };
+
+    double target = q * total_weight;
+    if (target < weight(0) / 2) {
+        result = min_value + (mean(0) - min_value) * target / (weight(0) / 2);
+        return true;
+    }
+    double weight_before = 0;
+    for (SizeT i = 0; i + 1 < count; ++i) {
+        double center = weight_before + weight(i) / 2;
+        double next_center = weight_before + weight(i) + weight(i + 1) / 2;
+        if (target < next_center) {
+            result = mean(i) + (mean(i + 1) - mean(i)) * (target - center) / (next_center - center);
+            return true;
+        }
+        weight_before += weight(i);
+    }
+    double last_center = total_weight - weight(count - 1) / 2;
+    result = mean(count - 1) + (max_value - mean(count - 1)) * (target - last_center) / (weight(count - 1) / 2);
+    return true;
+}
+
+} // namespace infinity
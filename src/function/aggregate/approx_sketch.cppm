@@ -0,0 +1,76 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module approx_sketch;
+
+import stl;
+import data_type;
+
+namespace infinity {
+
+// Fixed size sketches of the approximate aggregates. A sketch is the finalized value of its aggregate function
+// (an embedding column), so the partial results of the tasklets can be merged by PhysicalMergeAggregate and the
+// estimate is computed by a scalar function over the merged sketch.
+
+// HyperLogLog with 2^12 u8 registers, standard error about 1.6%.
+export struct HyperLogLogSketch {
+    static constexpr SizeT kPrecision = 12;
+    static constexpr SizeT kRegisterCount = SizeT(1) << kPrecision;
+
+    static DataType SketchType();
+
+    static void Initialize(u8 *registers);
+
+    static void Add(u8 *registers, u64 hash);
+
+    // Register-wise max.
+    static void Merge(u8 *dst, const u8 *src);
+
+    static i64 Estimate(const u8 *registers);
+
+    static u64 Hash(u64 value);
+
+    static u64 HashDouble(double value);
+};
+
+// Merging t-digest with the k1 (arcsin) scale function. The sketch is an array of doubles:
+// - [0] total weight, [1] min, [2] max, [3] centroid count
+// - then (mean, weight) of at most kCentroidCapacity centroids sorted by mean
+export struct TDigestSketch {
+    static constexpr double kCompression = 100;
+    // a compressed digest has at most kCompression + 1 centroids
+    static constexpr SizeT kCentroidCapacity = 128;
+    static constexpr SizeT kHeaderSize = 4;
+    static constexpr SizeT kSketchSize = kHeaderSize + 2 * kCentroidCapacity;
+
+    static DataType SketchType();
+
+    static void Initialize(double *sketch);
+
+    // Merge the unsorted values into the sketch, values is used as scratch space.
+    static void AddValues(double *sketch, double *values, SizeT value_count);
+
+    static void Merge(double *dst, const double *src);
+
+    // Return false for an empty sketch.
+    static bool Quantile(const double *sketch, double q, double &result);
+
+private:
+    // Compress the centroids sorted by mean into the sketch.
+    static void Compress(double *sketch, const Vector<Pair<double, double>> &centroids, double min_value, double max_value);
+};
+
+} // namespace infinity
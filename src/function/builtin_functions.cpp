@@ -18,6 +18,7 @@ module builtin_functions;
 
 import stl;
 import new_catalog;
+import approx;
 import avg;
 import count;
 import first;
@@ -27,6 +28,7 @@ import sum;
 
 import add;
 import abs;
+import approx_estimate;
 import sqrt;
 import round;
 import ceil;
@@ -109,6 +111,7 @@ void BuiltinFunctions::RegisterAggregateFunction() {
     RegisterMaxFunction(catalog_ptr_);
     RegisterMinFunction(catalog_ptr_);
     RegisterSumFunction(catalog_ptr_);
+    RegisterApproxFunction(catalog_ptr_);
 }
 
 void BuiltinFunctions::RegisterScalarFunction() {
@@ -169,6 +172,9 @@ void BuiltinFunctions::RegisterScalarFunction() {
     RegisterTrimFunction(catalog_ptr_);
     RegisterPositionFunction(catalog_ptr_);
 
+    // estimate functions of the approximate aggregate sketches
+    RegisterApproxEstimateFunction(catalog_ptr_);
+
     // date and time functions
     RegisterCurrentDateFunction(catalog_ptr_);
     RegisterCurrentTimeFunction(catalog_ptr_);
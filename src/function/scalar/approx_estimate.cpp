@@ -0,0 +1,96 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module approx_estimate;
+
+import stl;
+import new_catalog;
+import status;
+import infinity_exception;
+import scalar_function;
+import scalar_function_set;
+import approx_sketch;
+import column_vector;
+import data_block;
+
+import third_party;
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+inline SizeT RowIndex(const ColumnVector &column, SizeT idx) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : idx; }
+
+void HLLEstimateFunction(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+    const ColumnVector &sketch_column = *input.column_vectors[0];
+    SizeT sketch_size = sketch_column.data_type()->Size();
+    SizeT row_count = input.row_count();
+    auto *result_ptr = reinterpret_cast<BigIntT *>(output->data());
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        const auto *registers = reinterpret_cast<const u8 *>(sketch_column.data() + RowIndex(sketch_column, idx) * sketch_size);
+        result_ptr[idx] = HyperLogLogSketch::Estimate(registers);
+    }
+    output->nulls_ptr_->SetAllTrue();
+    output->Finalize(row_count);
+}
+
+void TDigestQuantileFunction(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+    const ColumnVector &sketch_column = *input.column_vectors[0];
+    const ColumnVector &q_column = *input.column_vectors[1];
+    SizeT sketch_size = sketch_column.data_type()->Size();
+    SizeT row_count = input.row_count();
+    auto *result_ptr = reinterpret_cast<DoubleT *>(output->data());
+    output->nulls_ptr_->SetAllTrue();
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        DoubleT q = reinterpret_cast<const DoubleT *>(q_column.data())[RowIndex(q_column, idx)];
+        if (!(q >= 0 && q <= 1)) {
+            RecoverableError(Status::InvalidParameterValue("percentile", std::to_string(q), "[0, 1]"));
+        }
+        const auto *sketch = reinterpret_cast<const double *>(sketch_column.data() + RowIndex(sketch_column, idx) * sketch_size);
+        if (!TDigestSketch::Quantile(sketch, q, result_ptr[idx])) {
+            // no value is aggregated
+            output->nulls_ptr_->SetFalse(idx);
+        }
+    }
+    output->Finalize(row_count);
+}
+
+} // namespace
+
+void RegisterApproxEstimateFunction(NewCatalog *catalog_ptr) {
+    {
+        String func_name = "hll_estimate";
+        SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
+        ScalarFunction hll_estimate_function(func_name, {HyperLogLogSketch::SketchType()}, DataType(LogicalType::kBigInt), &HLLEstimateFunction);
+        function_set_ptr->AddFunction(hll_estimate_function);
+        NewCatalog::AddFunctionSet(catalog_ptr, function_set_ptr);
+    }
+    {
+        String func_name = "tdigest_quantile";
+        SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
+        ScalarFunction tdigest_quantile_function(func_name,
+                                                 {TDigestSketch::SketchType(), DataType(LogicalType::kDouble)},
+                                                 DataType(LogicalType::kDouble),
+                                                 &TDigestQuantileFunction);
+        function_set_ptr->AddFunction(tdigest_quantile_function);
+        NewCatalog::AddFunctionSet(catalog_ptr, function_set_ptr);
+    }
+}
+
+} // namespace infinity
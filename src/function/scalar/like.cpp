@@ -14,6 +14,9 @@
 
 module;
 
+#include <cstring>
+#include <re2/re2.h>
+
 module like;
 
 import stl;
@@ -28,95 +31,127 @@ import internal_types;
 import data_type;
 import logger;
 import status;
+import column_vector;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
+namespace {
+
+// A LIKE pattern compiled once: patterns made of one literal with '%' only at the ends take a memcmp/memmem fast path,
+// anything else is translated into an anchored RE2 program.
+class LikeMatcher {
+public:
+    explicit LikeMatcher(std::string_view pattern) : pattern_(pattern) {
+        SizeT begin = 0;
+        SizeT end = pattern.size();
+        while (begin < end && pattern[begin] == '%') {
+            ++begin;
+        }
+        while (end > begin && pattern[end - 1] == '%') {
+            --end;
+        }
+        std::string_view literal = pattern.substr(begin, end - begin);
+        if (literal.find_first_of("%_") == std::string_view::npos) {
+            literal_ = literal;
+            bool any_prefix = begin > 0;
+            bool any_suffix = end < pattern.size();
+            if (any_prefix && any_suffix) {
+                kind_ = Kind::kContains;
+            } else if (any_prefix) {
+                kind_ = Kind::kSuffix;
+            } else if (any_suffix) {
+                kind_ = Kind::kPrefix;
+            } else {
+                kind_ = Kind::kExact;
             }
-
-            // % is the last character
-            if (right_idx == right_len) {
-                return true;
+            return;
+        }
+        String regex = "(?s)";
+        for (char c : pattern) {
+            if (c == '%') {
+                regex += ".*";
+            } else if (c == '_') {
+                regex += '.';
+            } else {
+                regex += re2::RE2::QuoteMeta(re2::StringPiece(&c, 1));
             }
+        }
+        re2::RE2::Options options;
+        options.set_encoding(re2::RE2::Options::EncodingLatin1);
+        regex_ = MakeUnique<re2::RE2>(regex, options);
+        kind_ = Kind::kRegex;
+    }
 
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
-            }
+    const String &pattern() const { return pattern_; }
 
-            // Not matched
-            return false;
-        } else {
-            return false;
+    bool Match(const char *str, SizeT len) const {
+        switch (kind_) {
+            case Kind::kExact: {
+                return len == literal_.size() && std::memcmp(str, literal_.data(), len) == 0;
+            }
+            case Kind::kPrefix: {
+                return len >= literal_.size() && std::memcmp(str, literal_.data(), literal_.size()) == 0;
+            }
+            case Kind::kSuffix: {
+                return len >= literal_.size() && std::memcmp(str + len - literal_.size(), literal_.data(), literal_.size()) == 0;
+            }
+            case Kind::kContains: {
+                return literal_.empty() || memmem(str, len, literal_.data(), literal_.size()) != nullptr;
+            }
+            case Kind::kRegex: {
+                return re2::RE2::FullMatch(re2::StringPiece(str, len), *regex_);
+            }
         }
+        return false;
     }
 
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
+    // The matcher of the last pattern used by this thread, the pattern of a query is mostly a constant.
+    static const LikeMatcher &Get(const char *pattern, SizeT pattern_len) {
+        static thread_local UniquePtr<LikeMatcher> cached_matcher;
+        std::string_view pattern_view(pattern, pattern_len);
+        if (cached_matcher.get() == nullptr || cached_matcher->pattern() != pattern_view) {
+            cached_matcher = MakeUnique<LikeMatcher>(pattern_view);
+        }
+        return *cached_matcher;
     }
 
-    return left_idx == left_len && right_idx == right_len;
-}
+private:
+    enum class Kind : u8 { kExact, kPrefix, kSuffix, kContains, kRegex };
+
+    String pattern_;
+    Kind kind_{Kind::kRegex};
+    String literal_;
+    UniquePtr<re2::RE2> regex_;
+};
+
+} // namespace
 
 struct LikeFunction {
     template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        Status status = Status::NotSupport("Not support: Like function");
-        RecoverableError(status);
+    static inline void Run(TA &left, TB &right, TC &result) {
+        const char *str;
+        SizeT str_len;
+        const char *pattern;
+        SizeT pattern_len;
+        GetReaderValue(left, str, str_len);
+        GetReaderValue(right, pattern, pattern_len);
+        result.SetValue(LikeMatcher::Get(pattern, pattern_len).Match(str, str_len));
     }
 };
 
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    UnrecoverableError(error_message);
-
-    //    ptr_t left_ptr = left.GetDataPtr();
-    //    SizeT left_len = left.GetDataLen();
-    //    ptr_t right_ptr = right.GetDataPtr();
-    //    SizeT right_len = right.GetDataLen();
-
-    //    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
 struct NotLikeFunction {
     template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        String error_message = "Not implement";
-        UnrecoverableError(error_message);
+    static inline void Run(TA &left, TB &right, TC &result) {
+        const char *str;
+        SizeT str_len;
+        const char *pattern;
+        SizeT pattern_len;
+        GetReaderValue(left, str, str_len);
+        GetReaderValue(right, pattern, pattern_len);
+        result.SetValue(!LikeMatcher::Get(pattern, pattern_len).Match(str, str_len));
     }
 };
 
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    UnrecoverableError(error_message);
-
-    //    ptr_t left_ptr = left.GetDataPtr();
-    //    SizeT left_len = left.GetDataLen();
-    //    ptr_t right_ptr = right.GetDataPtr();
-    //    SizeT right_len = right.GetDataLen();
-
-    //    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
 void RegisterLikeFunction(NewCatalog *catalog_ptr) {
     String func_name = "like";
 
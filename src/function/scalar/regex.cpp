@@ -20,6 +20,20 @@ import column_vector;
 
 namespace infinity {
 
+namespace {
+
+// The compiled program of the last pattern used by this thread, the pattern of a query is mostly a constant.
+const re2::RE2 &GetCompiledRegex(const char *pattern, SizeT pattern_len) {
+    static thread_local UniquePtr<re2::RE2> cached_regex;
+    std::string_view pattern_view(pattern, pattern_len);
+    if (cached_regex.get() == nullptr || std::string_view(cached_regex->pattern()) != pattern_view) {
+        cached_regex = MakeUnique<re2::RE2>(re2::StringPiece(pattern, pattern_len));
+    }
+    return *cached_regex;
+}
+
+} // namespace
+
 struct RegexFunction {
     template <typename TA, typename TB, typename TC>
     static inline void Run(TA &left, TB &right, TC &result) {
@@ -29,9 +43,7 @@ struct RegexFunction {
         SizeT pattern_len;
         GetReaderValue(left, origin_str, origin_len);
         GetReaderValue(right, pattern_str, pattern_len);
-        String origin_str_(origin_str, origin_len);
-        String pattern_str_(pattern_str, pattern_len);
-        bool match = re2::RE2::PartialMatch(origin_str_, pattern_str_);
+        bool match = re2::RE2::PartialMatch(re2::StringPiece(origin_str, origin_len), GetCompiledRegex(pattern_str, pattern_len));
         result.SetValue(match);
     }
 };
@@ -39,6 +39,7 @@ ClusterManager::ClusterManager() {
 }
 
 ClusterManager::~ClusterManager() {
+    StopLogApplier();
     other_node_map_.clear();
     this_node_.reset();
     if (client_to_leader_.get() != nullptr) {
@@ -60,6 +61,7 @@ Status ClusterManager::UnInit(bool not_unregister) {
         hb_periodic_thread_->join();
         hb_periodic_thread_.reset();
     }
+    StopLogApplier();
 
     {
         std::unique_lock<std::mutex> cluster_lock(cluster_mutex_);
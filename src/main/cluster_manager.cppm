@@ -25,6 +25,7 @@ import peer_task;
 import storage;
 import admin_statement;
 import node_info;
+import blocking_queue;
 
 namespace infinity {
 
@@ -92,11 +93,8 @@ public:
 
 private:
     void CheckHeartBeatThread();
-    Status SendLogs(const String &node_name,
-                    const SharedPtr<PeerClient> &peer_client,
-                    const Vector<SharedPtr<String>> &logs,
-                    bool synchronize,
-                    bool on_register);
+    // Sends the logs the node lacks on registration, synchronously
+    Status SendLogs(const String &node_name, const SharedPtr<PeerClient> &peer_client, const Vector<SharedPtr<String>> &logs);
     Status GetReadersInfo(Vector<SharedPtr<NodeInfo>> &followers,
                           Vector<SharedPtr<PeerClient>> &follower_clients,
                           Vector<SharedPtr<NodeInfo>> &learners,
@@ -116,9 +114,16 @@ public:
     Status UpdateNodeInfoNoLock(const Vector<SharedPtr<NodeInfo>> &info_of_nodes);
     Status ContinueStartup(const Vector<String> &synced_logs);
     Status ApplySyncedLogNolock(const Vector<String> &synced_logs);
+    // The synced logs are durable on receipt, they are replayed by the log applier thread in the order of receipt.
+    // Returns the failure to apply the logs received before, which is reported to the leader in the ack.
+    Status ApplySyncedLogAsync(Vector<String> synced_logs);
+    // Waits for the log applier to replay the logs received before
+    void WaitSyncedLogApplied();
 
 private:
     void HeartBeatToLeaderThread();
+    void LogApplierThread();
+    void StopLogApplier();
     Status RegisterToLeaderNoLock();
     Status UnregisterToLeaderNoLock();
 
@@ -129,6 +134,15 @@ private:
     std::mutex hb_mutex_;
     std::condition_variable hb_cv_;
     Atomic<bool> hb_running_{false};
+
+    // nullptr stops the applier
+    BlockingQueue<SharedPtr<Vector<String>>> synced_log_queue_{"SyncedLogApplier"};
+    SharedPtr<Thread> log_applier_thread_{};
+    std::mutex log_apply_mutex_;
+    std::condition_variable log_apply_cv_;
+    SizeT received_log_batch_count_{};
+    SizeT applied_log_batch_count_{};
+    Status log_apply_status_{};
 };
 
 } // namespace infinity
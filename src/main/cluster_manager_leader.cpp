@@ -419,59 +419,51 @@ Status ClusterManager::SyncLogsOnRegistration(const SharedPtr<NodeInfo> &non_lea
     // Leader will send the WALs
     String non_leader_node_name = non_leader_node->node_name();
     LOG_TRACE(fmt::format("Leader will send the diff logs count: {} to {} synchronously", wal_strings.size(), non_leader_node_name));
-    return SendLogs(non_leader_node_name, peer_client, wal_strings, true, true);
+    return SendLogs(non_leader_node_name, peer_client, wal_strings);
 }
 
 void ClusterManager::PrepareLogs(const SharedPtr<String> &log_string) { logs_to_sync_.emplace_back(log_string); }
 
 Status ClusterManager::SyncLogs() {
-    LOG_TRACE("Sync logs to follower and async logs to learner");
-    Set<String> sent_nodes;
-    while (true) {
-        // Get follower and learner node
-        Vector<SharedPtr<NodeInfo>> followers;
-        Vector<SharedPtr<PeerClient>> follower_clients;
-        Vector<SharedPtr<NodeInfo>> learners;
-        Vector<SharedPtr<PeerClient>> learner_clients;
-
-        Status status = GetReadersInfo(followers, follower_clients, learners, learner_clients);
-        if (!status.ok()) {
-            return status;
-        }
-
-        SizeT follower_count = followers.size();
-        SizeT learner_count = learners.size();
+    LOG_TRACE("Stream logs to follower and learner");
+    if (logs_to_sync_.empty()) {
+        return Status::OK();
+    }
+    // Get follower and learner node
+    Vector<SharedPtr<NodeInfo>> followers;
+    Vector<SharedPtr<PeerClient>> follower_clients;
+    Vector<SharedPtr<NodeInfo>> learners;
+    Vector<SharedPtr<PeerClient>> learner_clients;
+
+    Status status = GetReadersInfo(followers, follower_clients, learners, learner_clients);
+    if (!status.ok()) {
+        return status;
+    }
 
-        if (follower_count != follower_clients.size() && learner_count != learner_clients.size()) {
-            return Status::UnexpectedError("Node info and node client count isn't match");
-        }
+    SizeT follower_count = followers.size();
+    SizeT learner_count = learners.size();
 
-        // Replicate logs to follower
-        for (SizeT idx = 0; idx < follower_count; ++idx) {
-            const String &follower_name = followers[idx]->node_name();
-            if (!sent_nodes.contains(follower_name)) {
-                status = SendLogs(follower_name, follower_clients[idx], logs_to_sync_, true, false);
-                if (status.ok()) {
-                    sent_nodes.insert(follower_name);
-                }
-            }
-        }
+    if (follower_count != follower_clients.size() && learner_count != learner_clients.size()) {
+        return Status::UnexpectedError("Node info and node client count isn't match");
+    }
 
-        // Replicate logs to learner
-        for (SizeT idx = 0; idx < learner_count; ++idx) {
-            const String &learner_name = learners[idx]->node_name();
-            if (!sent_nodes.contains(learner_name)) {
-                status = SendLogs(learner_name, learner_clients[idx], logs_to_sync_, false, false);
-                if (status.ok()) {
-                    sent_nodes.insert(learner_name);
-                }
-            }
-        }
+    // The batch is streamed to all the nodes at once, a node which lags a window of unacked batches behind blocks the WAL flush.
+    // A follower acks the batch once it is durable there and applies it later. SyncLogs returns when a majority of the leader
+    // and the followers has the batch, the other followers ack it in the background. A node failing a batch is disconnected
+    // and syncs the logs it lacks on registration.
+    SizeT quorum_size = (follower_count + 1) / 2;
+    SharedPtr<SyncLogQuorum> quorum = MakeShared<SyncLogQuorum>(follower_count, quorum_size);
+    for (SizeT idx = 0; idx < follower_count; ++idx) {
+        follower_clients[idx]->StreamLogs(MakeShared<SyncLogTask>(followers[idx]->node_name(), logs_to_sync_, false, quorum));
+    }
+    for (SizeT idx = 0; idx < learner_count; ++idx) {
+        learner_clients[idx]->StreamLogs(MakeShared<SyncLogTask>(learners[idx]->node_name(), logs_to_sync_, false));
+    }
+    logs_to_sync_.clear();
 
-        if (sent_nodes.size() == follower_count + learner_count) {
-            logs_to_sync_.clear();
-            break;
-        }
+    if (!quorum->Wait()) {
+        return Status::InvalidNodeStatus(
+            fmt::format("Only {} of {} followers ack the log batch, {} acks are required", quorum->SuccessCount(), follower_count, quorum_size));
     }
     return Status::OK();
 }
@@ -488,21 +480,12 @@ Status ClusterManager::SetFollowerNumber(SizeT new_follower_number) {
 
 SizeT ClusterManager::GetFollowerLimit() const { return follower_limit_; }
 
-Status ClusterManager::SendLogs(const String &node_name,
-                                const SharedPtr<PeerClient> &peer_client,
-                                const Vector<SharedPtr<String>> &logs,
-                                bool synchronize,
-                                bool on_register) {
-    SharedPtr<SyncLogTask> sync_log_task = MakeShared<SyncLogTask>(node_name, logs, on_register);
+Status ClusterManager::SendLogs(const String &node_name, const SharedPtr<PeerClient> &peer_client, const Vector<SharedPtr<String>> &logs) {
+    SharedPtr<SyncLogTask> sync_log_task = MakeShared<SyncLogTask>(node_name, logs, true);
     peer_client->Send(sync_log_task);
+    sync_log_task->Wait();
 
     Status status = Status::OK();
-    if (synchronize) {
-        sync_log_task->Wait();
-    } else {
-        return status;
-    }
-
     if (sync_log_task->error_code_ != 0) {
         LOG_ERROR(fmt::format("Fail to send log follower: {}, error message: {}", node_name, sync_log_task->error_message_));
         status.code_ = static_cast<ErrorCode>(sync_log_task->error_code_);
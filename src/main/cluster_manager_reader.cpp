@@ -57,6 +57,7 @@ Status ClusterManager::InitAsFollower(const String &node_name, const String &lea
     }
 
     current_node_role_ = NodeRole::kFollower;
+    log_applier_thread_ = MakeShared<Thread>([this] { this->LogApplierThread(); });
 
     return Status::OK();
 }
@@ -88,6 +89,7 @@ Status ClusterManager::InitAsLearner(const String &node_name, const String &lead
     }
 
     current_node_role_ = NodeRole::kLearner;
+    log_applier_thread_ = MakeShared<Thread>([this] { this->LogApplierThread(); });
 
     return Status::OK();
 }
@@ -289,6 +291,7 @@ Status ClusterManager::ApplySyncedLogNolock(const Vector<String> &synced_logs) {
     WalManager *wal_manager = storage_ptr->wal_manager();
     TransactionID last_txn_id = 0;
     TxnTimeStamp last_commit_ts = 0;
+    bool replicate_index = InfinityContext::instance().config()->PeerReplicateIndex();
     for (auto &log_str : synced_logs) {
         const i32 entry_size = log_str.size();
         const char *ptr = log_str.data();
@@ -296,8 +299,14 @@ Status ClusterManager::ApplySyncedLogNolock(const Vector<String> &synced_logs) {
         LOG_DEBUG(fmt::format("WAL Entry: {}", entry->ToString()));
         last_txn_id = entry->txn_id_;
         last_commit_ts = entry->commit_ts_;
-        ReplayWalOptions options{.on_startup_ = false, .is_replay_ = false, .sync_from_leader_ = true};
-        wal_manager->ReplayWalEntry(*entry, options);
+        ReplayWalOptions options{.on_startup_ = false, .is_replay_ = false, .sync_from_leader_ = true, .replicate_index_ = replicate_index};
+        try {
+            wal_manager->ReplayWalEntry(*entry, options);
+        } catch (RecoverableException &e) {
+            // Reported to the leader in the next ack
+            LOG_ERROR(fmt::format("Fail to apply the log synced from leader: {}, error: {}", entry->ToString(), e.what()));
+            return Status(e.ErrorCode(), MakeUnique<String>(e.what()));
+        }
     }
 
     LOG_INFO(fmt::format("Replicated from leader: latest txn commit_ts: {}, latest txn id: {}", last_commit_ts, last_txn_id));
@@ -307,11 +316,58 @@ Status ClusterManager::ApplySyncedLogNolock(const Vector<String> &synced_logs) {
     return Status::OK();
 }
 
+Status ClusterManager::ApplySyncedLogAsync(Vector<String> synced_logs) {
+    Status status = Status::OK();
+    {
+        std::lock_guard<std::mutex> apply_lock(log_apply_mutex_);
+        std::swap(status, log_apply_status_);
+        ++received_log_batch_count_;
+    }
+    synced_log_queue_.Enqueue(MakeShared<Vector<String>>(std::move(synced_logs)));
+    return status;
+}
+
+void ClusterManager::WaitSyncedLogApplied() {
+    std::unique_lock<std::mutex> apply_lock(log_apply_mutex_);
+    log_apply_cv_.wait(apply_lock, [this] { return applied_log_batch_count_ == received_log_batch_count_; });
+}
+
+void ClusterManager::LogApplierThread() {
+    Vector<SharedPtr<Vector<String>>> synced_log_batches;
+    while (true) {
+        synced_log_queue_.DequeueBulk(synced_log_batches);
+        for (const auto &synced_logs : synced_log_batches) {
+            if (synced_logs.get() == nullptr) {
+                return;
+            }
+            Status status = ApplySyncedLogNolock(*synced_logs);
+            std::lock_guard<std::mutex> apply_lock(log_apply_mutex_);
+            if (!status.ok() && log_apply_status_.ok()) {
+                log_apply_status_ = std::move(status);
+            }
+            ++applied_log_batch_count_;
+            log_apply_cv_.notify_all();
+        }
+        synced_log_batches.clear();
+    }
+}
+
+void ClusterManager::StopLogApplier() {
+    if (log_applier_thread_.get() == nullptr) {
+        return;
+    }
+    // the logs received before are applied first
+    synced_log_queue_.Enqueue(SharedPtr<Vector<String>>());
+    log_applier_thread_->join();
+    log_applier_thread_.reset();
+}
+
 Status ClusterManager::ContinueStartup(const Vector<String> &synced_logs) {
     Storage *storage_ptr = InfinityContext::instance().storage();
     WalManager *wal_manager = storage_ptr->wal_manager();
     bool is_checkpoint = true;
     TxnTimeStamp last_commit_ts;
+    bool replicate_index = InfinityContext::instance().config()->PeerReplicateIndex();
     for (auto &log_str : synced_logs) {
         const i32 entry_size = log_str.size();
         const char *ptr = log_str.data();
@@ -328,7 +384,7 @@ Status ClusterManager::ContinueStartup(const Vector<String> &synced_logs) {
             }
         }
         LOG_DEBUG(fmt::format("WAL Entry: {}", entry->ToString()));
-        ReplayWalOptions options{.on_startup_ = true, .is_replay_ = false, .sync_from_leader_ = true};
+        ReplayWalOptions options{.on_startup_ = true, .is_replay_ = false, .sync_from_leader_ = true, .replicate_index_ = replicate_index};
         wal_manager->ReplayWalEntry(*entry, options);
         last_commit_ts = entry->commit_ts_;
     }
@@ -299,6 +299,15 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Peer replicate index
+        bool peer_replicate_index = DEFAULT_PEER_REPLICATE_INDEX;
+        UniquePtr<BooleanOption> peer_replicate_index_option = MakeUnique<BooleanOption>(PEER_REPLICATE_INDEX_OPTION_NAME, peer_replicate_index);
+        status = global_options_.AddOption(std::move(peer_replicate_index_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Client pool size
         i64 connection_pool_size = 256;
         UniquePtr<IntegerOption> connection_pool_size_option =
@@ -505,6 +514,19 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Memory index quota of each index type and of each table, 0 means no quota
+        for (std::string_view option_name : {DENSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                             SPARSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                             FULLTEXT_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                             TABLE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME}) {
+            UniquePtr<IntegerOption> index_type_memory_quota_option = MakeUnique<IntegerOption>(option_name, 0, std::numeric_limits<i64>::max(), 0);
+            status = global_options_.AddOption(std::move(index_type_memory_quota_option));
+            if (!status.ok()) {
+                fmt::print("Fatal: {}", status.message());
+                UnrecoverableError(status.message());
+            }
+        }
+
         // Dense index building worker
         i64 dense_index_building_worker = Thread::hardware_concurrency() / 2;
         if (dense_index_building_worker < 2) {
@@ -557,6 +579,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Mem index dump worker
+        i64 memindex_dump_worker = DEFAULT_MEMINDEX_DUMP_WORKER;
+        UniquePtr<IntegerOption> memindex_dump_worker_option =
+            MakeUnique<IntegerOption>(MEMINDEX_DUMP_WORKER_OPTION_NAME, memindex_dump_worker, std::numeric_limits<i64>::max(), 1);
+        status = global_options_.AddOption(std::move(memindex_dump_worker_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Result Cache
         String result_cache(DEFAULT_RESULT_CACHE);
         auto result_cache_option = MakeUnique<StringOption>(RESULT_CACHE_OPTION_NAME, result_cache);
@@ -1102,6 +1134,23 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kPeerReplicateIndex: {
+                            // Peer replicate index
+                            bool peer_replicate_index = DEFAULT_PEER_REPLICATE_INDEX;
+                            if (elem.second.is_boolean()) {
+                                peer_replicate_index = elem.second.value_or(peer_replicate_index);
+                            } else {
+                                return Status::InvalidConfig("'peer_replicate_index' field isn't boolean.");
+                            }
+
+                            UniquePtr<BooleanOption> peer_replicate_index_option =
+                                MakeUnique<BooleanOption>(PEER_REPLICATE_INDEX_OPTION_NAME, peer_replicate_index);
+                            Status status = global_options_.AddOption(std::move(peer_replicate_index_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         case GlobalOptionIndex::kConnectionPoolSize: {
                             // Client pool size
                             i64 connection_pool_size = 256;
@@ -1266,6 +1315,17 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                     }
                 }
 
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kPeerReplicateIndex) == nullptr) {
+                    // Peer replicate index
+                    bool peer_replicate_index = DEFAULT_PEER_REPLICATE_INDEX;
+                    UniquePtr<BooleanOption> peer_replicate_index_option =
+                        MakeUnique<BooleanOption>(PEER_REPLICATE_INDEX_OPTION_NAME, peer_replicate_index);
+                    Status status = global_options_.AddOption(std::move(peer_replicate_index_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
                 if (global_options_.GetOptionByIndex(GlobalOptionIndex::kConnectionPoolSize) == nullptr) {
                     // Client pool size
                     i64 connection_pool_size = 256;
@@ -1821,6 +1881,44 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                                         }
                                         break;
                                     }
+                                    case GlobalOptionIndex::kObjectStorageDiskCacheLimit: {
+                                        i64 disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT;
+                                        if (elem.second.is_string()) {
+                                            String disk_cache_limit_str = elem.second.value_or(DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT_STR.data());
+                                            auto res = ParseByteSize(disk_cache_limit_str, disk_cache_limit);
+                                            if (!res.ok()) {
+                                                return res;
+                                            }
+                                        } else {
+                                            return Status::InvalidConfig(
+                                                "'disk_cache_limit' field in [storage.object_storage] isn't string, such as \"128GB\"");
+                                        }
+                                        UniquePtr<IntegerOption> disk_cache_limit_option =
+                                            MakeUnique<IntegerOption>(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME,
+                                                                      disk_cache_limit,
+                                                                      std::numeric_limits<i64>::max(),
+                                                                      0);
+                                        global_options_.AddOption(std::move(disk_cache_limit_option));
+                                        break;
+                                    }
+                                    case GlobalOptionIndex::kObjectStorageDiskCachePinPolicy: {
+                                        String pin_policy = String(DEFAULT_OBJECT_STORAGE_DISK_CACHE_PIN_POLICY);
+                                        if (elem.second.is_string()) {
+                                            pin_policy = elem.second.value_or(pin_policy);
+                                        } else {
+                                            return Status::InvalidConfig("'disk_cache_pin_policy' field in [storage.object_storage] isn't string");
+                                        }
+                                        ToLower(pin_policy);
+                                        if (pin_policy != "none" && pin_policy != "index" && pin_policy != "data") {
+                                            String error_message =
+                                                fmt::format("Invalid disk cache pin policy: {}, should be none, index or data", pin_policy);
+                                            return Status::InvalidConfig(error_message);
+                                        }
+                                        auto pin_policy_option =
+                                            MakeUnique<StringOption>(OBJECT_STORAGE_DISK_CACHE_PIN_POLICY_OPTION_NAME, pin_policy);
+                                        global_options_.AddOption(std::move(pin_policy_option));
+                                        break;
+                                    }
                                     default: {
                                         return Status::InvalidConfig(
                                             fmt::format("Unrecognized config parameter: {} in 'storage.object_storage' field", var_name));
@@ -1848,6 +1946,26 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             if (global_options_.GetOptionByIndex(GlobalOptionIndex::kObjectStorageHttps) == nullptr) {
                                 return Status::InvalidConfig("No 'enable_https' field in [storage.object_storage]");
                             }
+                            if (global_options_.GetOptionByIndex(GlobalOptionIndex::kObjectStorageDiskCacheLimit) == nullptr) {
+                                i64 disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT;
+                                UniquePtr<IntegerOption> disk_cache_limit_option =
+                                    MakeUnique<IntegerOption>(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME,
+                                                              disk_cache_limit,
+                                                              std::numeric_limits<i64>::max(),
+                                                              0);
+                                Status status = global_options_.AddOption(std::move(disk_cache_limit_option));
+                                if (!status.ok()) {
+                                    UnrecoverableError(status.message());
+                                }
+                            }
+                            if (global_options_.GetOptionByIndex(GlobalOptionIndex::kObjectStorageDiskCachePinPolicy) == nullptr) {
+                                auto pin_policy_option = MakeUnique<StringOption>(OBJECT_STORAGE_DISK_CACHE_PIN_POLICY_OPTION_NAME,
+                                                                                  DEFAULT_OBJECT_STORAGE_DISK_CACHE_PIN_POLICY);
+                                Status status = global_options_.AddOption(std::move(pin_policy_option));
+                                if (!status.ok()) {
+                                    UnrecoverableError(status.message());
+                                }
+                            }
                             break;
                         }
 
@@ -1925,6 +2043,21 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(bottom_executor_worker_option));
                             break;
                         }
+                        case GlobalOptionIndex::kMemIndexDumpWorker: {
+                            i64 memindex_dump_worker = DEFAULT_MEMINDEX_DUMP_WORKER;
+                            if (elem.second.is_integer()) {
+                                memindex_dump_worker = elem.second.value_or(memindex_dump_worker);
+                            } else {
+                                return Status::InvalidConfig("'memindex_dump_worker' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> memindex_dump_worker_option =
+                                MakeUnique<IntegerOption>(MEMINDEX_DUMP_WORKER_OPTION_NAME, memindex_dump_worker, std::numeric_limits<i64>::max(), 1);
+                            if (!memindex_dump_worker_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid mem index dump worker number: {}", memindex_dump_worker));
+                            }
+                            global_options_.AddOption(std::move(memindex_dump_worker_option));
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -2096,6 +2229,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kMemIndexDumpWorker) == nullptr) {
+                    // mem index dump worker
+                    i64 memindex_dump_worker = DEFAULT_MEMINDEX_DUMP_WORKER;
+                    UniquePtr<IntegerOption> memindex_dump_worker_option =
+                        MakeUnique<IntegerOption>(MEMINDEX_DUMP_WORKER_OPTION_NAME, memindex_dump_worker, std::numeric_limits<i64>::max(), 1);
+                    Status status = global_options_.AddOption(std::move(memindex_dump_worker_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -2178,6 +2321,25 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(mem_index_memory_quota_option));
                             break;
                         }
+                        case GlobalOptionIndex::kDenseMemIndexMemoryQuota:
+                        case GlobalOptionIndex::kSparseMemIndexMemoryQuota:
+                        case GlobalOptionIndex::kFulltextMemIndexMemoryQuota:
+                        case GlobalOptionIndex::kTableMemIndexMemoryQuota: {
+                            i64 index_type_memory_quota = 0;
+                            if (elem.second.is_string()) {
+                                String index_type_memory_quota_str = elem.second.value_or("0MB");
+                                auto res = ParseByteSize(index_type_memory_quota_str, index_type_memory_quota);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig(fmt::format("'{}' field isn't string, such as \"1GB\"", var_name));
+                            }
+                            UniquePtr<IntegerOption> index_type_memory_quota_option =
+                                MakeUnique<IntegerOption>(var_name, index_type_memory_quota, std::numeric_limits<i64>::max(), 0);
+                            global_options_.AddOption(std::move(index_type_memory_quota_option));
+                            break;
+                        }
                         case GlobalOptionIndex::kResultCache: {
                             String result_cache_str(DEFAULT_RESULT_CACHE);
                             if (elem.second.is_string()) {
@@ -2246,6 +2408,20 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+                for (std::string_view option_name : {DENSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                                     SPARSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                                     FULLTEXT_MEMINDEX_MEMORY_QUOTA_OPTION_NAME,
+                                                     TABLE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME}) {
+                    if (global_options_.GetOptionByIndex(global_options_.GetOptionIndex(String(option_name))) == nullptr) {
+                        // Mem Index Memory Quota of the index type or the table
+                        UniquePtr<IntegerOption> index_type_memory_quota_option =
+                            MakeUnique<IntegerOption>(option_name, 0, std::numeric_limits<i64>::max(), 0);
+                        Status status = global_options_.AddOption(std::move(index_type_memory_quota_option));
+                        if (!status.ok()) {
+                            UnrecoverableError(status.message());
+                        }
+                    }
+                }
                 if (global_options_.GetOptionByIndex(GlobalOptionIndex::kResultCache) == nullptr) {
                     // Result Cache Mode
                     String result_cache_str(DEFAULT_RESULT_CACHE);
@@ -2599,6 +2775,11 @@ i64 Config::PeerSendTimeout() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kPeerSendTimeout);
 }
 
+bool Config::PeerReplicateIndex() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetBoolValue(GlobalOptionIndex::kPeerReplicateIndex);
+}
+
 // Log
 String Config::LogFileName() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2762,6 +2943,11 @@ i64 Config::BottomExecutorWorker() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kBottomExecutorWorker);
 }
 
+i64 Config::MemIndexDumpWorker() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexDumpWorker);
+}
+
 StorageType Config::StorageType() {
     std::lock_guard<std::mutex> guard(mutex_);
     String storage_type_str = global_options_.GetStringValue(GlobalOptionIndex::kStorageType);
@@ -2793,6 +2979,16 @@ bool Config::ObjectStorageHttps() {
     return global_options_.GetBoolValue(GlobalOptionIndex::kObjectStorageHttps);
 }
 
+i64 Config::ObjectStorageDiskCacheLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kObjectStorageDiskCacheLimit);
+}
+
+String Config::ObjectStorageDiskCachePinPolicy() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetStringValue(GlobalOptionIndex::kObjectStorageDiskCachePinPolicy);
+}
+
 // Persistence
 String Config::PersistenceDir() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2831,6 +3027,26 @@ i64 Config::MemIndexMemoryQuota() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexMemoryQuota);
 }
 
+i64 Config::DenseMemIndexMemoryQuota() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kDenseMemIndexMemoryQuota);
+}
+
+i64 Config::SparseMemIndexMemoryQuota() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kSparseMemIndexMemoryQuota);
+}
+
+i64 Config::FulltextMemIndexMemoryQuota() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kFulltextMemIndexMemoryQuota);
+}
+
+i64 Config::TableMemIndexMemoryQuota() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kTableMemIndexMemoryQuota);
+}
+
 String Config::ResultCache() {
     std::lock_guard<std::mutex> guard(mutex_);
     return global_options_.GetStringValue(GlobalOptionIndex::kResultCache);
@@ -2977,6 +3193,7 @@ void Config::PrintAll() {
     fmt::print(" - dense_index_building_worker: {}\n", DenseIndexBuildingWorker());
     fmt::print(" - sparse_index_building_worker: {}\n", SparseIndexBuildingWorker());
     fmt::print(" - fulltext_index_building_worker: {}\n", FulltextIndexBuildingWorker());
+    fmt::print(" - memindex_dump_worker: {}\n", MemIndexDumpWorker());
     fmt::print(" - storage_type: {}\n", ToString(StorageType()));
     switch (StorageType()) {
         case StorageType::kLocal: {
@@ -2988,6 +3205,8 @@ void Config::PrintAll() {
             fmt::print(" - object_storage_access_key: {}\n", ObjectStorageAccessKey());
             fmt::print(" - object_storage_secret_key: {}\n", ObjectStorageSecretKey());
             fmt::print(" - object_storage_enable_https: {}\n", ObjectStorageHttps());
+            fmt::print(" - object_storage_disk_cache_limit: {}\n", Utility::FormatByteSize(ObjectStorageDiskCacheLimit()));
+            fmt::print(" - object_storage_disk_cache_pin_policy: {}\n", ObjectStorageDiskCachePinPolicy());
             break;
         }
         default: {
@@ -3000,6 +3219,10 @@ void Config::PrintAll() {
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
     fmt::print(" - temp_dir: {}\n", TempDir());
     fmt::print(" - memindex_memory_quota: {}\n", Utility::FormatByteSize(MemIndexMemoryQuota()));
+    fmt::print(" - dense_memindex_memory_quota: {}\n", Utility::FormatByteSize(DenseMemIndexMemoryQuota()));
+    fmt::print(" - sparse_memindex_memory_quota: {}\n", Utility::FormatByteSize(SparseMemIndexMemoryQuota()));
+    fmt::print(" - fulltext_memindex_memory_quota: {}\n", Utility::FormatByteSize(FulltextMemIndexMemoryQuota()));
+    fmt::print(" - table_memindex_memory_quota: {}\n", Utility::FormatByteSize(TableMemIndexMemoryQuota()));
 
     // WAL
     fmt::print(" - wal_dir: {}\n", WALDir());
@@ -80,6 +80,9 @@ public:
     i64 PeerRecvTimeout();
     i64 PeerSendTimeout();
 
+    // Followers and learners load the index chunks dumped by the leader instead of building the indexes of the synced rows.
+    bool PeerReplicateIndex();
+
     // Log
     String LogFileName();
     String LogDir();
@@ -114,6 +117,7 @@ public:
     i64 SparseIndexBuildingWorker();
     i64 FulltextIndexBuildingWorker();
     i64 BottomExecutorWorker();
+    i64 MemIndexDumpWorker();
 
     StorageType StorageType();
     String ObjectStorageUrl();
@@ -121,6 +125,8 @@ public:
     String ObjectStorageAccessKey();
     String ObjectStorageSecretKey();
     bool ObjectStorageHttps();
+    i64 ObjectStorageDiskCacheLimit();
+    String ObjectStorageDiskCachePinPolicy();
 
     // Persistence
     String PersistenceDir();
@@ -133,6 +139,10 @@ public:
     String TempDir();
 
     i64 MemIndexMemoryQuota();
+    i64 DenseMemIndexMemoryQuota();
+    i64 SparseMemIndexMemoryQuota();
+    i64 FulltextMemIndexMemoryQuota();
+    i64 TableMemIndexMemoryQuota();
 
     String ResultCache();
     i64 CacheResultNum();
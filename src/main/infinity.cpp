@@ -82,7 +82,7 @@ std::variant<UniquePtr<QueryContext>, QueryResult> Infinity::GetQueryContext(boo
         query_result.status_ = Status::InfinityIsStarting();
         return query_result;
     }
-    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get(), true);
     query_context_ptr->Init(InfinityContext::instance().config(),
                             InfinityContext::instance().task_scheduler(),
                             InfinityContext::instance().storage(),
@@ -504,7 +504,7 @@ QueryResult Infinity::ShowTables(const String &db_name) {
 }
 
 QueryResult Infinity::GetTable(const String &db_name, const String &table_name) {
-    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get(), true);
     query_context_ptr->set_current_schema(db_name);
     query_context_ptr->Init(InfinityContext::instance().config(),
                             InfinityContext::instance().task_scheduler(),
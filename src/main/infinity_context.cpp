@@ -74,6 +74,7 @@ void InfinityContext::InitPhase1(const SharedPtr<String> &config_path, DefaultCo
     }
 
     resource_manager_ = MakeUnique<ResourceManager>(config_->CPULimit(), 0);
+    query_thread_pool_.resize(config_->CPULimit());
 
     session_mgr_ = MakeUnique<SessionManager>();
 
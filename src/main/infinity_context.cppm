@@ -51,6 +51,7 @@ public:
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetHnswBuildThreadPool() { return hnsw_build_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetQueryThreadPool() { return query_thread_pool_; }
 
     NodeRole GetServerRole() const;
 
@@ -98,6 +99,9 @@ private:
     // For hnsw index
     ThreadPool hnsw_build_thread_pool_{2};
 
+    // For the ranges of one query scored in parallel, e.g. match tensor rerank
+    ThreadPool query_thread_pool_{2};
+
     std::function<void()> start_servers_func_{};
     std::function<void()> stop_servers_func_{};
     atomic_bool start_server_{false};
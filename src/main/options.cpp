@@ -42,6 +42,7 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(PEER_CONNECT_TIMEOUT_OPTION_NAME)] = GlobalOptionIndex::kPeerConnectTimeout;
     name2index_[String(PEER_RECV_TIMEOUT_OPTION_NAME)] = GlobalOptionIndex::kPeerRecvTimeout;
     name2index_[String(PEER_SEND_TIMEOUT_OPTION_NAME)] = GlobalOptionIndex::kPeerSendTimeout;
+    name2index_[String(PEER_REPLICATE_INDEX_OPTION_NAME)] = GlobalOptionIndex::kPeerReplicateIndex;
 
     name2index_[String(POSTGRES_PORT_OPTION_NAME)] = GlobalOptionIndex::kPostgresPort;
     name2index_[String(HTTP_PORT_OPTION_NAME)] = GlobalOptionIndex::kHTTPPort;
@@ -74,16 +75,23 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(OBJECT_STORAGE_ACCESS_KEY_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageAccessKey;
     name2index_[String(OBJECT_STORAGE_SECRET_KEY_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageSecretKey;
     name2index_[String(OBJECT_STORAGE_ENABLE_HTTPS_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageHttps;
+    name2index_[String(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageDiskCacheLimit;
+    name2index_[String(OBJECT_STORAGE_DISK_CACHE_PIN_POLICY_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageDiskCachePinPolicy;
 
     name2index_[String(BUFFER_MANAGER_SIZE_OPTION_NAME)] = GlobalOptionIndex::kBufferManagerSize;
     name2index_[String(LRU_NUM_OPTION_NAME)] = GlobalOptionIndex::kLRUNum;
     name2index_[String(TEMP_DIR_OPTION_NAME)] = GlobalOptionIndex::kTempDir;
     name2index_[String(MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kMemIndexMemoryQuota;
+    name2index_[String(DENSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kDenseMemIndexMemoryQuota;
+    name2index_[String(SPARSE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kSparseMemIndexMemoryQuota;
+    name2index_[String(FULLTEXT_MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kFulltextMemIndexMemoryQuota;
+    name2index_[String(TABLE_MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kTableMemIndexMemoryQuota;
 
     name2index_[String(DENSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kDenseIndexBuildingWorker;
     name2index_[String(SPARSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kSparseIndexBuildingWorker;
     name2index_[String(FULLTEXT_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kFulltextIndexBuildingWorker;
     name2index_[String(BOTTOM_EXECUTOR_WORKER_OPTION_NAME)] = GlobalOptionIndex::kBottomExecutorWorker;
+    name2index_[String(MEMINDEX_DUMP_WORKER_OPTION_NAME)] = GlobalOptionIndex::kMemIndexDumpWorker;
 
     name2index_[String(RESULT_CACHE_OPTION_NAME)] = GlobalOptionIndex::kResultCache;
     name2index_[String(CACHE_RESULT_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kCacheResultCapacity;
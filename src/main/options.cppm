@@ -173,7 +173,15 @@ export enum class GlobalOptionIndex : i8 {
     kSnapshotDir = 54,
     kCatalogDir = 55,
     kReplayWal = 56,
-    kInvalid = 57,
+    kPeerReplicateIndex = 57,
+    kMemIndexDumpWorker = 58,
+    kDenseMemIndexMemoryQuota = 59,
+    kSparseMemIndexMemoryQuota = 60,
+    kFulltextMemIndexMemoryQuota = 61,
+    kObjectStorageDiskCacheLimit = 62,
+    kObjectStorageDiskCachePinPolicy = 63,
+    kTableMemIndexMemoryQuota = 64,
+    kInvalid = 65,
 };
 
 export struct GlobalOptions {
@@ -58,6 +58,10 @@ import persistence_manager;
 import global_resource_usage;
 import infinity_context;
 import txn_state;
+import data_table;
+import column_def;
+import data_type;
+import query_planners;
 
 import new_txn;
 import new_txn_manager;
@@ -65,13 +69,18 @@ import new_catalog;
 
 namespace infinity {
 
-QueryContext::QueryContext(BaseSession *session) : session_ptr_(session) {
+QueryContext::QueryContext(BaseSession *session, bool recycle_planners) : session_ptr_(session), recycle_planners_(recycle_planners) {
 #ifdef INFINITY_DEBUG
     GlobalResourceUsage::IncrObjectCount("QueryContext");
 #endif
 }
 
 QueryContext::~QueryContext() {
+    if (recycle_planners_ && planners_ != nullptr && session_ptr_ != nullptr) {
+        // don't keep the plans of this query alive in the session
+        planners_->Reset(nullptr);
+        session_ptr_->RecycleQueryPlanners(std::move(planners_));
+    }
     UnInit();
 #ifdef INFINITY_DEBUG
     GlobalResourceUsage::DecrObjectCount("QueryContext");
@@ -95,11 +104,14 @@ void QueryContext::Init(Config *global_config_ptr,
     cpu_number_limit_ = resource_manager_ptr->GetCpuResource();
     memory_size_limit_ = resource_manager_ptr->GetMemoryResource();
 
-    parser_ = MakeUnique<SQLParser>();
-    logical_planner_ = MakeUnique<LogicalPlanner>(this);
-    optimizer_ = MakeUnique<Optimizer>(this);
-    physical_planner_ = MakeUnique<PhysicalPlanner>(this);
-    fragment_builder_ = MakeUnique<FragmentBuilder>(this);
+    if (recycle_planners_) {
+        planners_ = session_ptr_->TakeQueryPlanners();
+    }
+    if (planners_ != nullptr && planners_->Reusable(this)) {
+        planners_->Reset(this);
+    } else {
+        planners_ = MakeUnique<QueryPlanners>(this);
+    }
 }
 
 QueryResult QueryContext::Query(const String &query) {
@@ -107,7 +119,7 @@ QueryResult QueryContext::Query(const String &query) {
 
     StartProfile(QueryPhase::kParser);
     UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
-    parser_->Parse(query, parsed_result.get());
+    parser()->Parse(query, parsed_result.get());
 
     if (parsed_result->IsError()) {
         StopProfile(QueryPhase::kParser);
@@ -233,27 +245,27 @@ QueryResult QueryContext::QueryStatementInternal(const BaseStatement *base_state
         // Build unoptimized logical plan for each SQL base_statement.
         StartProfile(QueryPhase::kLogicalPlan);
         SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(base_statement, bind_context);
+        auto status = logical_planner()->Build(base_statement, bind_context);
         // FIXME
         if (!status.ok()) {
             RecoverableError(status);
         }
 
         current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        logical_plans = logical_planner_->LogicalPlans();
+        logical_plans = logical_planner()->LogicalPlans();
         StopProfile(QueryPhase::kLogicalPlan);
         //        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
         // Apply optimized rule to the logical plan
         StartProfile(QueryPhase::kOptimizer);
         for (auto &logical_plan : logical_plans) {
-            optimizer_->optimize(logical_plan, base_statement->type_);
+            optimizer()->optimize(logical_plan, base_statement->type_);
         }
         StopProfile(QueryPhase::kOptimizer);
 
         // Build physical plan
         StartProfile(QueryPhase::kPhysicalPlan);
         for (auto &logical_plan : logical_plans) {
-            auto physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
+            auto physical_plan = physical_planner()->BuildPhysicalOperator(logical_plan);
             physical_plans.push_back(std::move(physical_plan));
         }
         StopProfile(QueryPhase::kPhysicalPlan);
@@ -265,7 +277,7 @@ QueryResult QueryContext::QueryStatementInternal(const BaseStatement *base_state
             for (auto &physical_plan : physical_plans) {
                 physical_plan_ptrs.push_back(physical_plan.get());
             }
-            plan_fragment = fragment_builder_->BuildFragment(physical_plan_ptrs);
+            plan_fragment = fragment_builder()->BuildFragment(physical_plan_ptrs);
         }
         StopProfile(QueryPhase::kPipelineBuild);
 
@@ -378,19 +390,79 @@ void QueryContext::StopProfile() {
     }
 }
 
+QueryResult QueryContext::DescribeStatement(const BaseStatement *base_statement) {
+    QueryResult query_result;
+    switch (base_statement->type_) {
+        case StatementType::kSelect:
+        case StatementType::kShow:
+        case StatementType::kExplain: {
+            break;
+        }
+        default: {
+            query_result.result_table_ = nullptr;
+            return query_result;
+        }
+    }
+    if (!InfinityContext::instance().InfinityContextStarted()) {
+        query_result.result_table_ = nullptr;
+        query_result.status_ = Status::InfinityIsStarting();
+        return query_result;
+    }
+
+    try {
+        this->BeginTxn(base_statement);
+        SharedPtr<BindContext> bind_context;
+        auto status = logical_planner()->Build(base_statement, bind_context);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        const SharedPtr<LogicalNode> &root = logical_planner()->LogicalPlans().back();
+        SharedPtr<Vector<String>> column_names = root->GetOutputNames();
+        SharedPtr<Vector<SharedPtr<DataType>>> column_types = root->GetOutputTypes();
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        column_defs.reserve(column_names->size());
+        for (SizeT col_idx = 0; col_idx < column_names->size(); ++col_idx) {
+            column_defs.emplace_back(
+                MakeShared<ColumnDef>(col_idx, column_types->at(col_idx), column_names->at(col_idx), std::set<ConstraintType>()));
+        }
+        query_result.result_table_ = DataTable::MakeResultTable(column_defs);
+        query_result.root_operator_type_ = root->operator_type();
+        // nothing is executed, the txn only pins the catalog for binding
+        this->RollbackTxn();
+
+    } catch (RecoverableException &e) {
+
+        NewTxn *new_txn = this->GetNewTxn();
+        if (new_txn != nullptr) {
+            TxnState txn_state = new_txn->GetTxnState();
+            if (txn_state == TxnState::kRollbacking or txn_state == TxnState::kStarted) {
+                this->RollbackTxn();
+            }
+        }
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+
+    } catch (ParserException &e) {
+
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(ErrorCode::kParserError, e.what());
+    }
+    return query_result;
+}
+
 bool QueryContext::ExecuteBGStatement(BaseStatement *base_statement, BGQueryState &state) {
     QueryResult query_result;
     try {
         SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(base_statement, bind_context);
+        auto status = logical_planner()->Build(base_statement, bind_context);
         if (!status.ok()) {
             RecoverableError(status);
         }
         current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        state.logical_plans = logical_planner_->LogicalPlans();
+        state.logical_plans = logical_planner()->LogicalPlans();
 
         for (auto &logical_plan : state.logical_plans) {
-            auto physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
+            auto physical_plan = physical_planner()->BuildPhysicalOperator(logical_plan);
             state.physical_plans.push_back(std::move(physical_plan));
         }
 
@@ -399,7 +471,7 @@ bool QueryContext::ExecuteBGStatement(BaseStatement *base_statement, BGQueryStat
             for (auto &physical_plan : state.physical_plans) {
                 physical_plan_ptrs.push_back(physical_plan.get());
             }
-            state.plan_fragment = fragment_builder_->BuildFragment(physical_plan_ptrs);
+            state.plan_fragment = fragment_builder()->BuildFragment(physical_plan_ptrs);
         }
 
         state.notifier = MakeUnique<Notifier>();
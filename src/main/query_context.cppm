@@ -31,6 +31,7 @@ import status;
 import query_result;
 import base_statement;
 import admin_statement;
+import query_planners;
 
 export module query_context;
 
@@ -47,7 +48,9 @@ struct BGQueryState;
 export class QueryContext {
 
 public:
-    explicit QueryContext(BaseSession *session);
+    // recycle_planners: take the parser and planners of the last query of the session and give them back when this
+    // context is destroyed, the session must outlive the context.
+    explicit QueryContext(BaseSession *session, bool recycle_planners = false);
 
     ~QueryContext();
 
@@ -74,6 +77,10 @@ public:
 
     QueryResult QueryStatementInternal(const BaseStatement *statement);
 
+    // The result columns of a statement returning rows, from its logical plan without executing it. result_table_ is an
+    // empty table of the columns, null with an ok status if the statement returns no rows.
+    QueryResult DescribeStatement(const BaseStatement *statement);
+
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
 
     bool JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts, bool rollback = false);
@@ -121,11 +128,11 @@ public:
 
     [[nodiscard]] inline PersistenceManager *persistence_manager() { return persistence_manager_; }
 
-    [[nodiscard]] inline SQLParser *parser() const { return parser_.get(); }
-    [[nodiscard]] inline LogicalPlanner *logical_planner() const { return logical_planner_.get(); }
-    [[nodiscard]] inline Optimizer *optimizer() const { return optimizer_.get(); }
-    [[nodiscard]] inline PhysicalPlanner *physical_planner() const { return physical_planner_.get(); }
-    [[nodiscard]] inline FragmentBuilder *fragment_builder() const { return fragment_builder_.get(); }
+    [[nodiscard]] inline SQLParser *parser() const { return planners_->parser_.get(); }
+    [[nodiscard]] inline LogicalPlanner *logical_planner() const { return planners_->logical_planner_.get(); }
+    [[nodiscard]] inline Optimizer *optimizer() const { return planners_->optimizer_.get(); }
+    [[nodiscard]] inline PhysicalPlanner *physical_planner() const { return planners_->physical_planner_.get(); }
+    [[nodiscard]] inline FragmentBuilder *fragment_builder() const { return planners_->fragment_builder_.get(); }
     [[nodiscard]] inline QueryProfiler *query_profiler() const { return query_profiler_.get(); }
 
     [[nodiscard]] BaseSession *current_session() const { return session_ptr_; }
@@ -148,12 +155,9 @@ private:
     void StopProfile();
 
 private:
-    // Parser
-    UniquePtr<SQLParser> parser_{};
-    UniquePtr<LogicalPlanner> logical_planner_{};
-    UniquePtr<Optimizer> optimizer_{};
-    UniquePtr<PhysicalPlanner> physical_planner_{};
-    UniquePtr<FragmentBuilder> fragment_builder_{};
+    // Parser and planners
+    UniquePtr<QueryPlanners> planners_{};
+    bool recycle_planners_{false};
 
     SharedPtr<QueryProfiler> query_profiler_{};
     bool explain_analyze_{};
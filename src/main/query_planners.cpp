@@ -0,0 +1,48 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module query_planners;
+
+import stl;
+import sql_parser;
+import query_context;
+import storage;
+import logical_planner;
+import optimizer;
+import physical_planner;
+import fragment_builder;
+
+namespace infinity {
+
+QueryPlanners::QueryPlanners(QueryContext *query_context)
+    : parser_(MakeUnique<SQLParser>()), logical_planner_(MakeUnique<LogicalPlanner>(query_context)), optimizer_(MakeUnique<Optimizer>(query_context)),
+      physical_planner_(MakeUnique<PhysicalPlanner>(query_context)), fragment_builder_(MakeUnique<FragmentBuilder>(query_context)),
+      with_result_cache_(query_context->storage()->result_cache_manager() != nullptr) {}
+
+QueryPlanners::~QueryPlanners() = default;
+
+bool QueryPlanners::Reusable(QueryContext *query_context) const {
+    return with_result_cache_ == (query_context->storage()->result_cache_manager() != nullptr);
+}
+
+void QueryPlanners::Reset(QueryContext *query_context) {
+    logical_planner_->Reset(query_context);
+    optimizer_->query_context_ptr_ = query_context;
+    physical_planner_->Reset(query_context);
+    fragment_builder_->Reset(query_context);
+}
+
+} // namespace infinity
@@ -0,0 +1,52 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module query_planners;
+
+import stl;
+import sql_parser;
+
+namespace infinity {
+
+class QueryContext;
+class LogicalPlanner;
+class Optimizer;
+class PhysicalPlanner;
+class FragmentBuilder;
+
+// The parser and planners of a query context. Constructing them (the lexer, the optimizer rules) costs several
+// allocations per query, so a session keeps the set of its last finished query and hands it to the next one.
+export struct QueryPlanners {
+    explicit QueryPlanners(QueryContext *query_context);
+
+    ~QueryPlanners();
+
+    // Whether the set may serve a query context, the optimizer rules depend on the result cache being enabled.
+    bool Reusable(QueryContext *query_context) const;
+
+    // Rebinds the planners to query_context and drops the state of the previous query.
+    void Reset(QueryContext *query_context);
+
+    UniquePtr<SQLParser> parser_{};
+    UniquePtr<LogicalPlanner> logical_planner_{};
+    UniquePtr<Optimizer> optimizer_{};
+    UniquePtr<PhysicalPlanner> physical_planner_{};
+    UniquePtr<FragmentBuilder> fragment_builder_{};
+
+    bool with_result_cache_{};
+};
+
+} // namespace infinity
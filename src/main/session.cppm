@@ -22,6 +22,7 @@ import config;
 import options;
 import profiler;
 import global_resource_usage;
+import query_planners;
 
 namespace infinity {
 
@@ -62,6 +63,17 @@ public:
 
     String ConnectedTimeToStr() const { return std::asctime(std::localtime(&connected_time_)); }
 
+    // The planners of the last finished query, nullptr when a query of the session is running.
+    UniquePtr<QueryPlanners> TakeQueryPlanners() {
+        std::lock_guard lock(planners_mtx_);
+        return std::move(query_planners_);
+    }
+
+    void RecycleQueryPlanners(UniquePtr<QueryPlanners> query_planners) {
+        std::lock_guard lock(planners_mtx_);
+        query_planners_ = std::move(query_planners);
+    }
+
 protected:
     std::time_t connected_time_;
 
@@ -80,6 +92,9 @@ protected:
 
     u64 committed_txn_count_{0};
     u64 rollbacked_txn_count_{0};
+
+    std::mutex planners_mtx_{};
+    UniquePtr<QueryPlanners> query_planners_{};
 };
 
 export class LocalSession : public BaseSession {
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <boost/asio/ip/tcp.hpp>
 
 module connection;
@@ -40,9 +41,37 @@ import embedding_info;
 import sparse_info;
 import data_type;
 import global_resource_usage;
+import pg_binary_format;
+import pg_extended_query;
+import parser_result;
+import sql_parser;
+import base_statement;
+import config;
+import status;
 
 namespace infinity {
 
+namespace {
+
+Vector<PGFormatCode> ResolveResultFormats(const Vector<i16> &format_codes, const DataTable &result_table) {
+    SizeT column_count = result_table.ColumnCount();
+    Vector<PGFormatCode> formats(column_count, PGFormatCode::kText);
+    for (SizeT idx = 0; idx < column_count; ++idx) {
+        i16 format_code = 0;
+        if (format_codes.size() == 1) {
+            format_code = format_codes[0];
+        } else if (idx < format_codes.size()) {
+            format_code = format_codes[idx];
+        }
+        if (format_code == static_cast<i16>(PGFormatCode::kBinary) && PGSupportsBinary(*result_table.GetColumnTypeById(idx))) {
+            formats[idx] = PGFormatCode::kBinary;
+        }
+    }
+    return formats;
+}
+
+} // namespace
+
 Connection::Connection(boost::asio::io_service &io_service)
     : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
 
@@ -110,7 +139,7 @@ void Connection::HandleRequest() {
     const auto cmd_type = pg_handler_->read_command_type();
 
     // FIXME
-    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get(), true);
     query_context_ptr->Init(InfinityContext::instance().config(),
                             InfinityContext::instance().task_scheduler(),
                             InfinityContext::instance().storage(),
@@ -118,21 +147,36 @@ void Connection::HandleRequest() {
                             InfinityContext::instance().session_manager(),
                             InfinityContext::instance().persistence_manager());
 
+    if (skip_until_sync_ && cmd_type != PGMessageType::kSyncCommand && cmd_type != PGMessageType::kTerminateCommand) {
+        // discard the rest of the failed extended query
+        pg_handler_->read_message_body();
+        return;
+    }
+
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
-            LOG_TRACE("BindCommand");
+            HandleBind(query_context_ptr.get());
             break;
         }
         case PGMessageType::kDescribeCommand: {
-            LOG_TRACE("DescribeCommand");
+            HandleDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
-            LOG_TRACE("ExecuteCommand");
+            HandleExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
-            LOG_TRACE("ParseCommand");
+            HandleParse(query_context_ptr.get());
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            HandleClose();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            pg_handler_->read_message_body();
+            pg_handler_->flush();
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -140,7 +184,9 @@ void Connection::HandleRequest() {
             break;
         }
         case PGMessageType::kSyncCommand: {
-            LOG_TRACE("SyncCommand");
+            pg_handler_->read_message_body();
+            skip_until_sync_ = false;
+            pg_handler_->send_ready_for_query();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -158,6 +204,13 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     const String &query = pg_handler_->read_command_body();
     LOG_TRACE(fmt::format("Query: {}", query));
 
+    String copy_table_name;
+    String copy_options;
+    if (ParseCopyFromStdin(query, copy_table_name, copy_options)) {
+        HandleCopyFromStdin(query_context, copy_table_name, copy_options);
+        return;
+    }
+
     // Start to execute the query.
     QueryResult result = query_context->Query(query);
 
@@ -175,7 +228,338 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleCopyFromStdin(QueryContext *query_context, const String &table_name, const String &options) {
+    static atomic_u64 copy_file_count{0};
+    const String temp_dir = InfinityContext::instance().config()->TempDir();
+    std::filesystem::create_directories(temp_dir);
+    const String file_path = fmt::format("{}/pg_copy_{}_{}.csv", temp_dir, session_->session_id(), copy_file_count++);
+
+    // The column count of the text format isn't checked by the clients, the table is checked by the import.
+    pg_handler_->SendCopyInResponse(0);
+
+    String error_message;
+    SizeT file_size = 0;
+    String tail; // the last bytes, an old style client ends the data with "\\."
+    {
+        std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+        bool copy_done = false;
+        while (!copy_done) {
+            const auto message_type = pg_handler_->read_command_type();
+            String body = pg_handler_->read_message_body();
+            switch (message_type) {
+                case PGMessageType::kCopyData: {
+                    if (error_message.empty()) {
+                        file.write(body.data(), body.size());
+                        file_size += body.size();
+                        tail = (tail + body).substr(std::max<SizeT>(tail.size() + body.size(), 4) - 4);
+                    }
+                    break;
+                }
+                case PGMessageType::kCopyDone: {
+                    copy_done = true;
+                    break;
+                }
+                case PGMessageType::kCopyFail: {
+                    error_message = fmt::format("COPY from stdin failed: {}", PGMessageReader(body).read_string());
+                    copy_done = true;
+                    break;
+                }
+                case PGMessageType::kFlushCommand:
+                case PGMessageType::kSyncCommand: {
+                    break;
+                }
+                default: {
+                    error_message = "Unexpected message during COPY from stdin";
+                    copy_done = true;
+                }
+            }
+        }
+        if (error_message.empty() && !file) {
+            error_message = fmt::format("Can't write {}", file_path);
+        }
+    }
+
+    if (error_message.empty()) {
+        SizeT end_marker_size = 0;
+        if (tail.ends_with("\\.\r\n")) {
+            end_marker_size = 4;
+        } else if (tail.ends_with("\\.\n")) {
+            end_marker_size = 3;
+        } else if (tail.ends_with("\\.")) {
+            end_marker_size = 2;
+        }
+        if (end_marker_size > 0) {
+            std::filesystem::resize_file(file_path, file_size - end_marker_size);
+        }
+
+        // PG text format is tab delimited
+        String copy_options = options.empty() ? "FORMAT csv, DELIMITER '\\t'" : options;
+        QueryResult result = query_context->Query(fmt::format("COPY {} FROM '{}' WITH ({})", table_name, file_path, copy_options));
+        if (result.result_table_.get() == nullptr) {
+            error_message = result.status_.message();
+        } else {
+            String *result_msg = result.result_table_->result_msg();
+            pg_handler_->SendComplete(result_msg != nullptr ? *result_msg : "COPY");
+        }
+    }
+    std::filesystem::remove(file_path);
+
+    if (!error_message.empty()) {
+        HashMap<PGMessageType, String> error_message_map;
+        error_message_map[PGMessageType::kHumanReadableError] = error_message;
+        pg_handler_->send_error_response(error_message_map);
+    }
+    pg_handler_->send_ready_for_query();
+}
+
+void Connection::HandleExtendedError(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    LOG_ERROR(error_message);
+    pg_handler_->send_error_response(error_message_map);
+    skip_until_sync_ = true;
+}
+
+void Connection::HandleParse(QueryContext *query_context) {
+    const String body = pg_handler_->read_message_body();
+    PGMessageReader reader(body);
+    String statement_name = reader.read_string();
+    auto statement = MakeShared<PreparedStatement>();
+    statement->query_ = reader.read_string();
+    i16 parameter_type_count = reader.read_value_i16();
+    for (i16 idx = 0; idx < parameter_type_count; ++idx) {
+        statement->parameter_types_.push_back(reader.read_value_u32());
+    }
+    SizeT parameter_count = std::max(static_cast<SizeT>(parameter_type_count), ParameterCount(statement->query_));
+    statement->parameter_types_.resize(parameter_count, 0);
+    LOG_TRACE(fmt::format("Parse: {}", statement->query_));
+
+    if (parameter_count == 0 && ParseStatement(query_context, statement->query_) == nullptr) {
+        return;
+    }
+    prepared_statements_[statement_name] = std::move(statement);
+    pg_handler_->SendEmptyMessage(PGMessageType::kParseComplete);
+}
+
+void Connection::HandleBind(QueryContext *query_context) {
+    const String body = pg_handler_->read_message_body();
+    PGMessageReader reader(body);
+    String portal_name = reader.read_string();
+    String statement_name = reader.read_string();
+
+    Vector<i16> parameter_format_codes(reader.read_value_i16());
+    for (auto &format_code : parameter_format_codes) {
+        format_code = reader.read_value_i16();
+    }
+    Vector<Optional<String>> parameters(reader.read_value_i16());
+    for (auto &parameter : parameters) {
+        i32 length = reader.read_value_i32();
+        if (length >= 0) {
+            parameter = reader.read_bytes(length);
+        }
+    }
+    Portal portal;
+    portal.result_format_codes_.resize(reader.read_value_i16());
+    for (auto &format_code : portal.result_format_codes_) {
+        format_code = reader.read_value_i16();
+    }
+
+    auto iter = prepared_statements_.find(statement_name);
+    if (iter == prepared_statements_.end()) {
+        HandleExtendedError(fmt::format("Prepared statement \"{}\" does not exist", statement_name));
+        return;
+    }
+    portal.statement_ = iter->second;
+    PreparedStatement &statement = *portal.statement_;
+    if (parameters.size() != statement.parameter_types_.size()) {
+        HandleExtendedError(fmt::format("Bind supplies {} parameters, the statement requires {}", parameters.size(), statement.parameter_types_.size()));
+        return;
+    }
+
+    if (parameters.empty()) {
+        portal.query_ = statement.query_;
+    } else {
+        Vector<String> literals;
+        literals.reserve(parameters.size());
+        for (SizeT idx = 0; idx < parameters.size(); ++idx) {
+            u32 object_id = statement.parameter_types_[idx];
+            i16 format_code = parameter_format_codes.empty() ? 0 : parameter_format_codes[parameter_format_codes.size() == 1 ? 0 : idx];
+            Optional<String> parameter = std::move(parameters[idx]);
+            if (parameter.has_value() && format_code == static_cast<i16>(PGFormatCode::kBinary)) {
+                parameter = DecodeBinaryParameter(*parameter, object_id);
+                if (!parameter.has_value()) {
+                    HandleExtendedError(fmt::format("Binary format of parameter ${} with type oid {} isn't supported", idx + 1, object_id));
+                    return;
+                }
+            }
+            auto [literal, status] = ParameterLiteral(parameter, object_id);
+            if (!status.ok()) {
+                HandleExtendedError(status.message());
+                return;
+            }
+            literals.push_back(std::move(literal));
+        }
+        portal.query_ = BindParameters(statement.query_, literals);
+    }
+    portal.parsed_result_ = ParseStatement(query_context, portal.query_);
+    if (portal.parsed_result_ == nullptr) {
+        return;
+    }
+    portals_[portal_name] = std::move(portal);
+    pg_handler_->SendEmptyMessage(PGMessageType::kBindComplete);
+}
+
+void Connection::HandleDescribe(QueryContext *query_context) {
+    const String body = pg_handler_->read_message_body();
+    PGMessageReader reader(body);
+    char target = reader.read_bytes(1)[0];
+    String name = reader.read_string();
+
+    if (target == 'S') {
+        auto iter = prepared_statements_.find(name);
+        if (iter == prepared_statements_.end()) {
+            HandleExtendedError(fmt::format("Prepared statement \"{}\" does not exist", name));
+            return;
+        }
+        const PreparedStatement &statement = *iter->second;
+        Vector<u32> parameter_types = statement.parameter_types_;
+        for (auto &object_id : parameter_types) {
+            object_id = object_id == 0 ? 25 : object_id;
+        }
+        pg_handler_->SendParameterDescription(parameter_types);
+        if (parameter_types.empty()) {
+            SharedPtr<ParserResult> parsed_result = ParseStatement(query_context, statement.query_);
+            if (parsed_result != nullptr) {
+                SendStatementDescription(query_context, *parsed_result, {});
+            }
+            return;
+        }
+        // The result columns don't depend on the parameter values, the statement is described with NULL parameters.
+        // A statement which can't bind NULL parameters is described as NoData.
+        ParserResult parsed_result;
+        query_context->parser()->Parse(BindParameters(statement.query_, Vector<String>(parameter_types.size(), "NULL")), &parsed_result);
+        QueryResult result;
+        if (!parsed_result.IsError() && parsed_result.statements_ptr_->size() == 1) {
+            result = query_context->DescribeStatement(parsed_result.statements_ptr_->at(0));
+        }
+        if (result.result_table_.get() == nullptr || !SendTableDescription(result.result_table_)) {
+            pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+        }
+        return;
+    }
+
+    auto iter = portals_.find(name);
+    if (iter == portals_.end()) {
+        HandleExtendedError(fmt::format("Portal \"{}\" does not exist", name));
+        return;
+    }
+    Portal &portal = iter->second;
+    if (portal.result_.has_value()) {
+        // suspended by Execute
+        if (!SendTableDescription(portal.result_->result_table_, portal.result_formats_)) {
+            pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+        }
+        return;
+    }
+    SharedPtr<ParserResult> parsed_result = TakeParsedResult(query_context, portal);
+    if (parsed_result != nullptr) {
+        SendStatementDescription(query_context, *parsed_result, portal.result_format_codes_);
+    }
+}
+
+void Connection::SendStatementDescription(QueryContext *query_context, const ParserResult &parsed_result, const Vector<i16> &result_format_codes) {
+    if (parsed_result.statements_ptr_->empty()) {
+        pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+        return;
+    }
+    QueryResult result = query_context->DescribeStatement(parsed_result.statements_ptr_->at(0));
+    if (!result.status_.ok()) {
+        HandleExtendedError(result.status_.message());
+        return;
+    }
+    if (result.result_table_.get() == nullptr ||
+        !SendTableDescription(result.result_table_, ResolveResultFormats(result_format_codes, *result.result_table_))) {
+        pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+    }
+}
+
+void Connection::HandleExecute(QueryContext *query_context) {
+    const String body = pg_handler_->read_message_body();
+    PGMessageReader reader(body);
+    String portal_name = reader.read_string();
+    i32 max_rows = reader.read_value_i32();
+
+    auto iter = portals_.find(portal_name);
+    if (iter == portals_.end()) {
+        HandleExtendedError(fmt::format("Portal \"{}\" does not exist", portal_name));
+        return;
+    }
+    Portal &portal = iter->second;
+    if (!portal.result_.has_value()) {
+        SharedPtr<ParserResult> parsed_result = TakeParsedResult(query_context, portal);
+        if (parsed_result == nullptr) {
+            return;
+        }
+        if (parsed_result->statements_ptr_->empty()) {
+            pg_handler_->SendEmptyMessage(PGMessageType::kEmptyQueryResponse);
+            return;
+        }
+        portal.result_ = query_context->QueryStatement(parsed_result->statements_ptr_->at(0));
+        if (portal.result_->result_table_.get() == nullptr) {
+            String error_message = portal.result_->status_.message();
+            portal.result_.reset();
+            HandleExtendedError(error_message);
+            return;
+        }
+        portal.result_formats_ = ResolveResultFormats(portal.result_format_codes_, *portal.result_->result_table_);
+        portal.block_idx_ = 0;
+        portal.row_idx_ = 0;
+    }
+    // the result is kept with the cursor until the portal runs to completion
+    SizeT row_limit = static_cast<SizeT>(std::max(max_rows, 0));
+    if (!SendRows(*portal.result_->result_table_, portal.result_formats_, row_limit, portal.block_idx_, portal.row_idx_)) {
+        pg_handler_->SendEmptyMessage(PGMessageType::kPortalSuspended);
+        return;
+    }
+    SendCommandComplete(*portal.result_);
+    portal.result_.reset();
+}
+
+SharedPtr<ParserResult> Connection::ParseStatement(QueryContext *query_context, const String &query) {
+    auto parsed_result = MakeShared<ParserResult>();
+    query_context->parser()->Parse(query, parsed_result.get());
+    if (parsed_result->IsError()) {
+        HandleExtendedError(parsed_result->error_message_);
+        return nullptr;
+    }
+    if (parsed_result->statements_ptr_->size() > 1) {
+        HandleExtendedError("Only support single statement.");
+        return nullptr;
+    }
+    return parsed_result;
+}
+
+SharedPtr<ParserResult> Connection::TakeParsedResult(QueryContext *query_context, Portal &portal) {
+    if (portal.parsed_result_ != nullptr) {
+        return std::exchange(portal.parsed_result_, nullptr);
+    }
+    return ParseStatement(query_context, portal.query_);
+}
+
+void Connection::HandleClose() {
+    const String body = pg_handler_->read_message_body();
+    PGMessageReader reader(body);
+    char target = reader.read_bytes(1)[0];
+    String name = reader.read_string();
+    if (target == 'S') {
+        prepared_statements_.erase(name);
+    } else {
+        portals_.erase(name);
+    }
+    pg_handler_->SendEmptyMessage(PGMessageType::kCloseComplete);
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &formats) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -184,7 +568,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
@@ -383,34 +767,54 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
             }
         }
 
-        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
+        PGFormatCode format = formats.empty() ? PGFormatCode::kText : formats[idx];
+        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width, format);
     }
+    return true;
 }
 
-void Connection::SendQueryResponse(const QueryResult &query_result) {
+void Connection::SendQueryResponse(const QueryResult &query_result, const Vector<PGFormatCode> &formats) {
+    SizeT block_idx = 0;
+    SizeT row_idx = 0;
+    SendRows(*query_result.result_table_, formats, 0, block_idx, row_idx);
+    SendCommandComplete(query_result);
+}
 
-    const SharedPtr<DataTable> &result_table = query_result.result_table_;
-    SizeT column_count = result_table->ColumnCount();
+bool Connection::SendRows(DataTable &result_table, const Vector<PGFormatCode> &formats, SizeT max_rows, SizeT &block_idx, SizeT &row_idx) {
+    SizeT column_count = result_table.ColumnCount();
     auto values_as_strings = Vector<Optional<String>>(column_count);
-    SizeT block_count = result_table->DataBlockCount();
-    for (SizeT idx = 0; idx < block_count; ++idx) {
-        auto block = result_table->GetDataBlockById(idx);
+    SizeT block_count = result_table.DataBlockCount();
+    SizeT sent_count = 0;
+    for (; block_idx < block_count; ++block_idx, row_idx = 0) {
+        auto block = result_table.GetDataBlockById(block_idx);
         SizeT row_count = block->row_count();
 
-        for (SizeT row_id = 0; row_id < row_count; ++row_id) {
+        for (; row_idx < row_count; ++row_idx) {
+            if (max_rows > 0 && sent_count == max_rows) {
+                return false;
+            }
             SizeT string_length_sum = 0;
 
             // iterate each column_vector of the block
             for (SizeT column_id = 0; column_id < column_count; ++column_id) {
                 auto &column_vector = block->column_vectors[column_id];
-                const String string_value = column_vector->ToString(row_id);
-                values_as_strings[column_id] = string_value;
-                string_length_sum += string_value.size();
+                if (!formats.empty() && formats[column_id] == PGFormatCode::kBinary) {
+                    values_as_strings[column_id] = PGEncodeBinary(*column_vector, row_idx);
+                } else {
+                    values_as_strings[column_id] = column_vector->ToString(row_idx);
+                }
+                if (values_as_strings[column_id].has_value()) {
+                    string_length_sum += values_as_strings[column_id]->size();
+                }
             }
             pg_handler_->SendData(values_as_strings, string_length_sum);
+            ++sent_count;
         }
     }
+    return true;
+}
 
+void Connection::SendCommandComplete(const QueryResult &query_result) {
     String message;
     switch (query_result.root_operator_type_) {
         case LogicalNodeType::kInsert: {
@@ -23,6 +23,8 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import pg_message;
+import parser_result;
 
 namespace infinity {
 
@@ -46,19 +48,74 @@ public:
     }
 
 private:
+    struct PreparedStatement {
+        String query_{};
+        Vector<u32> parameter_types_{}; // type oid of each parameter, 0 if unspecified
+    };
+
+    struct Portal {
+        SharedPtr<PreparedStatement> statement_{};
+        String query_{}; // the statement with the bound parameters
+        // parsed by Bind and taken by the next Describe or Execute, binding moves parts out of the parsed statement
+        SharedPtr<ParserResult> parsed_result_{};
+        Vector<i16> result_format_codes_{};
+        // the result of a suspended Execute, the next Execute sends from the cursor
+        Optional<QueryResult> result_{};
+        Vector<PGFormatCode> result_formats_{};
+        SizeT block_idx_{};
+        SizeT row_idx_{};
+    };
+
     void HandleConnection();
 
     void HandleRequest();
 
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    // COPY table FROM STDIN: spools the CopyData messages to a file and imports it.
+    void HandleCopyFromStdin(QueryContext *query_context, const String &table_name, const String &options);
+
+    // Extended query protocol, an error skips the messages until the next Sync.
+    void HandleParse(QueryContext *query_context);
+
+    void HandleBind(QueryContext *query_context);
+
+    void HandleDescribe(QueryContext *query_context);
+
+    void HandleExecute(QueryContext *query_context);
+
+    void HandleClose();
+
+    void HandleExtendedError(const String &error_message);
 
-    void SendQueryResponse(const QueryResult &query_result);
+    // formats: format of each column, all text when empty
+    // false if the table has no named output column, no description is sent
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &formats = {});
+
+    void SendQueryResponse(const QueryResult &query_result, const Vector<PGFormatCode> &formats = {});
+
+    // Sends at most max_rows rows (all if 0) from the cursor (block_idx, row_idx) and advances it, true if all the rows
+    // are sent.
+    bool SendRows(DataTable &result_table, const Vector<PGFormatCode> &formats, SizeT max_rows, SizeT &block_idx, SizeT &row_idx);
+
+    void SendCommandComplete(const QueryResult &query_result);
+
+    // RowDescription of the statement result, NoData if it returns no rows
+    void SendStatementDescription(QueryContext *query_context, const ParserResult &parsed_result, const Vector<i16> &result_format_codes);
+
+    // Parses a single statement of the extended query protocol, nullptr after sending the error
+    SharedPtr<ParserResult> ParseStatement(QueryContext *query_context, const String &query);
+
+    // The parsed statement for one Describe or Execute of the portal, parsed again if taken by an earlier one
+    SharedPtr<ParserResult> TakeParsedResult(QueryContext *query_context, Portal &portal);
 
     void HandleError(const char *error_message);
 
 private:
+    HashMap<String, SharedPtr<PreparedStatement>> prepared_statements_{};
+    HashMap<String, Portal> portals_{};
+    bool skip_until_sync_{false};
+
     const SharedPtr<boost::asio::ip::tcp::socket> socket_{};
 
     const SharedPtr<PGProtocolHandler> pg_handler_{};
@@ -0,0 +1,100 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <lz4.h>
+
+module peer_log_codec;
+
+import stl;
+import status;
+import third_party;
+
+namespace infinity {
+
+Status CompressLogEntries(const Vector<SharedPtr<String>> &log_entries, String &compressed) {
+    // the entry sizes fit u32 if the raw size does
+    SizeT raw_size = 0;
+    for (const auto &log_entry : log_entries) {
+        raw_size += sizeof(u32) + log_entry->size();
+        if (raw_size > static_cast<SizeT>(LZ4_MAX_INPUT_SIZE)) {
+            return Status::IOError(fmt::format("Log batch of {} entries exceeds the LZ4 input limit {}", log_entries.size(), LZ4_MAX_INPUT_SIZE));
+        }
+    }
+    String raw(raw_size, '\0');
+    char *ptr = raw.data();
+    for (const auto &log_entry : log_entries) {
+        u32 entry_size = log_entry->size();
+        std::memcpy(ptr, &entry_size, sizeof(entry_size));
+        ptr += sizeof(entry_size);
+        std::memcpy(ptr, log_entry->data(), entry_size);
+        ptr += entry_size;
+    }
+
+    i32 compress_bound = LZ4_compressBound(raw_size);
+    compressed.assign(sizeof(u32) + compress_bound, '\0');
+    u32 header = raw_size;
+    std::memcpy(compressed.data(), &header, sizeof(header));
+    i32 compressed_size = LZ4_compress_default(raw.data(), compressed.data() + sizeof(header), raw_size, compress_bound);
+    if (compressed_size <= 0 && raw_size > 0) {
+        compressed.clear();
+        return Status::IOError(fmt::format("Fail to compress log batch of {} bytes", raw_size));
+    }
+    compressed.resize(sizeof(header) + compressed_size);
+    return Status::OK();
+}
+
+Status DecompressLogEntries(const String &compressed, SizeT log_entry_count, Vector<String> &log_entries) {
+    u32 raw_size = 0;
+    if (compressed.size() < sizeof(raw_size)) {
+        return Status::IOError("Truncated log batch");
+    }
+    std::memcpy(&raw_size, compressed.data(), sizeof(raw_size));
+    // a corrupted header must not make a huge allocation
+    if (raw_size > static_cast<u32>(LZ4_MAX_INPUT_SIZE) || compressed.size() - sizeof(raw_size) > static_cast<SizeT>(LZ4_compressBound(raw_size))) {
+        return Status::IOError(fmt::format("Corrupted log batch of {} bytes, raw size {}", compressed.size(), raw_size));
+    }
+    String raw(raw_size, '\0');
+    i32 decompressed_size =
+        LZ4_decompress_safe(compressed.data() + sizeof(raw_size), raw.data(), compressed.size() - sizeof(raw_size), raw_size);
+    if (decompressed_size != static_cast<i32>(raw_size)) {
+        return Status::IOError(fmt::format("Fail to decompress log batch, expect {} bytes, get {}", raw_size, decompressed_size));
+    }
+
+    log_entries.clear();
+    log_entries.reserve(log_entry_count);
+    const char *ptr = raw.data();
+    const char *end = ptr + raw.size();
+    while (ptr < end) {
+        u32 entry_size = 0;
+        if (end - ptr < static_cast<ptrdiff_t>(sizeof(entry_size))) {
+            return Status::IOError("Corrupted log batch");
+        }
+        std::memcpy(&entry_size, ptr, sizeof(entry_size));
+        ptr += sizeof(entry_size);
+        if (static_cast<SizeT>(end - ptr) < entry_size) {
+            return Status::IOError("Corrupted log batch");
+        }
+        log_entries.emplace_back(ptr, entry_size);
+        ptr += entry_size;
+    }
+    if (log_entries.size() != log_entry_count) {
+        return Status::IOError(fmt::format("Log batch has {} entries, expect {}", log_entries.size(), log_entry_count));
+    }
+    return Status::OK();
+}
+
+} // namespace infinity
@@ -0,0 +1,31 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module peer_log_codec;
+
+import stl;
+import status;
+
+namespace infinity {
+
+// A batch of WAL entries shipped to a follower / learner is compressed as one LZ4 block:
+// [u32 raw size][LZ4 block of ([u32 entry size][entry])...]
+// Fails if the batch is larger than one LZ4 block can hold.
+export Status CompressLogEntries(const Vector<SharedPtr<String>> &log_entries, String &compressed);
+
+export Status DecompressLogEntries(const String &compressed, SizeT log_entry_count, Vector<String> &log_entries);
+
+} // namespace infinity
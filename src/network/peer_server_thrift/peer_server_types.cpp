@@ -1233,6 +1233,14 @@ void SyncLogRequest::__set_log_entries(const std::vector<std::string> & val) {
 void SyncLogRequest::__set_on_startup(const bool val) {
   this->on_startup = val;
 }
+
+void SyncLogRequest::__set_compressed_log_entries(const std::string& val) {
+  this->compressed_log_entries = val;
+}
+
+void SyncLogRequest::__set_log_entry_count(const int64_t val) {
+  this->log_entry_count = val;
+}
 std::ostream& operator<<(std::ostream& out, const SyncLogRequest& obj)
 {
   obj.printTo(out);
@@ -1297,6 +1305,22 @@ uint32_t SyncLogRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->compressed_log_entries);
+          this->__isset.compressed_log_entries = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->log_entry_count);
+          this->__isset.log_entry_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1334,6 +1358,14 @@ uint32_t SyncLogRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeBool(this->on_startup);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("compressed_log_entries", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeBinary(this->compressed_log_entries);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("log_entry_count", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->log_entry_count);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1344,6 +1376,8 @@ void swap(SyncLogRequest &a, SyncLogRequest &b) {
   swap(a.node_name, b.node_name);
   swap(a.log_entries, b.log_entries);
   swap(a.on_startup, b.on_startup);
+  swap(a.compressed_log_entries, b.compressed_log_entries);
+  swap(a.log_entry_count, b.log_entry_count);
   swap(a.__isset, b.__isset);
 }
 
@@ -1351,12 +1385,16 @@ SyncLogRequest::SyncLogRequest(const SyncLogRequest& other31) {
   node_name = other31.node_name;
   log_entries = other31.log_entries;
   on_startup = other31.on_startup;
+  compressed_log_entries = other31.compressed_log_entries;
+  log_entry_count = other31.log_entry_count;
   __isset = other31.__isset;
 }
 SyncLogRequest& SyncLogRequest::operator=(const SyncLogRequest& other32) {
   node_name = other32.node_name;
   log_entries = other32.log_entries;
   on_startup = other32.on_startup;
+  compressed_log_entries = other32.compressed_log_entries;
+  log_entry_count = other32.log_entry_count;
   __isset = other32.__isset;
   return *this;
 }
@@ -1366,6 +1404,8 @@ void SyncLogRequest::printTo(std::ostream& out) const {
   out << "node_name=" << to_string(node_name);
   out << ", " << "log_entries=" << to_string(log_entries);
   out << ", " << "on_startup=" << to_string(on_startup);
+  out << ", " << "compressed_log_entries=" << to_string(compressed_log_entries);
+  out << ", " << "log_entry_count=" << to_string(log_entry_count);
   out << ")";
 }
 
@@ -561,10 +561,12 @@ void swap(HeartBeatResponse &a, HeartBeatResponse &b);
 std::ostream& operator<<(std::ostream& out, const HeartBeatResponse& obj);
 
 typedef struct _SyncLogRequest__isset {
-  _SyncLogRequest__isset() : node_name(false), log_entries(false), on_startup(false) {}
+  _SyncLogRequest__isset() : node_name(false), log_entries(false), on_startup(false), compressed_log_entries(false), log_entry_count(false) {}
   bool node_name :1;
   bool log_entries :1;
   bool on_startup :1;
+  bool compressed_log_entries :1;
+  bool log_entry_count :1;
 } _SyncLogRequest__isset;
 
 class SyncLogRequest : public virtual ::apache::thrift::TBase {
@@ -574,13 +576,17 @@ class SyncLogRequest : public virtual ::apache::thrift::TBase {
   SyncLogRequest& operator=(const SyncLogRequest&);
   SyncLogRequest() noexcept
                  : node_name(),
-                   on_startup(0) {
+                   on_startup(0),
+                   compressed_log_entries(),
+                   log_entry_count(0) {
   }
 
   virtual ~SyncLogRequest() noexcept;
   std::string node_name;
   std::vector<std::string>  log_entries;
   bool on_startup;
+  std::string compressed_log_entries;
+  int64_t log_entry_count;
 
   _SyncLogRequest__isset __isset;
 
@@ -590,6 +596,10 @@ class SyncLogRequest : public virtual ::apache::thrift::TBase {
 
   void __set_on_startup(const bool val);
 
+  void __set_compressed_log_entries(const std::string& val);
+
+  void __set_log_entry_count(const int64_t val);
+
   bool operator == (const SyncLogRequest & rhs) const
   {
     if (!(node_name == rhs.node_name))
@@ -598,6 +608,10 @@ class SyncLogRequest : public virtual ::apache::thrift::TBase {
       return false;
     if (!(on_startup == rhs.on_startup))
       return false;
+    if (!(compressed_log_entries == rhs.compressed_log_entries))
+      return false;
+    if (!(log_entry_count == rhs.log_entry_count))
+      return false;
     return true;
   }
   bool operator != (const SyncLogRequest &rhs) const {
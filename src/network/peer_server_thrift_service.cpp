@@ -27,6 +27,7 @@ import infinity_exception;
 import cluster_manager;
 import admin_statement;
 import node_info;
+import peer_log_codec;
 
 namespace infinity {
 
@@ -150,17 +151,37 @@ void PeerServerThriftService::HeartBeat(infinity_peer_server::HeartBeatResponse
 
 void PeerServerThriftService::SyncLog(infinity_peer_server::SyncLogResponse &response, const infinity_peer_server::SyncLogRequest &request) {
     LOG_INFO("Get SyncLog request");
-    if (request.log_entries.size() == 0) {
+    Vector<String> log_entries;
+    Status status = Status::OK();
+    if (request.log_entry_count > 0) {
+        status = DecompressLogEntries(request.compressed_log_entries, request.log_entry_count, log_entries);
+        if (!status.ok()) {
+            response.error_code = static_cast<i64>(status.code());
+            response.error_message = status.message();
+            return;
+        }
+    } else {
+        log_entries = request.log_entries;
+    }
+    if (log_entries.size() == 0) {
         UnrecoverableError("No log is synced from leader node");
     }
 
-    InfinityContext::instance().storage()->wal_manager()->FlushLogByReplication(request.log_entries, request.on_startup);
+    ClusterManager *cluster_manager = InfinityContext::instance().cluster_manager();
+    if (request.on_startup) {
+        // the logs lacked by the node are applied after the logs received before
+        cluster_manager->WaitSyncedLogApplied();
+    }
+
+    // The logs are durable before the ack
+    InfinityContext::instance().storage()->wal_manager()->FlushLogByReplication(log_entries, request.on_startup);
 
-    Status status = Status::OK();
     if (request.on_startup) {
-        status = InfinityContext::instance().cluster_manager()->ContinueStartup(request.log_entries);
+        status = cluster_manager->ContinueStartup(log_entries);
     } else {
-        status = InfinityContext::instance().cluster_manager()->ApplySyncedLogNolock(request.log_entries);
+        // the replay is done by the log applier thread so the leader can send the next batch, a failure to apply the logs
+        // received before is reported in this ack
+        status = cluster_manager->ApplySyncedLogAsync(std::move(log_entries));
     }
 
     if (!status.ok()) {
@@ -143,16 +143,61 @@ public:
     NodeStatus sender_status_{NodeStatus::kInvalid};
 };
 
+// The acks of a log batch streamed to the followers, the batch is committed once quorum_size_ followers have it durable
+export class SyncLogQuorum {
+public:
+    SyncLogQuorum(SizeT node_count, SizeT quorum_size) : node_count_(node_count), quorum_size_(quorum_size) {}
+
+    void Ack(bool success) {
+        std::unique_lock<std::mutex> locker(mutex_);
+        if (success) {
+            ++success_count_;
+        } else {
+            ++fail_count_;
+        }
+        cv_.notify_all();
+    }
+
+    // Returns false once too many nodes fail the batch to reach the quorum
+    bool Wait() {
+        std::unique_lock<std::mutex> locker(mutex_);
+        cv_.wait(locker, [this] { return success_count_ >= quorum_size_ || node_count_ - fail_count_ < quorum_size_; });
+        return success_count_ >= quorum_size_;
+    }
+
+    SizeT SuccessCount() const {
+        std::unique_lock<std::mutex> locker(mutex_);
+        return success_count_;
+    }
+
+private:
+    mutable std::mutex mutex_{};
+    std::condition_variable cv_{};
+    SizeT node_count_{};
+    SizeT quorum_size_{};
+    SizeT success_count_{};
+    SizeT fail_count_{};
+};
+
 export class SyncLogTask final : public PeerTask {
 public:
-    SyncLogTask(const String &node_name, const Vector<SharedPtr<String>> &log_strings, bool on_register)
-        : PeerTask(PeerTaskType::kLogSync), node_name_(node_name), log_strings_(log_strings), on_register_(on_register) {}
+    SyncLogTask(const String &node_name, const Vector<SharedPtr<String>> &log_strings, bool on_register, SharedPtr<SyncLogQuorum> quorum = nullptr)
+        : PeerTask(PeerTaskType::kLogSync), node_name_(node_name), log_strings_(log_strings), on_register_(on_register), quorum_(std::move(quorum)) {}
 
     String ToString() const final;
 
+    // Reports the result of the request to the quorum of the batch, once
+    void Ack() {
+        if (quorum_.get() != nullptr) {
+            quorum_->Ack(error_code_ == 0);
+            quorum_.reset();
+        }
+    }
+
     String node_name_{};
     Vector<SharedPtr<String>> log_strings_;
     bool on_register_{false};
+    SharedPtr<SyncLogQuorum> quorum_{};
 
     // response
     i64 error_code_{};
@@ -31,6 +31,8 @@ import cluster_manager;
 import admin_statement;
 import node_info;
 import config;
+import default_values;
+import peer_log_codec;
 
 namespace infinity {
 
@@ -128,7 +130,33 @@ void PeerClient::Send(SharedPtr<PeerTask> peer_task) {
         UnrecoverableError("Terminate the background processor");
     }
     ++peer_task_count_;
-    peer_task_queue_.Enqueue(std::move(peer_task));
+    if (!peer_task_queue_.Enqueue(peer_task)) {
+        --peer_task_count_;
+        if (peer_task->Type() == PeerTaskType::kLogSync) {
+            DropSyncLog(static_cast<SyncLogTask *>(peer_task.get()));
+        }
+    }
+}
+
+void PeerClient::DropSyncLog(SyncLogTask *sync_log_task) {
+    sync_log_task->error_code_ = static_cast<i64>(ErrorCode::kCantConnectServer);
+    sync_log_task->error_message_ = fmt::format("Peer client to node: {} is stopped", sync_log_task->node_name_);
+    sync_log_task->Ack();
+    if (!sync_log_task->on_register_) {
+        std::unique_lock<std::mutex> window_lock(log_window_mutex_);
+        --unacked_log_batches_;
+        log_window_cv_.notify_all();
+    }
+    sync_log_task->Complete();
+}
+
+void PeerClient::StreamLogs(SharedPtr<SyncLogTask> sync_log_task) {
+    {
+        std::unique_lock<std::mutex> window_lock(log_window_mutex_);
+        log_window_cv_.wait(window_lock, [this] { return unacked_log_batches_ < DEFAULT_PEER_LOG_SYNC_WINDOW; });
+        ++unacked_log_batches_;
+    }
+    Send(std::move(sync_log_task));
 }
 
 void PeerClient::Process() {
@@ -136,7 +164,8 @@ void PeerClient::Process() {
     bool running = true;
     while (running) {
         peer_task_queue_.DequeueBulk(peer_tasks);
-        for (const auto &peer_task : peer_tasks) {
+        for (SizeT task_idx = 0; task_idx < peer_tasks.size(); ++task_idx) {
+            const auto &peer_task = peer_tasks[task_idx];
             switch (peer_task->Type()) {
                 case PeerTaskType::kTerminate: {
                     LOG_INFO("Stop the background processor");
@@ -163,8 +192,44 @@ void PeerClient::Process() {
                 }
                 case PeerTaskType::kLogSync: {
                     LOG_TRACE(peer_task->ToString());
-                    SyncLogTask *sync_log_task = static_cast<SyncLogTask *>(peer_task.get());
-                    SyncLogs(sync_log_task);
+                    Vector<SyncLogTask *> sync_log_tasks{static_cast<SyncLogTask *>(peer_task.get())};
+                    if (!sync_log_tasks[0]->on_register_) {
+                        // Merge the following batches of the stream which are queued while the last request was in flight
+                        while (task_idx + 1 < peer_tasks.size() && peer_tasks[task_idx + 1]->Type() == PeerTaskType::kLogSync) {
+                            auto *next_task = static_cast<SyncLogTask *>(peer_tasks[task_idx + 1].get());
+                            if (next_task->on_register_) {
+                                break;
+                            }
+                            sync_log_tasks.push_back(next_task);
+                            ++task_idx;
+                        }
+                    }
+                    if (sync_log_tasks[0]->on_register_ || !log_stream_broken_) {
+                        SyncLogs(sync_log_tasks);
+                    } else {
+                        sync_log_tasks[0]->error_code_ = static_cast<i64>(ErrorCode::kCantConnectServer);
+                        sync_log_tasks[0]->error_message_ = fmt::format("Log stream to node: {} is broken", sync_log_tasks[0]->node_name_);
+                    }
+                    if (sync_log_tasks[0]->on_register_ && sync_log_tasks[0]->error_code_ == 0) {
+                        // The node has the logs it lacked, the stream resumes
+                        log_stream_broken_ = false;
+                    }
+                    // the merged batches share the result of the request
+                    for (SizeT idx = 1; idx < sync_log_tasks.size(); ++idx) {
+                        sync_log_tasks[idx]->error_code_ = sync_log_tasks[0]->error_code_;
+                        sync_log_tasks[idx]->error_message_ = sync_log_tasks[0]->error_message_;
+                    }
+                    for (SyncLogTask *sync_log_task : sync_log_tasks) {
+                        sync_log_task->Ack();
+                    }
+                    for (SizeT idx = 1; idx < sync_log_tasks.size(); ++idx) {
+                        sync_log_tasks[idx]->Complete();
+                    }
+                    if (!sync_log_tasks[0]->on_register_) {
+                        std::unique_lock<std::mutex> window_lock(log_window_mutex_);
+                        unacked_log_batches_ -= sync_log_tasks.size();
+                        log_window_cv_.notify_all();
+                    }
                     break;
                 }
                 case PeerTaskType::kChangeRole: {
@@ -184,6 +249,16 @@ void PeerClient::Process() {
         peer_task_count_ -= peer_tasks.size();
         peer_tasks.clear();
     }
+
+    // The log batches queued after the termination are failed, so no one waits for their acks
+    peer_task_queue_.NotAllowEnqueue();
+    SharedPtr<PeerTask> peer_task;
+    while (peer_task_queue_.TryDequeue(peer_task)) {
+        --peer_task_count_;
+        if (peer_task->Type() == PeerTaskType::kLogSync) {
+            DropSyncLog(static_cast<SyncLogTask *>(peer_task.get()));
+        }
+    }
 }
 
 #define RETRY_IF_FAIL
@@ -439,15 +514,25 @@ void PeerClient::HeartBeat(HeartBeatPeerTask *peer_task) {
     }
 }
 
-void PeerClient::SyncLogs(SyncLogTask *peer_task) {
+void PeerClient::SyncLogs(const Vector<SyncLogTask *> &peer_tasks) {
+    SyncLogTask *peer_task = peer_tasks.front();
     SyncLogRequest request;
     SyncLogResponse response;
     request.node_name = peer_task->node_name_;
-    SizeT log_count = peer_task->log_strings_.size();
-    request.log_entries.reserve(log_count);
     request.on_startup = peer_task->on_register_;
-    for (SizeT i = 0; i < log_count; ++i) {
-        request.log_entries.emplace_back(*peer_task->log_strings_[i]);
+    Vector<SharedPtr<String>> log_strings;
+    for (const SyncLogTask *sync_log_task : peer_tasks) {
+        log_strings.insert(log_strings.end(), sync_log_task->log_strings_.begin(), sync_log_task->log_strings_.end());
+    }
+    if (Status status = CompressLogEntries(log_strings, request.compressed_log_entries); status.ok()) {
+        request.log_entry_count = log_strings.size();
+    } else {
+        // the node reads the plain entries if log_entry_count is 0
+        LOG_WARN(fmt::format("Sync log to node: {} uncompressed, {}", peer_task->node_name_, status.message()));
+        request.log_entries.reserve(log_strings.size());
+        for (const auto &log_string : log_strings) {
+            request.log_entries.emplace_back(*log_string);
+        }
     }
 
     try {
@@ -461,6 +546,14 @@ void PeerClient::SyncLogs(SyncLogTask *peer_task) {
             peer_task->error_code_ = response.error_code;
             peer_task->error_message_ = response.error_message;
             LOG_ERROR(fmt::format("Sync log to node: {}, error: {}", peer_task->node_name_, peer_task->error_message_));
+            if (!peer_task->on_register_) {
+                // The node misses the batch, it has to register again to get the logs it lacks
+                Status status =
+                    InfinityContext::instance().cluster_manager()->UpdateNodeByLeader(peer_task->node_name_, UpdateNodeOp::kLostConnection);
+                if (!status.ok()) {
+                    LOG_ERROR(status.message());
+                }
+            }
         }
     } catch (apache::thrift::transport::TTransportException &thrift_exception) {
         peer_task->error_message_ = fmt::format("Sync log to node, transport error: {}, error: {}", peer_task->node_name_, thrift_exception.what());
@@ -480,6 +573,15 @@ void PeerClient::SyncLogs(SyncLogTask *peer_task) {
         }
     } catch (const std::exception &e) {
         LOG_ERROR(e.what());
+        peer_task->error_code_ = static_cast<i64>(ErrorCode::kUnexpectedError);
+        peer_task->error_message_ = e.what();
+        Status status = InfinityContext::instance().cluster_manager()->UpdateNodeByLeader(peer_task->node_name_, UpdateNodeOp::kLostConnection);
+        if (!status.ok()) {
+            LOG_ERROR(status.message());
+        }
+    }
+    if (peer_task->error_code_ != 0 && !peer_task->on_register_) {
+        log_stream_broken_ = true;
     }
 }
 
@@ -55,6 +55,10 @@ public:
     Status Disconnect();
     void Send(SharedPtr<PeerTask> task);
 
+    // Replication stream of the leader: the log batches are pipelined without waiting for the ack of the node, the caller
+    // is blocked when DEFAULT_PEER_LOG_SYNC_WINDOW batches aren't acked yet.
+    void StreamLogs(SharedPtr<SyncLogTask> sync_log_task);
+
     bool ServerConnected() const { return server_connected_; }
 
 private:
@@ -64,7 +68,10 @@ private:
     void Register(RegisterPeerTask *peer_task);
     void Unregister(UnregisterPeerTask *peer_task);
     void HeartBeat(HeartBeatPeerTask *peer_task);
-    void SyncLogs(SyncLogTask *peer_task);
+    // The queued batches of the stream are sent in one request
+    void SyncLogs(const Vector<SyncLogTask *> &peer_tasks);
+    // The log batch isn't sent since the client is stopped
+    void DropSyncLog(SyncLogTask *sync_log_task);
     void ChangeRole(ChangeRoleTask *change_role_task);
 
 private:
@@ -82,6 +89,12 @@ private:
     BlockingQueue<SharedPtr<PeerTask>> peer_task_queue_{"PeerClient"};
     SharedPtr<Thread> processor_thread_{};
     Atomic<u64> peer_task_count_{};
+
+    std::mutex log_window_mutex_{};
+    std::condition_variable log_window_cv_{};
+    SizeT unacked_log_batches_{};
+    // a failed batch breaks the stream, the following batches are dropped until the node syncs the logs again on registration
+    bool log_stream_broken_{false};
 };
 
 } // namespace infinity
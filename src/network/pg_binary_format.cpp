@@ -0,0 +1,217 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module pg_binary_format;
+
+import stl;
+import data_type;
+import column_vector;
+import logical_type;
+import internal_types;
+import type_info;
+import embedding_info;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// most significant byte first
+template <typename T>
+void AppendNetwork(String &out, T value) {
+    u64 bits = static_cast<u64>(value);
+    for (SizeT shift = sizeof(T) * 8; shift > 0; shift -= 8) {
+        out.push_back(static_cast<char>(bits >> (shift - 8)));
+    }
+}
+
+void AppendFloat(String &out, float value) { AppendNetwork(out, std::bit_cast<u32>(value)); }
+
+void AppendDouble(String &out, double value) { AppendNetwork(out, std::bit_cast<u64>(value)); }
+
+// (element type oid, element size) of the PG array of an embedding, element size 0 for no binary format
+Pair<u32, SizeT> EmbeddingElement(EmbeddingDataType type) {
+    switch (type) {
+        case EmbeddingDataType::kElemUInt8:
+        case EmbeddingDataType::kElemInt8:
+            return {18, 1};
+        case EmbeddingDataType::kElemInt16:
+            return {21, 2};
+        case EmbeddingDataType::kElemInt32:
+            return {23, 4};
+        case EmbeddingDataType::kElemInt64:
+            return {20, 8};
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16:
+        case EmbeddingDataType::kElemFloat:
+            return {700, 4};
+        case EmbeddingDataType::kElemDouble:
+            return {701, 8};
+        default:
+            return {0, 0};
+    }
+}
+
+template <typename T>
+void AppendEmbeddingElements(String &out, const char *data, SizeT dimension, SizeT element_size) {
+    const auto *elements = reinterpret_cast<const T *>(data);
+    for (SizeT i = 0; i < dimension; ++i) {
+        AppendNetwork(out, static_cast<i32>(element_size));
+        if constexpr (std::is_same_v<T, double>) {
+            AppendDouble(out, elements[i]);
+        } else if constexpr (std::is_floating_point_v<T> || std::is_same_v<T, Float16T> || std::is_same_v<T, BFloat16T>) {
+            AppendFloat(out, static_cast<float>(elements[i]));
+        } else {
+            AppendNetwork(out, elements[i]);
+        }
+    }
+}
+
+void AppendEmbedding(String &out, const EmbeddingInfo &embedding_info, const char *data) {
+    // one dimensional array without nulls: ndim, flags, element oid, dimension, lower bound, (length, value) * dimension
+    auto [element_oid, element_size] = EmbeddingElement(embedding_info.Type());
+    SizeT dimension = embedding_info.Dimension();
+    out.reserve(out.size() + 5 * sizeof(i32) + dimension * (sizeof(i32) + element_size));
+    AppendNetwork(out, i32(1));
+    AppendNetwork(out, i32(0));
+    AppendNetwork(out, element_oid);
+    AppendNetwork(out, static_cast<i32>(dimension));
+    AppendNetwork(out, i32(1));
+    switch (embedding_info.Type()) {
+        case EmbeddingDataType::kElemUInt8: {
+            AppendEmbeddingElements<u8>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemInt8: {
+            AppendEmbeddingElements<i8>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemInt16: {
+            AppendEmbeddingElements<i16>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemInt32: {
+            AppendEmbeddingElements<i32>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemInt64: {
+            AppendEmbeddingElements<i64>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            AppendEmbeddingElements<Float16T>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            AppendEmbeddingElements<BFloat16T>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat: {
+            AppendEmbeddingElements<float>(out, data, dimension, element_size);
+            break;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            AppendEmbeddingElements<double>(out, data, dimension, element_size);
+            break;
+        }
+        default: {
+            UnrecoverableError("No binary format for the embedding element type");
+        }
+    }
+}
+
+} // namespace
+
+bool PGSupportsBinary(const DataType &column_type) {
+    switch (column_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+            return true;
+        case LogicalType::kEmbedding: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type.type_info().get());
+            return EmbeddingElement(embedding_info->Type()).second != 0;
+        }
+        default:
+            return false;
+    }
+}
+
+Optional<String> PGEncodeBinary(const ColumnVector &column, SizeT row_id) {
+    SizeT idx = column.vector_type() == ColumnVectorType::kConstant ? 0 : row_id;
+    if (!column.nulls_ptr_->IsTrue(idx)) {
+        return None;
+    }
+    const DataType &column_type = *column.data_type();
+    const char *data = column.data();
+    String out;
+    switch (column_type.type()) {
+        case LogicalType::kBoolean: {
+            out.push_back(column.buffer_->GetCompactBit(idx) ? 1 : 0);
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            out.push_back(reinterpret_cast<const TinyIntT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            AppendNetwork(out, reinterpret_cast<const SmallIntT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kInteger: {
+            AppendNetwork(out, reinterpret_cast<const IntegerT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            AppendNetwork(out, reinterpret_cast<const BigIntT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kFloat16: {
+            AppendFloat(out, static_cast<float>(reinterpret_cast<const Float16T *>(data)[idx]));
+            break;
+        }
+        case LogicalType::kBFloat16: {
+            AppendFloat(out, static_cast<float>(reinterpret_cast<const BFloat16T *>(data)[idx]));
+            break;
+        }
+        case LogicalType::kFloat: {
+            AppendFloat(out, reinterpret_cast<const FloatT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kDouble: {
+            AppendDouble(out, reinterpret_cast<const DoubleT *>(data)[idx]);
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type.type_info().get());
+            AppendEmbedding(out, *embedding_info, data + idx * column_type.Size());
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("No binary format for {}", column_type.ToString()));
+        }
+    }
+    return out;
+}
+
+} // namespace infinity
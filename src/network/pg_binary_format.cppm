@@ -0,0 +1,32 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_binary_format;
+
+import stl;
+import data_type;
+import column_vector;
+
+namespace infinity {
+
+// PG binary result format (send functions of the PG types) for the numeric and embedding columns, the other columns
+// are sent in text format.
+export bool PGSupportsBinary(const DataType &column_type);
+
+// Encodes the value at row_id in network byte order, nullopt for null.
+export Optional<String> PGEncodeBinary(const ColumnVector &column, SizeT row_id);
+
+} // namespace infinity
@@ -0,0 +1,255 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+module pg_extended_query;
+
+import stl;
+import status;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+bool IsNumberLiteral(const String &value) {
+    if (value.empty()) {
+        return false;
+    }
+    char *end = nullptr;
+    std::strtod(value.c_str(), &end);
+    return end == value.c_str() + value.size() && value.find_first_not_of("0123456789+-.eE") == String::npos;
+}
+
+// [1,2,3] from the text format of a PG array {1,2,3} or of an embedding [1,2,3]. The value must be one flat array of
+// numbers, the literal is rebuilt from the parsed numbers so nothing else reaches the statement.
+Optional<String> ArrayLiteral(const String &value) {
+    if (value.size() < 2) {
+        return None;
+    }
+    char close = 0;
+    if (value.front() == '{') {
+        close = '}';
+    } else if (value.front() == '[') {
+        close = ']';
+    } else {
+        return None;
+    }
+    if (value.back() != close) {
+        return None;
+    }
+    const std::string_view elements(value.data() + 1, value.size() - 2);
+    String literal = "[";
+    if (elements.find_first_not_of(' ') == std::string_view::npos) {
+        return literal + "]";
+    }
+    SizeT begin = 0;
+    while (true) {
+        SizeT end = std::min(elements.find(',', begin), elements.size());
+        std::string_view element = elements.substr(begin, end - begin);
+        element.remove_prefix(std::min(element.find_first_not_of(' '), element.size()));
+        element.remove_suffix(element.size() - std::min(element.find_last_not_of(' ') + 1, element.size()));
+        String number(element);
+        if (!IsNumberLiteral(number)) {
+            return None;
+        }
+        if (literal.size() > 1) {
+            literal += ',';
+        }
+        literal += number;
+        if (end == elements.size()) {
+            break;
+        }
+        begin = end + 1;
+    }
+    literal += ']';
+    return literal;
+}
+
+bool IsArrayType(u32 object_id) {
+    switch (object_id) {
+        case 1000:
+        case 1002:
+        case 1005:
+        case 1007:
+        case 1016:
+        case 1021:
+        case 1022:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+Optional<String> DecodeBinaryParameter(const String &value, u32 object_id) {
+    auto read_network = [&](SizeT size) {
+        u64 bits = 0;
+        for (SizeT i = 0; i < size; ++i) {
+            bits = (bits << 8) | static_cast<u8>(value[i]);
+        }
+        return bits;
+    };
+    switch (object_id) {
+        case 16: {
+            return value.size() == 1 ? Optional<String>(value[0] ? "true" : "false") : None;
+        }
+        case 21: {
+            return value.size() == 2 ? Optional<String>(std::to_string(static_cast<i16>(read_network(2)))) : None;
+        }
+        case 23: {
+            return value.size() == 4 ? Optional<String>(std::to_string(static_cast<i32>(read_network(4)))) : None;
+        }
+        case 20: {
+            return value.size() == 8 ? Optional<String>(std::to_string(static_cast<i64>(read_network(8)))) : None;
+        }
+        case 700: {
+            return value.size() == 4 ? Optional<String>(fmt::format("{}", std::bit_cast<float>(static_cast<u32>(read_network(4))))) : None;
+        }
+        case 701: {
+            return value.size() == 8 ? Optional<String>(fmt::format("{}", std::bit_cast<double>(read_network(8)))) : None;
+        }
+        default: {
+            return None;
+        }
+    }
+}
+
+Tuple<String, Status> ParameterLiteral(const Optional<String> &value, u32 object_id) {
+    if (!value.has_value()) {
+        return {"NULL", Status::OK()};
+    }
+    const String &text = *value;
+    switch (object_id) {
+        case 20:
+        case 21:
+        case 23:
+        case 700:
+        case 701:
+        case 1700: {
+            if (!IsNumberLiteral(text)) {
+                return {String(), Status::InvalidParameterValue("parameter", text, "number")};
+            }
+            // parenthesized, "-$1" must not become a comment
+            return {fmt::format("({})", text), Status::OK()};
+        }
+        case 16: {
+            bool true_value = text == "t" || text == "true" || text == "1";
+            return {true_value ? "true" : "false", Status::OK()};
+        }
+        default: {
+            break;
+        }
+    }
+    if (IsArrayType(object_id)) {
+        if (Optional<String> literal = ArrayLiteral(text); literal.has_value()) {
+            return {std::move(*literal), Status::OK()};
+        }
+        return {String(), Status::InvalidParameterValue("parameter", text, "array of numbers")};
+    }
+    // unspecified type (oid 0) and the other types are string literals
+    String literal = "'";
+    for (char c : text) {
+        literal.push_back(c);
+        if (c == '\'') {
+            literal.push_back(c);
+        }
+    }
+    literal.push_back('\'');
+    return {std::move(literal), Status::OK()};
+}
+
+SizeT ParameterCount(const String &query) {
+    SizeT count = 0;
+    bool quoted = false;
+    for (SizeT i = 0; i < query.size(); ++i) {
+        if (query[i] == '\'') {
+            quoted = !quoted;
+        } else if (!quoted && query[i] == '$' && i + 1 < query.size() && std::isdigit(static_cast<unsigned char>(query[i + 1]))) {
+            SizeT end = i + 1;
+            while (end < query.size() && std::isdigit(static_cast<unsigned char>(query[end]))) {
+                ++end;
+            }
+            count = std::max(count, static_cast<SizeT>(std::stoull(query.substr(i + 1, end - i - 1))));
+            i = end - 1;
+        }
+    }
+    return count;
+}
+
+String BindParameters(const String &query, const Vector<String> &literals) {
+    String bound;
+    bound.reserve(query.size());
+    bool quoted = false;
+    for (SizeT i = 0; i < query.size(); ++i) {
+        if (query[i] == '\'') {
+            quoted = !quoted;
+        } else if (!quoted && query[i] == '$' && i + 1 < query.size() && std::isdigit(static_cast<unsigned char>(query[i + 1]))) {
+            SizeT end = i + 1;
+            while (end < query.size() && std::isdigit(static_cast<unsigned char>(query[end]))) {
+                ++end;
+            }
+            SizeT parameter_idx = std::stoull(query.substr(i + 1, end - i - 1));
+            if (parameter_idx >= 1 && parameter_idx <= literals.size()) {
+                bound += literals[parameter_idx - 1];
+                i = end - 1;
+                continue;
+            }
+        }
+        bound.push_back(query[i]);
+    }
+    return bound;
+}
+
+bool ParseCopyFromStdin(const String &query, String &table_name, String &options) {
+    String text = query;
+    while (!text.empty() && (std::isspace(static_cast<unsigned char>(text.back())) || text.back() == ';')) {
+        text.pop_back();
+    }
+    std::istringstream stream(text);
+    String copy_keyword, from_keyword, stdin_keyword;
+    if (!(stream >> copy_keyword >> table_name >> from_keyword >> stdin_keyword)) {
+        return false;
+    }
+    ToLower(copy_keyword);
+    ToLower(from_keyword);
+    ToLower(stdin_keyword);
+    if (copy_keyword != "copy" || from_keyword != "from" || stdin_keyword != "stdin") {
+        return false;
+    }
+    String rest;
+    std::getline(stream, rest, '\0');
+    SizeT with_pos = rest.find_first_not_of(" \t\r\n");
+    if (with_pos == String::npos) {
+        options.clear();
+        return true;
+    }
+    String with_keyword = rest.substr(with_pos, 4);
+    ToLower(with_keyword);
+    SizeT open_pos = rest.find('(', with_pos);
+    SizeT close_pos = rest.rfind(')');
+    if (with_keyword != "with" || open_pos == String::npos || close_pos == String::npos || close_pos < open_pos) {
+        return false;
+    }
+    options = rest.substr(open_pos + 1, close_pos - open_pos - 1);
+    return true;
+}
+
+} // namespace infinity
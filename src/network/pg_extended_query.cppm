@@ -0,0 +1,43 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_extended_query;
+
+import stl;
+import status;
+
+namespace infinity {
+
+// The SQL parser has no placeholders, the $n of an extended query statement is bound by replacing it with the SQL
+// literal of parameter n.
+
+// Text of a binary format parameter, the numeric types only. None if the type or the size isn't supported.
+export Optional<String> DecodeBinaryParameter(const String &value, u32 object_id);
+
+// SQL literal of a text format parameter of type object_id: NULL, a parenthesized number, a boolean, an array of
+// numbers for the PG array types, a quoted string otherwise, including the unspecified type (oid 0).
+export Tuple<String, Status> ParameterLiteral(const Optional<String> &value, u32 object_id);
+
+// Number of the $n placeholders of the query, the largest n outside of the string literals
+export SizeT ParameterCount(const String &query);
+
+// The query with each $n outside of the string literals replaced by literals[n - 1], a $n out of range is kept.
+export String BindParameters(const String &query, const Vector<String> &literals);
+
+// COPY table FROM STDIN [WITH (options)], false if query isn't one.
+export bool ParseCopyFromStdin(const String &query, String &table_name, String &options);
+
+} // namespace infinity
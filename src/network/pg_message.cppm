@@ -40,6 +40,14 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
+    kEmptyQueryResponse = 'I',
+    kCopyInResponse = 'G',
+    kPortalSuspended = 's',
 
     // Errors
     kHumanReadableError = 'M',
@@ -58,6 +66,15 @@ enum class PGMessageType : unsigned char {
     kParseCommand = 'P',
     kSimpleQueryCommand = 'Q',
     kCloseCommand = 'C',
+    kCopyData = 'd',
+    kCopyDone = 'c',
+    kCopyFail = 'f',
+};
+
+// Format code of a parameter or result column
+enum class PGFormatCode : i16 {
+    kText = 0,
+    kBinary = 1,
 };
 
 enum class TransactionStateType : unsigned char {
@@ -19,6 +19,8 @@ import stl;
 import pg_message;
 module pg_protocol_handler;
 import global_resource_usage;
+import infinity_exception;
+import status;
 
 namespace infinity {
 
@@ -80,6 +82,11 @@ String PGProtocolHandler::read_command_body() {
     return buffer_reader_.read_string(command_length);
 }
 
+String PGProtocolHandler::read_message_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    return buffer_reader_.read_string(body_length, NullTerminator::kNo);
+}
+
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
     // message header
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kError));
@@ -115,7 +122,7 @@ void PGProtocolHandler::SendDescriptionHeader(u32 total_column_name_length, u32
     buffer_writer_.send_value_u16(column_count);
 }
 
-void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width) {
+void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format) {
     buffer_writer_.send_string(column_name);
 
     buffer_writer_.send_value_u32(0); // No OID for the table;
@@ -124,7 +131,7 @@ void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id
     buffer_writer_.send_value_u32(object_id); // OID of the type
     buffer_writer_.send_value_u16(width);     // Type width
     buffer_writer_.send_value_i32(-1);        // No modifier
-    buffer_writer_.send_value_i16(0);         // Text format
+    buffer_writer_.send_value_i16(static_cast<i16>(format));
 }
 
 void PGProtocolHandler::SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum) {
@@ -166,4 +173,60 @@ void PGProtocolHandler::SendComplete(const String &complete_message) {
     buffer_writer_.send_string(complete_message);
 }
 
+void PGProtocolHandler::SendEmptyMessage(PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &object_ids) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + object_ids.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(object_ids.size());
+    for (u32 object_id : object_ids) {
+        buffer_writer_.send_value_u32(object_id);
+    }
+}
+
+void PGProtocolHandler::SendCopyInResponse(u16 column_count) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kCopyInResponse));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(i8) + sizeof(u16) + column_count * sizeof(i16));
+    buffer_writer_.send_value_i8(static_cast<i8>(PGFormatCode::kText));
+    buffer_writer_.send_value_u16(column_count);
+    for (u16 idx = 0; idx < column_count; ++idx) {
+        buffer_writer_.send_value_i16(static_cast<i16>(PGFormatCode::kText));
+    }
+    buffer_writer_.flush();
+}
+
+const char *PGMessageReader::Consume(SizeT length) {
+    if (position_ + length > body_.size()) {
+        RecoverableError(Status::IOError("Truncated PG message."));
+    }
+    const char *data = body_.data() + position_;
+    position_ += length;
+    return data;
+}
+
+String PGMessageReader::read_string() {
+    SizeT end = body_.find(NULL_END, position_);
+    if (end == String::npos) {
+        RecoverableError(Status::IOError("Last character isn't null."));
+    }
+    String result = body_.substr(position_, end - position_);
+    position_ = end + 1;
+    return result;
+}
+
+String PGMessageReader::read_bytes(SizeT length) { return String(Consume(length), length); }
+
+i16 PGMessageReader::read_value_i16() {
+    const auto *data = reinterpret_cast<const u8 *>(Consume(sizeof(i16)));
+    return static_cast<i16>((u16(data[0]) << 8) | u16(data[1]));
+}
+
+i32 PGMessageReader::read_value_i32() {
+    const auto *data = reinterpret_cast<const u8 *>(Consume(sizeof(i32)));
+    return static_cast<i32>((u32(data[0]) << 24) | (u32(data[1]) << 16) | (u32(data[2]) << 8) | u32(data[3]));
+}
+
 } // namespace infinity
@@ -42,17 +42,30 @@ public:
 
     String read_command_body();
 
+    // Body of a message whose type is read, without the length field.
+    String read_message_body();
+
     void send_error_response(const HashMap<PGMessageType, String> &error_response_map);
     //
     //    String read_query_packet();
 
     void SendDescriptionHeader(u32 total_column_name_length, u32 column_count);
 
-    void SendDescription(const String &column_name, u32 object_id, u16 width);
+    void SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format = PGFormatCode::kText);
 
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
     void SendComplete(const String &complete_message);
+
+    // ParseComplete, BindComplete, CloseComplete, NoData and EmptyQueryResponse have no body.
+    void SendEmptyMessage(PGMessageType message_type);
+
+    void SendParameterDescription(const Vector<u32> &object_ids);
+
+    // Text format COPY of column_count columns
+    void SendCopyInResponse(u16 column_count);
+
+    void flush() { buffer_writer_.flush(); }
     //
     //    pair<String, String> read_parse_packet();
     //    void read_sync_packet();
@@ -66,4 +79,27 @@ private:
     BufferWriter buffer_writer_;
 };
 
+// Reads the fields of the body of an extended query message.
+export class PGMessageReader {
+public:
+    explicit PGMessageReader(const String &body) : body_(body) {}
+
+    // Null terminated string
+    String read_string();
+
+    String read_bytes(SizeT length);
+
+    i16 read_value_i16();
+
+    i32 read_value_i32();
+
+    u32 read_value_u32() { return static_cast<u32>(read_value_i32()); }
+
+private:
+    const char *Consume(SizeT length);
+
+    const String &body_;
+    SizeT position_{};
+};
+
 } // namespace infinity
\ No newline at end of file
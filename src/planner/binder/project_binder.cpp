@@ -58,6 +58,37 @@ void ConvertAvgToSumDivideCount(FunctionExpr &func_expression, const Vector<Stri
     func_expression.arguments_->push_back(createFunctionWithColumnArg("count"));
 }
 
+// The approximate aggregates are split into a mergeable sketch aggregate and a scalar estimate over the sketch:
+// approx_count_distinct(x) -> hll_estimate(hll_sketch(x))
+// approx_percentile(x, q) -> tdigest_quantile(tdigest_sketch(x), q)
+bool ConvertApproxAggregate(FunctionExpr &func_expression) {
+    const char *sketch_func_name = nullptr;
+    const char *estimate_func_name = nullptr;
+    SizeT argument_count = 0;
+    if (func_expression.func_name_ == "approx_count_distinct") {
+        sketch_func_name = "hll_sketch";
+        estimate_func_name = "hll_estimate";
+        argument_count = 1;
+    } else if (func_expression.func_name_ == "approx_percentile") {
+        sketch_func_name = "tdigest_sketch";
+        estimate_func_name = "tdigest_quantile";
+        argument_count = 2;
+    } else {
+        return false;
+    }
+    if (func_expression.arguments_ == nullptr || func_expression.arguments_->size() != argument_count) {
+        String error_message = fmt::format("{} requires {} argument(s).", func_expression.func_name_, argument_count);
+        RecoverableError(Status::SyntaxError(error_message));
+    }
+    auto sketch_expression = MakeUnique<FunctionExpr>();
+    sketch_expression->func_name_ = sketch_func_name;
+    sketch_expression->arguments_ = new Vector<ParsedExpr *>();
+    sketch_expression->arguments_->push_back((*func_expression.arguments_)[0]);
+    (*func_expression.arguments_)[0] = sketch_expression.release();
+    func_expression.func_name_ = estimate_func_name;
+    return true;
+}
+
 } // namespace
 
 namespace infinity {
@@ -75,6 +106,9 @@ SharedPtr<BaseExpression> ProjectBinder::BuildExpression(const ParsedExpr &expr,
         if (special_function.has_value()) {
             return ExpressionBinder::BuildExpression(expr, bind_context_ptr, depth, root);
         }
+        if (ConvertApproxAggregate(function_expression)) {
+            return ExpressionBinder::BuildExpression(expr, bind_context_ptr, depth, root);
+        }
         auto function_set_ptr = FunctionSet::GetFunctionSet(query_context_->storage()->new_catalog(), function_expression);
 
         if (IsEqual(function_set_ptr->name(), String("AVG")) && function_expression.arguments_->size() == 1 &&
@@ -80,6 +80,7 @@ import subquery_expr;
 import match_expr;
 import match_tensor_expr;
 import match_sparse_expr;
+import statement_common;
 import fusion_expr;
 import data_type;
 import expression_type;
@@ -894,7 +895,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildMatchTensorExpr(const MatchTens
     return bound_match_tensor_expr;
 }
 
-SharedPtr<BaseExpression> ExpressionBinder::BuildMatchSparseExpr(MatchSparseExpr &&expr, BindContext *bind_context_ptr, i64 depth, bool root) {
+SharedPtr<BaseExpression> ExpressionBinder::BuildMatchSparseExpr(const MatchSparseExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root) {
     if (expr.column_expr_->type_ != ParsedExprType::kColumn) {
         UnrecoverableError("MatchSparse expression expect a column expression");
     }
@@ -916,12 +917,18 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildMatchSparseExpr(MatchSparseExpr
     }
     // create optional filter
     auto optional_filter = BuildSearchSubExprOptionalFilter(this, expr.filter_expr_.get(), bind_context_ptr, depth);
+    // copied, the parsed statement of a prepared statement is bound again by the next execution
+    Vector<UniquePtr<InitParameter>> opt_params;
+    opt_params.reserve(expr.opt_params_.size());
+    for (const auto &param : expr.opt_params_) {
+        opt_params.push_back(MakeUnique<InitParameter>(*param));
+    }
     auto bound_match_sparse_expr = MakeShared<MatchSparseExpression>(std::move(arguments),
                                                                      query_expr,
                                                                      expr.metric_type_,
                                                                      expr.query_n_,
                                                                      expr.topn_,
-                                                                     std::move(expr.opt_params_),
+                                                                     std::move(opt_params),
                                                                      std::move(optional_filter),
                                                                      expr.index_name_,
                                                                      expr.ignore_index_);
@@ -959,7 +966,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildSearchExpr(const SearchExpr &ex
                 break;
             }
             case ParsedExprType::kMatchSparse: {
-                auto &match_sparse = const_cast<MatchSparseExpr &>(*static_cast<const MatchSparseExpr *>(match_expr));
+                const auto &match_sparse = *static_cast<const MatchSparseExpr *>(match_expr);
                 for (auto &param : match_sparse.opt_params_) {
                     if (param->param_name_ != "alpha" and param->param_name_ != "beta" and param->param_name_ != "tail" and
                         param->param_name_ != "threshold") {
@@ -969,7 +976,7 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildSearchExpr(const SearchExpr &ex
                 if (match_sparse.filter_expr_) {
                     have_filter_in_subsearch = true;
                 }
-                match_exprs.push_back(BuildMatchSparseExpr(std::move(match_sparse), bind_context_ptr, depth, false));
+                match_exprs.push_back(BuildMatchSparseExpr(match_sparse, bind_context_ptr, depth, false));
                 break;
             }
             default: {
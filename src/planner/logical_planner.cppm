@@ -64,6 +64,15 @@ public:
 #endif
     }
 
+    // Rebinds the planner to a new query context and drops the plans of the previous query.
+    void Reset(QueryContext *query_context_ptr) {
+        query_context_ptr_ = query_context_ptr;
+        names_ptr_->clear();
+        types_ptr_->clear();
+        logical_plan_.reset();
+        logical_plans_.clear();
+    }
+
     Status Build(const BaseStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildSelect(const SelectStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
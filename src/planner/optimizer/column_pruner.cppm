@@ -52,12 +52,13 @@ private:
 
 export class ColumnPruner : public OptimizerRule {
 public:
-    inline void ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) final { return remove_visitor.VisitNode(*logical_plan); }
+    // The visitor keeps the state of one plan, the rule is reused by the next query of the session.
+    inline void ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) final {
+        RemoveUnusedColumns remove_visitor{true};
+        return remove_visitor.VisitNode(*logical_plan);
+    }
 
     [[nodiscard]] inline String name() const final { return "Column Pruner"; }
-
-private:
-    RemoveUnusedColumns remove_visitor{true};
 };
 
 } // namespace infinity
\ No newline at end of file
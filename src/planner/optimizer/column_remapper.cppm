@@ -45,12 +45,12 @@ private:
 
 export class ColumnRemapper : public OptimizerRule {
 public:
-    inline void ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) final { return remapper_.VisitNode(*logical_plan); }
+    inline void ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) final {
+        BindingRemapper remapper{};
+        return remapper.VisitNode(*logical_plan);
+    }
 
     [[nodiscard]] inline String name() const final { return "Column Remapper"; }
-
-private:
-    BindingRemapper remapper_{};
 };
 
 } // namespace infinity
@@ -77,17 +77,16 @@ public:
             case LogicalNodeType::kCommand:
             case LogicalNodeType::kPrepare:
                 return;
-            default:
+            default: {
+                RefencecColumnCollection collector{};
+                CleanScan cleaner{};
                 collector.VisitNode(*logical_plan);
-                cleaner_.VisitNode(*logical_plan);
+                cleaner.VisitNode(*logical_plan);
+            }
         }
     }
 
     [[nodiscard]] inline String name() const final { return "Lazy Load"; }
-
-private:
-    RefencecColumnCollection collector{};
-    CleanScan cleaner_{};
 };
 
 export Optional<BaseTableRef *> GetScanTableRef(LogicalNode &op);
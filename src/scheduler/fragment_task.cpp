@@ -34,6 +34,7 @@ import base_table_ref;
 import defer_op;
 import fragment_context;
 import status;
+import data_block;
 import parser_assert;
 import infinity_context;
 
@@ -81,6 +82,7 @@ void FragmentTask::OnExecute() {
                 profiler.StartOperator(operator_refs[op_idx]);
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
 
+                operator_refs[op_idx]->InputMaterialize(operator_states_[op_idx].get());
                 operator_refs[op_idx]->InputLoad(query_context, operator_states_[op_idx].get(), table_refs);
                 execute_success = operator_refs[op_idx]->Execute(query_context, operator_states_[op_idx].get());
                 operator_refs[op_idx]->FillingTableRefs(table_refs);
@@ -113,6 +115,11 @@ void FragmentTask::OnExecute() {
         status_ = FragmentTaskStatus::kError;
     } else if (execute_success) {
         PhysicalSink *sink_op = fragment_context->GetSinkOperator();
+        if (OperatorState *prev_op_state = sink_state_->prev_op_state_; prev_op_state != nullptr) {
+            for (auto &data_block : prev_op_state->data_block_array_) {
+                data_block->Materialize();
+            }
+        }
         sink_op->Execute(query_context, fragment_context, sink_state_.get());
     }
 }
@@ -89,11 +89,11 @@ DumpIndexTask::DumpIndexTask(BaseMemIndex *mem_index, SharedPtr<NewTxn> &new_txn
 DumpIndexTask::DumpIndexTask(EMVBIndexInMem *emvb_mem_index, SharedPtr<NewTxn> &new_txn_shared)
     : BGTask(BGTaskType::kDumpIndex, true), emvb_mem_index_(emvb_mem_index), new_txn_shared_(new_txn_shared) {}
 
-AppendMemIndexTask::AppendMemIndexTask(const SharedPtr<MemIndex> &mem_index,
+AppendMemIndexTask::AppendMemIndexTask(const SharedPtr<MemoryIndexer> &memory_indexer,
                                        const SharedPtr<ColumnVector> &input_column,
                                        BlockOffset offset,
                                        BlockOffset row_cnt)
-    : BGTask(BGTaskType::kAppendMemIndex, false), mem_index_(mem_index), input_column_(input_column), offset_(offset), row_cnt_(row_cnt) {}
+    : BGTask(BGTaskType::kAppendMemIndex, false), memory_indexer_(memory_indexer), input_column_(input_column), offset_(offset), row_cnt_(row_cnt) {}
 
 void AppendMemIndexBatch::InsertTask(AppendMemIndexTask *task) {
     append_tasks_.emplace_back(task);
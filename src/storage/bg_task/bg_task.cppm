@@ -24,10 +24,10 @@ import bg_task_type;
 
 namespace infinity {
 
-struct MemIndex;
 struct ColumnVector;
 class BaseMemIndex;
 class EMVBIndexInMem;
+class MemoryIndexer;
 struct ChunkIndexEntry;
 class NewTxn;
 
@@ -157,14 +157,18 @@ public:
 
 export class AppendMemIndexTask final : public BGTask {
 public:
-    AppendMemIndexTask(const SharedPtr<MemIndex> &mem_index, const SharedPtr<ColumnVector> &input_column, BlockOffset offset, BlockOffset row_cnt);
+    AppendMemIndexTask(const SharedPtr<MemoryIndexer> &memory_indexer,
+                       const SharedPtr<ColumnVector> &input_column,
+                       BlockOffset offset,
+                       BlockOffset row_cnt);
 
     ~AppendMemIndexTask() override = default;
 
     String ToString() const override { return "AppendMemIndexTask"; }
 
 public:
-    SharedPtr<MemIndex> mem_index_{};
+    // The memory indexer is bound at append, it may be frozen for dump before the task is processed.
+    SharedPtr<MemoryIndexer> memory_indexer_{};
     SharedPtr<ColumnVector> input_column_{};
     BlockOffset offset_{};
     BlockOffset row_cnt_{};
@@ -26,17 +26,26 @@ import logger;
 import persistence_manager;
 import serialize;
 import local_file_handle;
+import column_block_encoding;
 
 namespace infinity {
 
+namespace {
+
+constexpr u64 kPlainMagicNumber = 0x00dd3344;
+constexpr u64 kEncodedMagicNumber = 0x00dd3345;
+
+} // namespace
+
 DataFileWorker::DataFileWorker(SharedPtr<String> data_dir,
                                SharedPtr<String> temp_dir,
                                SharedPtr<String> file_dir,
                                SharedPtr<String> file_name,
                                SizeT buffer_size,
-                               PersistenceManager *persistence_manager)
+                               PersistenceManager *persistence_manager,
+                               SizeT value_width)
     : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name), persistence_manager),
-      buffer_size_(buffer_size) {}
+      buffer_size_(buffer_size), value_width_(value_width) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -71,10 +80,17 @@ bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
     // File structure:
     // - header: magic number
     // - header: buffer size
-    // - data buffer
+    // - (encoded only) header: encoded size
+    // - data buffer, plain or encoded by ColumnBlockEncoding
     // - footer: checksum
 
-    u64 magic_number = 0x00dd3344;
+    // spill files are read back soon, keep them plain
+    Vector<char> encoded;
+    if (!to_spill) {
+        encoded = ColumnBlockEncoding::Encode(static_cast<const char *>(data_), buffer_size_, value_width_);
+    }
+
+    u64 magic_number = encoded.empty() ? kPlainMagicNumber : kEncodedMagicNumber;
     Status status = file_handle_->Append(&magic_number, sizeof(magic_number));
     if (!status.ok()) {
         RecoverableError(status);
@@ -85,9 +101,21 @@ bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
         RecoverableError(status);
     }
 
-    status = file_handle_->Append(data_, buffer_size_);
-    if (!status.ok()) {
-        RecoverableError(status);
+    if (encoded.empty()) {
+        status = file_handle_->Append(data_, buffer_size_);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    } else {
+        u64 encoded_size = encoded.size();
+        status = file_handle_->Append(&encoded_size, sizeof(encoded_size));
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        status = file_handle_->Append(encoded.data(), encoded_size);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
     }
 
     u64 checksum{};
@@ -116,8 +144,8 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes1));
         RecoverableError(status);
     }
-    if (magic_number != 0x00dd3344) {
-        Status status = Status::DataIOError(fmt::format("Read magic error, {} != 0x00dd3344.", magic_number));
+    if (magic_number != kPlainMagicNumber && magic_number != kEncodedMagicNumber) {
+        Status status = Status::DataIOError(fmt::format("Read magic error, expect {:#010x} or {:#010x}, but got {:#010x}.", kPlainMagicNumber, kEncodedMagicNumber, magic_number));
         RecoverableError(status);
     }
 
@@ -128,17 +156,35 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
         RecoverableError(status2);
     }
 
-    if (file_size != buffer_size_ + 3 * sizeof(u64)) {
-        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
-        RecoverableError(status);
-    }
-
     // file body
-    data_ = static_cast<void *>(new char[buffer_size_]);
-    auto [nbytes3, status3] = file_handle_->Read(data_, buffer_size_);
-    if (nbytes3 != buffer_size_) {
-        Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes3));
-        RecoverableError(status);
+    if (magic_number == kPlainMagicNumber) {
+        if (file_size != buffer_size_ + 3 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
+            RecoverableError(status);
+        }
+
+        data_ = static_cast<void *>(new char[buffer_size_]);
+        auto [nbytes3, status3] = file_handle_->Read(data_, buffer_size_);
+        if (nbytes3 != buffer_size_) {
+            Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes3));
+            RecoverableError(status);
+        }
+    } else {
+        u64 encoded_size{};
+        auto [nbytes3, status3] = file_handle_->Read(&encoded_size, sizeof(encoded_size));
+        if (nbytes3 != sizeof(encoded_size) || file_size != encoded_size + 4 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 4 * sizeof(u64)));
+            RecoverableError(status);
+        }
+
+        auto encoded = MakeUniqueForOverwrite<char[]>(encoded_size);
+        auto [nbytes4, status4] = file_handle_->Read(encoded.get(), encoded_size);
+        if (nbytes4 != encoded_size) {
+            Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", encoded_size, nbytes4));
+            RecoverableError(status);
+        }
+        data_ = static_cast<void *>(new char[buffer_size_]);
+        ColumnBlockEncoding::Decode(encoded.get(), encoded_size, static_cast<char *>(data_), buffer_size_);
     }
 
     // file footer: checksum
@@ -153,21 +199,34 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size, bool from_spill) {
 bool DataFileWorker::ReadFromMmapImpl(const void *p, SizeT file_size) {
     const char *ptr = static_cast<const char *>(p);
     u64 magic_number = ReadBufAdv<u64>(ptr);
-    if (magic_number != 0x00dd3344) {
-        Status status = Status::DataIOError(fmt::format("Read magic error: {} != 0x00dd3344.", magic_number));
+    if (magic_number != kPlainMagicNumber && magic_number != kEncodedMagicNumber) {
+        Status status = Status::DataIOError(fmt::format("Read magic error, expect {:#010x} or {:#010x}, but got {:#010x}.", kPlainMagicNumber, kEncodedMagicNumber, magic_number));
         RecoverableError(status);
     }
     u64 buffer_size = ReadBufAdv<u64>(ptr);
-    if (file_size != buffer_size + 3 * sizeof(u64)) {
-        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size + 3 * sizeof(u64)));
-        RecoverableError(status);
+    if (magic_number == kPlainMagicNumber) {
+        if (file_size != buffer_size + 3 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size + 3 * sizeof(u64)));
+            RecoverableError(status);
+        }
+        // zero copy
+        mmap_data_ = const_cast<u8 *>(reinterpret_cast<const u8 *>(ptr));
+        ptr += buffer_size;
+    } else {
+        u64 encoded_size = ReadBufAdv<u64>(ptr);
+        if (file_size != encoded_size + 4 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 4 * sizeof(u64)));
+            RecoverableError(status);
+        }
+        mmap_decoded_data_ = MakeUniqueForOverwrite<char[]>(buffer_size);
+        ColumnBlockEncoding::Decode(ptr, encoded_size, mmap_decoded_data_.get(), buffer_size);
+        mmap_data_ = reinterpret_cast<u8 *>(mmap_decoded_data_.get());
+        ptr += encoded_size;
     }
-    mmap_data_ = const_cast<u8 *>(reinterpret_cast<const u8 *>(ptr));
-    ptr += buffer_size;
     [[maybe_unused]] u64 checksum = ReadBufAdv<u64>(ptr);
     return true;
 }
 
-void DataFileWorker::FreeFromMmapImpl() {}
+void DataFileWorker::FreeFromMmapImpl() { mmap_decoded_data_.reset(); }
 
 } // namespace infinity
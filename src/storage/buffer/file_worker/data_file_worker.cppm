@@ -30,7 +30,8 @@ public:
                             SharedPtr<String> file_dir,
                             SharedPtr<String> file_name,
                             SizeT buffer_size,
-                            PersistenceManager *persistence_manager);
+                            PersistenceManager *persistence_manager,
+                            SizeT value_width = 0);
 
     virtual ~DataFileWorker() override;
 
@@ -54,5 +55,9 @@ protected:
 
 private:
     const SizeT buffer_size_;
+    // width of the fixed size values in the buffer, the block is encoded when it is 1, 2, 4 or 8. 0 keeps it plain.
+    const SizeT value_width_;
+    // decoded data of an encoded file, which can not be used from mmap directly
+    UniquePtr<char[]> mmap_decoded_data_;
 };
 } // namespace infinity
\ No newline at end of file
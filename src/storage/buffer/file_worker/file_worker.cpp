@@ -33,6 +33,8 @@ import persistence_manager;
 import infinity_context;
 import logger;
 import persist_result_handler;
+import obj_prefetcher;
+import storage;
 import global_resource_usage;
 import kv_code;
 import kv_store;
@@ -198,6 +200,10 @@ Pair<Optional<DeferFn<std::function<void()>>>, String> FileWorker::GetFilePathIn
                 handler.HandleWriteResult(res);
             }
         }));
+        Storage *storage = InfinityContext::instance().storage();
+        if (result.obj_stat_ != nullptr && storage != nullptr && storage->obj_prefetcher() != nullptr) {
+            storage->obj_prefetcher()->RecordMiss(read_path);
+        }
         PersistResultHandler handler = PersistResultHandler(persistence_manager_);
         obj_addr_ = handler.HandleReadResult(result);
         if (!obj_addr_.Valid()) {
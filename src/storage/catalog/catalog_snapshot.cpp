@@ -0,0 +1,114 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <mutex>
+#include <shared_mutex>
+
+module catalog_snapshot;
+
+import stl;
+
+namespace infinity {
+
+String CatalogSnapshotCache::TableKey(const String &key) {
+    // catalog|seg|{db_id}|{table_id}|{segment_id}
+    // catalog|blk|{db_id}|{table_id}|{segment_id}|{block_id}
+    static constexpr std::string_view kSegmentPrefix = "catalog|seg|";
+    static constexpr std::string_view kBlockPrefix = "catalog|blk|";
+    if (!key.starts_with(kSegmentPrefix) && !key.starts_with(kBlockPrefix)) {
+        return {};
+    }
+    SizeT db_begin = kSegmentPrefix.size();
+    SizeT db_end = key.find('|', db_begin);
+    if (db_end == String::npos) {
+        return {};
+    }
+    SizeT table_end = key.find('|', db_end + 1);
+    if (table_end == String::npos) {
+        return {};
+    }
+    return key.substr(db_begin, table_end - db_begin);
+}
+
+SharedPtr<const CatalogIDList> CatalogSnapshotCache::Get(const String &table_key, const String &prefix, u64 read_seq) const {
+    std::shared_lock lock(mtx_);
+    auto table_iter = tables_.find(table_key);
+    if (table_iter == tables_.end()) {
+        return nullptr;
+    }
+    const TableSnapshot &table = table_iter->second;
+    if (table.committing_count_ > 0 || read_seq < table.last_commit_seq_) {
+        return nullptr;
+    }
+    auto list_iter = table.lists_.find(prefix);
+    if (list_iter == table.lists_.end()) {
+        return nullptr;
+    }
+    const auto &[built_seq, ids] = list_iter->second;
+    if (built_seq < table.last_commit_seq_) {
+        return nullptr;
+    }
+    return ids;
+}
+
+void CatalogSnapshotCache::Publish(const String &table_key, const String &prefix, u64 read_seq, SharedPtr<const CatalogIDList> ids) {
+    std::unique_lock lock(mtx_);
+    TableSnapshot &table = tables_[table_key];
+    if (table.committing_count_ > 0 || read_seq < table.last_commit_seq_) {
+        // the reader snapshot is older than the table, or a commit may be visible to it partially
+        return;
+    }
+    auto &[built_seq, list] = table.lists_[prefix];
+    if (list != nullptr && built_seq >= read_seq) {
+        return;
+    }
+    built_seq = read_seq;
+    list = std::move(ids);
+}
+
+void CatalogSnapshotCache::BeginCommit(const HashSet<String> &table_keys) {
+    std::unique_lock lock(mtx_);
+    for (const String &table_key : table_keys) {
+        TableSnapshot &table = tables_[table_key];
+        ++table.committing_count_;
+        table.lists_.clear();
+    }
+}
+
+void CatalogSnapshotCache::EndCommit(const HashSet<String> &table_keys, u64 commit_seq) {
+    std::unique_lock lock(mtx_);
+    for (const String &table_key : table_keys) {
+        auto iter = tables_.find(table_key);
+        if (iter == tables_.end()) {
+            continue;
+        }
+        TableSnapshot &table = iter->second;
+        --table.committing_count_;
+        table.last_commit_seq_ = std::max(table.last_commit_seq_, commit_seq);
+        table.lists_.clear();
+    }
+}
+
+SizeT CatalogSnapshotCache::ListCount() const {
+    std::shared_lock lock(mtx_);
+    SizeT count = 0;
+    for (const auto &[table_key, table] : tables_) {
+        count += table.lists_.size();
+    }
+    return count;
+}
+
+} // namespace infinity
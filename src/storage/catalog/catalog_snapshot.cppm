@@ -0,0 +1,59 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module catalog_snapshot;
+
+import stl;
+
+namespace infinity {
+
+// (id, commit_ts) of the segment or block keys under a prefix, sorted by id
+export using CatalogIDList = Vector<Pair<u64, TxnTimeStamp>>;
+
+// In memory snapshot of the segment and block id lists of the tables, RocksDB is the durable backing.
+// A list is the content of the prefix in a RocksDB snapshot of sequence number built_seq. Every commit writing
+// the segment or block keys of a table is bracketed by BeginCommit / EndCommit, which drops the lists of the table
+// and records the sequence number of the commit. A list is valid for a reader of RocksDB snapshot read_seq when no
+// commit of the table is in flight and both built_seq and read_seq include the last commit of the table, so the
+// reader sees exactly the same keys as an iteration of its own snapshot.
+export class CatalogSnapshotCache {
+public:
+    // "db_id|table_id" of a segment / block key or prefix, empty for other keys.
+    static String TableKey(const String &key);
+
+    SharedPtr<const CatalogIDList> Get(const String &table_key, const String &prefix, u64 read_seq) const;
+
+    void Publish(const String &table_key, const String &prefix, u64 read_seq, SharedPtr<const CatalogIDList> ids);
+
+    void BeginCommit(const HashSet<String> &table_keys);
+
+    // commit_seq is an upper bound of the sequence number of the commit, the latest sequence number after it.
+    void EndCommit(const HashSet<String> &table_keys, u64 commit_seq);
+
+    SizeT ListCount() const;
+
+private:
+    struct TableSnapshot {
+        SizeT committing_count_{};
+        u64 last_commit_seq_{};
+        HashMap<String, Pair<u64, SharedPtr<const CatalogIDList>>> lists_{}; // prefix -> (built_seq, ids)
+    };
+
+    mutable std::shared_mutex mtx_{};
+    HashMap<String, TableSnapshot> tables_{};
+};
+
+} // namespace infinity
@@ -23,6 +23,8 @@ import status;
 import third_party;
 import rocksdb_merge_operator;
 import logger;
+import catalog_snapshot;
+import kv_value;
 
 namespace infinity {
 
@@ -67,8 +69,16 @@ KVInstance::~KVInstance() {
     }
 }
 
+void KVInstance::MarkWrite(const String &key) {
+    String table_key = CatalogSnapshotCache::TableKey(key);
+    if (!table_key.empty()) {
+        written_tables_.insert(std::move(table_key));
+    }
+}
+
 Status KVInstance::Put(const String &key, const String &value) {
     //    LOG_TRACE(fmt::format("To put key: {}, value: {}", key, value));
+    MarkWrite(key);
     rocksdb::Status s = transaction_->Put(key, value);
     if (!s.ok()) {
         String msg = fmt::format("rocksdb::Transaction::Put key: {}, value: {}", key, value);
@@ -80,6 +90,7 @@ Status KVInstance::Put(const String &key, const String &value) {
 
 Status KVInstance::Delete(const String &key) {
     //    LOG_TRACE(fmt::format("To delete key: {}", key));
+    MarkWrite(key);
     rocksdb::Status s = transaction_->Delete(key);
     if (!s.ok()) {
         String msg = fmt::format("rocksdb::Transaction::Delete key: {}", key);
@@ -146,8 +157,45 @@ Vector<Pair<String, String>> KVInstance::GetAllKeyValue() {
     return result;
 }
 
+SharedPtr<const CatalogIDList> KVInstance::GetCatalogIDs(const String &prefix) {
+    String table_key = CatalogSnapshotCache::TableKey(prefix);
+    bool use_snapshot = snapshot_cache_ != nullptr && read_options_.snapshot != nullptr && !table_key.empty() && !written_tables_.contains(table_key);
+    u64 read_seq = 0;
+    if (use_snapshot) {
+        read_seq = read_options_.snapshot->GetSequenceNumber();
+        SharedPtr<const CatalogIDList> ids = snapshot_cache_->Get(table_key, prefix, read_seq);
+        if (ids != nullptr) {
+            return ids;
+        }
+    }
+
+    auto ids = MakeShared<CatalogIDList>();
+    auto iter = GetIterator();
+    iter->Seek(prefix);
+    while (iter->Valid() && iter->Key().starts_with(prefix)) {
+        u64 id = std::stoull(iter->Key().ToString().substr(prefix.size()));
+        TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
+        ids->emplace_back(id, commit_ts);
+        iter->Next();
+    }
+    std::sort(ids->begin(), ids->end());
+    if (use_snapshot) {
+        snapshot_cache_->Publish(table_key, prefix, read_seq, ids);
+    }
+    return ids;
+}
+
 Status KVInstance::Commit() {
+    bool publish = snapshot_cache_ != nullptr && !written_tables_.empty();
+    if (publish) {
+        snapshot_cache_->BeginCommit(written_tables_);
+    }
     rocksdb::Status s = transaction_->Commit();
+    if (publish) {
+        // the failed commit is published too, it only costs a reload
+        snapshot_cache_->EndCommit(written_tables_, transaction_db_->GetLatestSequenceNumber());
+        written_tables_.clear();
+    }
     if (!s.ok()) {
         String msg("rocksdb::Transaction::Commit");
         return Status::RocksDBError(std::move(s), msg);
@@ -187,12 +235,14 @@ Status KVStore::Init(const String &db_path) {
         String msg = fmt::format("rocksdb::TransactionDB::Open db path: {}", db_path);
         return Status::RocksDBError(std::move(s), msg);
     }
+    snapshot_cache_ = MakeUnique<CatalogSnapshotCache>();
     return Status::OK();
 }
 
 Status KVStore::Uninit() {
     delete transaction_db_;
     transaction_db_ = nullptr;
+    snapshot_cache_.reset();
     LOG_INFO("KV store is stopped.");
     return Status::OK();
 }
@@ -245,11 +295,21 @@ UniquePtr<KVInstance> KVStore::GetInstance() {
     UniquePtr<KVInstance> kv_instance = MakeUnique<KVInstance>();
     kv_instance->transaction_ = transaction_db_->BeginTransaction(write_options_, txn_options_);
     kv_instance->read_options_.snapshot = kv_instance->transaction_->GetSnapshot();
+    kv_instance->transaction_db_ = transaction_db_;
+    kv_instance->snapshot_cache_ = snapshot_cache_.get();
     return kv_instance;
 }
 
 Status KVStore::Put(const String &key, const String &value) {
+    HashSet<String> table_keys;
+    if (String table_key = CatalogSnapshotCache::TableKey(key); !table_key.empty()) {
+        table_keys.insert(std::move(table_key));
+        snapshot_cache_->BeginCommit(table_keys);
+    }
     rocksdb::Status s = transaction_db_->Put(write_options_, key, value);
+    if (!table_keys.empty()) {
+        snapshot_cache_->EndCommit(table_keys, transaction_db_->GetLatestSequenceNumber());
+    }
     if (!s.ok()) {
         String msg = fmt::format("rocksdb::TransactionDB::Put key: {}, value: {}", key, value);
         return Status::RocksDBError(std::move(s), msg);
@@ -258,7 +318,15 @@ Status KVStore::Put(const String &key, const String &value) {
 }
 
 Status KVStore::Delete(const String &key) {
+    HashSet<String> table_keys;
+    if (String table_key = CatalogSnapshotCache::TableKey(key); !table_key.empty()) {
+        table_keys.insert(std::move(table_key));
+        snapshot_cache_->BeginCommit(table_keys);
+    }
     rocksdb::Status s = transaction_db_->Delete(write_options_, key);
+    if (!table_keys.empty()) {
+        snapshot_cache_->EndCommit(table_keys, transaction_db_->GetLatestSequenceNumber());
+    }
     if (!s.ok()) {
         String msg = fmt::format("rocksdb::TransactionDB::Delete key: {}", key);
         return Status::RocksDBError(std::move(s), msg);
@@ -19,6 +19,7 @@ export module kv_store;
 import stl;
 import third_party;
 import status;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -59,12 +60,22 @@ public:
     UniquePtr<KVIterator> GetIterator(const char *lower_bound_key, const char *upper_bound_key);
     Vector<Pair<String, String>> GetAllKeyValue();
 
+    // (id, commit_ts) of the segment or block keys under the prefix, served from the catalog snapshot when this
+    // instance hasn't written the keys of the table.
+    SharedPtr<const CatalogIDList> GetCatalogIDs(const String &prefix);
+
     Status Commit();
     Status Rollback();
 
 private:
+    void MarkWrite(const String &key);
+
     rocksdb::Transaction *transaction_{};
     rocksdb::ReadOptions read_options_;
+
+    rocksdb::TransactionDB *transaction_db_{};
+    CatalogSnapshotCache *snapshot_cache_{};
+    HashSet<String> written_tables_{}; // tables whose segment or block keys are written by this instance
 };
 
 class KVStore {
@@ -89,6 +100,8 @@ public:
     SizeT KeyValueNum() const;
     Vector<Pair<String, String>> GetAllKeyValue();
 
+    CatalogSnapshotCache *snapshot_cache() const { return snapshot_cache_.get(); }
+
     // For UT
     static Status Destroy(const String &db_path);
 
@@ -100,6 +113,8 @@ private:
     rocksdb::TransactionOptions txn_options_;
     rocksdb::WriteOptions write_options_;
     rocksdb::ReadOptions read_options_;
+
+    UniquePtr<CatalogSnapshotCache> snapshot_cache_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -21,7 +21,9 @@ module kv_utility;
 
 import stl;
 import kv_code;
+import kv_value;
 import kv_store;
+import catalog_snapshot;
 // import status;
 import index_base;
 import third_party;
@@ -42,21 +44,16 @@ Vector<SegmentID> GetTableSegments(KVInstance *kv_instance, const String &db_id_
     Vector<SegmentID> segment_ids;
 
     String segment_id_prefix = KeyEncode::CatalogTableSegmentKeyPrefix(db_id_str, table_id_str);
-    auto iter = kv_instance->GetIterator();
-    iter->Seek(segment_id_prefix);
-    while (iter->Valid() && iter->Key().starts_with(segment_id_prefix)) {
-        TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+    SharedPtr<const CatalogIDList> ids = kv_instance->GetCatalogIDs(segment_id_prefix);
+    segment_ids.reserve(ids->size());
+    for (const auto &[segment_id, commit_ts] : *ids) {
         if (commit_ts > begin_ts and commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
-            LOG_DEBUG(fmt::format("SKIP SEGMENT: {} {} {}", iter->Key().ToString(), commit_ts, begin_ts));
-            iter->Next();
+            LOG_DEBUG(fmt::format("SKIP SEGMENT: {}{} {} {}", segment_id_prefix, segment_id, commit_ts, begin_ts));
             continue;
         }
         // the key is committed before the txn or the key isn't committed
-        SegmentID segment_id = std::stoull(iter->Key().ToString().substr(segment_id_prefix.size()));
         segment_ids.push_back(segment_id);
-        iter->Next();
     }
-    std::sort(segment_ids.begin(), segment_ids.end());
     return segment_ids;
 }
 
@@ -74,7 +71,7 @@ Vector<SegmentID> GetTableIndexSegments(KVInstance *kv_instance,
         String key = iter->Key().ToString();
         auto [segment_id, is_segment_id] = ExtractU64FromStringSuffix(key, segment_id_prefix.size());
         if (is_segment_id) {
-            TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+            TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
             if (commit_ts > begin_ts and commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
                 LOG_DEBUG(fmt::format("SKIP SEGMENT INDEX: {} {} {}", iter->Key().ToString(), commit_ts, begin_ts));
                 iter->Next();
@@ -100,22 +97,16 @@ Vector<BlockID> GetTableSegmentBlocks(KVInstance *kv_instance,
     Vector<BlockID> block_ids;
 
     String block_id_prefix = KeyEncode::CatalogTableSegmentBlockKeyPrefix(db_id_str, table_id_str, segment_id);
-    auto iter = kv_instance->GetIterator();
-    iter->Seek(block_id_prefix);
-    while (iter->Valid() && iter->Key().starts_with(block_id_prefix)) {
-        TxnTimeStamp block_commit_ts = std::stoull(iter->Value().ToString());
+    SharedPtr<const CatalogIDList> ids = kv_instance->GetCatalogIDs(block_id_prefix);
+    block_ids.reserve(ids->size());
+    for (const auto &[block_id, block_commit_ts] : *ids) {
         if (block_commit_ts > begin_ts and block_commit_ts != commit_ts and block_commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
-            LOG_DEBUG(fmt::format("SKIP BLOCK: {} {} {}", iter->Key().ToString(), block_commit_ts, begin_ts));
-            iter->Next();
+            LOG_DEBUG(fmt::format("SKIP BLOCK: {}{} {} {}", block_id_prefix, block_id, block_commit_ts, begin_ts));
             continue;
         }
         // the key is committed before the txn or the key isn't committed
-        BlockID block_id = std::stoull(iter->Key().ToString().substr(block_id_prefix.size()));
         block_ids.push_back(block_id);
-        iter->Next();
     }
-
-    std::sort(block_ids.begin(), block_ids.end());
     return block_ids;
 }
 
@@ -130,7 +121,7 @@ Vector<ColumnID> GetTableSegmentBlockColumns(KVInstance *kv_instance,
     auto iter = kv_instance->GetIterator();
     iter->Seek(block_column_id_prefix);
     while (iter->Valid() && iter->Key().starts_with(block_column_id_prefix)) {
-        TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+        TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
         if (commit_ts > begin_ts) {
             LOG_DEBUG(fmt::format("SKIP BLOCK COLUMN: {} {} {}", iter->Key().ToString(), commit_ts, begin_ts));
             iter->Next();
@@ -43,6 +43,45 @@ void MemIndex::ClearMemIndex() {
     memory_secondary_index_.reset();
     memory_emvb_index_.reset();
     memory_bmp_index_.reset();
+    dumping_hnsw_index_.reset();
+    dumping_memory_indexer_.reset();
+}
+
+bool MemIndex::FreezeMemIndex() {
+    // Wait for the append inserting into the mem index out of mtx_, the frozen mem index is read only.
+    std::unique_lock<std::shared_mutex> append_lock(append_mtx_);
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    if (dumping_hnsw_index_.get() != nullptr || dumping_memory_indexer_.get() != nullptr) {
+        return true;
+    }
+    if (memory_hnsw_index_.get() != nullptr) {
+        dumping_hnsw_index_ = std::move(memory_hnsw_index_);
+        return true;
+    }
+    if (memory_indexer_.get() != nullptr) {
+        dumping_memory_indexer_ = std::move(memory_indexer_);
+        return true;
+    }
+    return false;
+}
+
+void MemIndex::ClearDumpingMemIndex() {
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    dumping_hnsw_index_.reset();
+    dumping_memory_indexer_.reset();
+}
+
+const BaseMemIndex *MemIndex::GetDumpingBaseMemIndex() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (dumping_hnsw_index_.get() != nullptr) {
+        return static_cast<const BaseMemIndex *>(dumping_hnsw_index_.get());
+    }
+    if (dumping_memory_indexer_.get() != nullptr) {
+        return static_cast<const BaseMemIndex *>(dumping_memory_indexer_.get());
+    }
+    return nullptr;
 }
 
 BaseMemIndex *MemIndex::GetBaseMemIndex(const MemIndexID &mem_index_id) {
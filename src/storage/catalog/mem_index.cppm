@@ -40,6 +40,13 @@ export struct MemIndex {
 
     void ClearMemIndex();
 
+    // Swap the hnsw / full text mem index out to be dumped, so that the following appends go to a new mem index instead of
+    // waiting for the dump. A mem index left by a dump which failed to commit is dumped again rather than freezing another one.
+    // Returns false if there is no such mem index.
+    bool FreezeMemIndex();
+    void ClearDumpingMemIndex();
+    const BaseMemIndex *GetDumpingBaseMemIndex() const;
+
     BaseMemIndex *GetBaseMemIndex(const MemIndexID &mem_index_id);
     const BaseMemIndex *GetBaseMemIndex() const;
     void SetBaseMemIndexInfo(const String &db_name, const String &table_name, const String &index_name, const SegmentID &segment_id);
@@ -73,7 +80,17 @@ export struct MemIndex {
         return memory_bmp_index_;
     }
 
+    SharedPtr<HnswIndexInMem> GetDumpingHnswIndex() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return dumping_hnsw_index_;
+    }
+    SharedPtr<MemoryIndexer> GetDumpingFulltextIndex() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return dumping_memory_indexer_;
+    }
+
     mutable std::mutex mtx_; // Used by append / mem index dump / clear
+    std::shared_mutex append_mtx_; // Held shared by append while it inserts out of mtx_, held exclusively by freeze
 
     SharedPtr<HnswIndexInMem> memory_hnsw_index_{};
     SharedPtr<IVFIndexInMem> memory_ivf_index_{};
@@ -81,6 +98,10 @@ export struct MemIndex {
     SharedPtr<SecondaryIndexInMem> memory_secondary_index_{};
     SharedPtr<EMVBIndexInMem> memory_emvb_index_{};
     SharedPtr<BMPIndexInMem> memory_bmp_index_{};
+
+    // Frozen mem index being dumped, searched along with the active one until the dump is committed.
+    SharedPtr<HnswIndexInMem> dumping_hnsw_index_{};
+    SharedPtr<MemoryIndexer> dumping_memory_indexer_{};
 };
 
 } // namespace infinity
\ No newline at end of file
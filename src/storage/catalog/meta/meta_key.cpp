@@ -23,6 +23,7 @@ import column_def;
 import utility;
 import third_party;
 import kv_code;
+import kv_value;
 import infinity_exception;
 import meta_type;
 import default_values;
@@ -199,7 +200,12 @@ nlohmann::json TableIndexMetaKey::ToJson() const {
 
 nlohmann::json TableIndexTagMetaKey::ToJson() const {
     nlohmann::json json_res;
-    json_res[tag_name_] = nlohmann::json::parse(value_);
+    if (KVValue::IsBinary(value_)) {
+        // the segment_ids tag
+        json_res[tag_name_] = KVValue::DecodeIDs(value_);
+    } else {
+        json_res[tag_name_] = nlohmann::json::parse(value_);
+    }
     return json_res;
 }
 
@@ -214,7 +220,12 @@ nlohmann::json SegmentIndexMetaKey::ToJson() const {
 
 nlohmann::json SegmentIndexTagMetaKey::ToJson() const {
     nlohmann::json json_res;
-    json_res[tag_name_] = nlohmann::json::parse(value_);
+    if (KVValue::IsBinary(value_)) {
+        // the chunk_ids tag
+        json_res[tag_name_] = KVValue::DecodeIDs(value_);
+    } else {
+        json_res[tag_name_] = nlohmann::json::parse(value_);
+    }
     return json_res;
 }
 
@@ -293,7 +304,7 @@ SharedPtr<MetaKey> MetaParse(const String &key, const String &value) {
         const String &commit_ts_str = value;
         SegmentID segment_id = std::stoul(segment_id_str);
         auto segment_meta_key = MakeShared<SegmentMetaKey>(db_id_str, table_id_str, segment_id);
-        segment_meta_key->commit_ts_ = std::stoull(commit_ts_str);
+        segment_meta_key->commit_ts_ = KVValue::DecodeTimestamp(commit_ts_str);
         return segment_meta_key;
     }
 
@@ -332,7 +343,7 @@ SharedPtr<MetaKey> MetaParse(const String &key, const String &value) {
         SegmentID segment_id = std::stoul(segment_id_str);
         BlockID block_id = std::stoul(block_id_str);
         auto block_meta_key = MakeShared<BlockMetaKey>(db_id_str, table_id_str, segment_id, block_id);
-        block_meta_key->commit_ts_ = std::stoull(commit_ts_str);
+        block_meta_key->commit_ts_ = KVValue::DecodeTimestamp(commit_ts_str);
         return block_meta_key;
     }
 
@@ -396,7 +407,7 @@ SharedPtr<MetaKey> MetaParse(const String &key, const String &value) {
             return segment_index_tag_meta_key;
         }
         auto segment_index_meta_key = MakeShared<SegmentIndexMetaKey>(db_id_str, table_id_str, index_id_str, segment_id);
-        segment_index_meta_key->commit_ts_ = std::stoull(value);
+        segment_index_meta_key->commit_ts_ = KVValue::DecodeTimestamp(value);
         return segment_index_meta_key;
     }
 
@@ -414,7 +425,7 @@ SharedPtr<MetaKey> MetaParse(const String &key, const String &value) {
             return chunk_index_tag_meta_key;
         }
         auto chunk_index_meta_key = MakeShared<ChunkIndexMetaKey>(db_id_str, table_id_str, index_id_str, segment_id, chunk_id);
-        chunk_index_meta_key->commit_ts_ = std::stoull(value);
+        chunk_index_meta_key->commit_ts_ = KVValue::DecodeTimestamp(value);
         return chunk_index_meta_key;
     }
 
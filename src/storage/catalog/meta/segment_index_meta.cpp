@@ -19,6 +19,7 @@ module;
 module segment_index_meta;
 
 import kv_code;
+import kv_value;
 import kv_store;
 import table_index_meeta;
 import table_meeta;
@@ -100,7 +101,7 @@ Status SegmentIndexMeta::GetFtInfo(SharedPtr<SegmentIndexFtInfo> &ft_info) {
 Status SegmentIndexMeta::SetChunkIDs(const Vector<ChunkID> &chunk_ids) {
     chunk_ids_ = chunk_ids;
     String chunk_ids_key = GetSegmentIndexTag("chunk_ids");
-    String chunk_ids_str = nlohmann::json(chunk_ids).dump();
+    String chunk_ids_str = KVValue::EncodeIDs(chunk_ids);
     Status status = kv_instance_.Put(chunk_ids_key, chunk_ids_str);
     if (!status.ok()) {
         return status;
@@ -144,13 +145,13 @@ Status SegmentIndexMeta::AddChunkIndexID1(ChunkID chunk_id, NewTxn *new_txn) {
     String commit_ts_str;
     switch (new_txn->GetTxnState()) {
         case TxnState::kStarted: {
-            commit_ts_str = "-1"; // Wait for commit
+            commit_ts_str = KVValue::EncodeTimestamp(std::numeric_limits<TxnTimeStamp>::max()); // Wait for commit
             new_txn->AddMetaKeyForCommit(chunk_id_key);
             break;
         }
         case TxnState::kCommitting:
         case TxnState::kCommitted: {
-            commit_ts_str = fmt::format("{}", new_txn->CommitTS());
+            commit_ts_str = KVValue::EncodeTimestamp(new_txn->CommitTS());
             break;
         }
         default: {
@@ -394,7 +395,7 @@ Status SegmentIndexMeta::LoadChunkIDs() {
     if (!status.ok()) {
         return status;
     }
-    chunk_ids_ = nlohmann::json::parse(chunk_ids_str).get<Vector<ChunkID>>();
+    chunk_ids_ = KVValue::DecodeIDs(chunk_ids_str);
     return Status::OK();
 }
 
@@ -412,7 +413,7 @@ Status SegmentIndexMeta::LoadChunkIDs1() {
         String key = iter->Key().ToString();
         auto [chunk_id, is_chunk_id] = ExtractU64FromStringSuffix(key, chunk_id_prefix.size());
         if (is_chunk_id) {
-            TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+            TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
             if (commit_ts > begin_ts and commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
                 iter->Next();
                 continue;
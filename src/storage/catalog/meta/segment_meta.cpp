@@ -20,6 +20,7 @@ module segment_meta;
 
 import kv_store;
 import kv_code;
+import kv_value;
 import third_party;
 import default_values;
 import table_meeta;
@@ -143,7 +144,7 @@ Status SegmentMeta::UninitSet(UsageFlag usage_flag, TxnTimeStamp begin_ts) {
         iter->Seek(block_id_prefix);
         Vector<String> delete_keys;
         while (iter->Valid() && iter->Key().starts_with(block_id_prefix)) {
-            TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+            TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
             if (commit_ts > begin_ts and commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
                 BlockID block_id = std::stoull(iter->Key().ToString().substr(block_id_prefix.size()));
                 UnrecoverableError(fmt::format("Block id: {}.{} is not allowed to be removed. commit_ts: {}, begin_ts: {}",
@@ -317,7 +318,7 @@ Status SegmentMeta::Init() {
 Status SegmentMeta::AddBlockWithID(TxnTimeStamp commit_ts, BlockID block_id) {
     Status status;
     String block_id_key = KeyEncode::CatalogTableSegmentBlockKey(table_meta_.db_id_str(), table_meta_.table_id_str(), segment_id_, block_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     status = kv_instance_.Put(block_id_key, commit_ts_str);
     if (!status.ok()) {
         return status;
@@ -340,7 +341,7 @@ Pair<BlockID, Status> SegmentMeta::AddBlockID1(TxnTimeStamp commit_ts) {
     }
 
     String block_id_key = KeyEncode::CatalogTableSegmentBlockKey(table_meta_.db_id_str(), table_meta_.table_id_str(), segment_id_, block_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     status = kv_instance_.Put(block_id_key, commit_ts_str);
     if (!status.ok()) {
         return {0, status};
@@ -350,7 +351,7 @@ Pair<BlockID, Status> SegmentMeta::AddBlockID1(TxnTimeStamp commit_ts) {
 
 Status SegmentMeta::CommitBlock(BlockID block_id, TxnTimeStamp commit_ts) {
     String block_id_key = KeyEncode::CatalogTableSegmentBlockKey(table_meta_.db_id_str(), table_meta_.table_id_str(), segment_id_, block_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     Status status = kv_instance_.Put(block_id_key, commit_ts_str);
     if (!status.ok()) {
         return status;
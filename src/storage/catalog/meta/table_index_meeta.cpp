@@ -21,6 +21,7 @@ module table_index_meeta;
 import kv_store;
 import table_meeta;
 import kv_code;
+import kv_value;
 import third_party;
 import logger;
 import index_base;
@@ -96,7 +97,7 @@ bool TableIndexMeeta::HasSegmentIndexID(SegmentID segment_id) {
 
 Status TableIndexMeeta::SetSegmentIDs(const Vector<SegmentID> &segment_ids) {
     String segment_ids_key = GetTableIndexTag("segment_ids");
-    String segment_ids_str = nlohmann::json(segment_ids).dump();
+    String segment_ids_str = KVValue::EncodeIDs(segment_ids);
     Status status = kv_instance_.Put(segment_ids_key, segment_ids_str);
     if (!status.ok()) {
         return status;
@@ -125,13 +126,13 @@ Status TableIndexMeeta::AddSegmentIndexID1(SegmentID segment_id, NewTxn *new_txn
     String commit_ts_str;
     switch (new_txn->GetTxnState()) {
         case TxnState::kStarted: {
-            commit_ts_str = "-1"; // Wait for commit
+            commit_ts_str = KVValue::EncodeTimestamp(std::numeric_limits<TxnTimeStamp>::max()); // Wait for commit
             new_txn->AddMetaKeyForCommit(segment_id_key);
             break;
         }
         case TxnState::kCommitting:
         case TxnState::kCommitted: {
-            commit_ts_str = fmt::format("{}", new_txn->CommitTS());
+            commit_ts_str = KVValue::EncodeTimestamp(new_txn->CommitTS());
             break;
         }
         default: {
@@ -250,7 +251,7 @@ Status TableIndexMeeta::LoadSegmentIDs() {
     if (!status.ok()) {
         return status;
     }
-    Vector<SegmentID> segment_ids = nlohmann::json::parse(segment_ids_str).get<Vector<SegmentID>>();
+    Vector<SegmentID> segment_ids = KVValue::DecodeIDs(segment_ids_str);
     segment_ids_ = segment_ids;
     return Status::OK();
 }
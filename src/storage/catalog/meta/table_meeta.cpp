@@ -21,6 +21,7 @@ module table_meeta;
 
 import status;
 import kv_code;
+import kv_value;
 import kv_store;
 import column_def;
 import third_party;
@@ -142,7 +143,7 @@ Status TableMeeta::RemoveSegmentIDs1(const Vector<SegmentID> &segment_ids) {
     iter->Seek(segment_id_prefix);
     Vector<String> delete_keys;
     while (iter->Valid() && iter->Key().starts_with(segment_id_prefix)) {
-        TxnTimeStamp commit_ts = std::stoull(iter->Value().ToString());
+        TxnTimeStamp commit_ts = KVValue::DecodeTimestamp(iter->Value().ToStringView());
         SegmentID segment_id = std::stoull(iter->Key().ToString().substr(segment_id_prefix.size()));
         if (segment_ids_set.contains(segment_id)) {
             if (commit_ts > begin_ts_ and commit_ts != std::numeric_limits<TxnTimeStamp>::max()) {
@@ -209,7 +210,7 @@ Pair<SegmentID, Status> TableMeeta::AddSegmentID1(TxnTimeStamp commit_ts) {
     }
 
     String segment_id_key = KeyEncode::CatalogTableSegmentKey(db_id_str_, table_id_str_, segment_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     status = kv_instance_.Put(segment_id_key, commit_ts_str);
     if (!status.ok()) {
         return {0, status};
@@ -219,13 +220,13 @@ Pair<SegmentID, Status> TableMeeta::AddSegmentID1(TxnTimeStamp commit_ts) {
 
 Status TableMeeta::AddSegmentWithID(TxnTimeStamp commit_ts, SegmentID segment_id) {
     String segment_id_key = KeyEncode::CatalogTableSegmentKey(db_id_str_, table_id_str_, segment_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     return kv_instance_.Put(segment_id_key, commit_ts_str);
 }
 
 Status TableMeeta::CommitSegment(SegmentID segment_id, TxnTimeStamp commit_ts) {
     String segment_id_key = KeyEncode::CatalogTableSegmentKey(db_id_str_, table_id_str_, segment_id);
-    String commit_ts_str = fmt::format("{}", commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     Status status = kv_instance_.Put(segment_id_key, commit_ts_str);
     if (!status.ok()) {
         return status;
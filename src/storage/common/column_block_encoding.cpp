@@ -0,0 +1,236 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cstring>
+
+module column_block_encoding;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// an encoding is only used when it saves at least 1/8 of the plain size
+constexpr SizeT kMinSavingDivisor = 8;
+
+template <typename T>
+void Append(Vector<char> &buf, const T &value) {
+    const char *ptr = reinterpret_cast<const char *>(&value);
+    buf.insert(buf.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+T ReadAdv(const char *&ptr, const char *end) {
+    if (ptr + sizeof(T) > end) {
+        RecoverableError(Status::DataIOError("Column block encoding is truncated."));
+    }
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+} // namespace
+
+i64 ColumnBlockEncoding::LoadValue(const char *ptr, SizeT value_width) {
+    switch (value_width) {
+        case 1: {
+            i8 value;
+            std::memcpy(&value, ptr, 1);
+            return value;
+        }
+        case 2: {
+            i16 value;
+            std::memcpy(&value, ptr, 2);
+            return value;
+        }
+        case 4: {
+            i32 value;
+            std::memcpy(&value, ptr, 4);
+            return value;
+        }
+        default: {
+            i64 value;
+            std::memcpy(&value, ptr, 8);
+            return value;
+        }
+    }
+}
+
+void ColumnBlockEncoding::StoreValue(char *ptr, SizeT value_width, i64 value) {
+    switch (value_width) {
+        case 1: {
+            i8 v = static_cast<i8>(value);
+            std::memcpy(ptr, &v, 1);
+            break;
+        }
+        case 2: {
+            i16 v = static_cast<i16>(value);
+            std::memcpy(ptr, &v, 2);
+            break;
+        }
+        case 4: {
+            i32 v = static_cast<i32>(value);
+            std::memcpy(ptr, &v, 4);
+            break;
+        }
+        default: {
+            std::memcpy(ptr, &value, 8);
+            break;
+        }
+    }
+}
+
+Vector<char> ColumnBlockEncoding::Encode(const char *data, SizeT size, SizeT value_width) {
+    if (!SupportValueWidth(value_width) || size == 0 || size % value_width != 0) {
+        return {};
+    }
+    SizeT value_n = size / value_width;
+
+    // one pass for the statistics of both encodings
+    i64 min_value = LoadValue(data, value_width);
+    i64 max_value = min_value;
+    SizeT run_n = 1;
+    i64 prev_value = min_value;
+    for (SizeT i = 1; i < value_n; ++i) {
+        i64 value = LoadValue(data + i * value_width, value_width);
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        run_n += value != prev_value;
+        prev_value = value;
+    }
+    u64 range = static_cast<u64>(max_value) - static_cast<u64>(min_value);
+    u8 bit_width = static_cast<u8>(std::bit_width(range));
+
+    SizeT header_size = sizeof(u8) * 2;
+    SizeT rle_size = header_size + sizeof(u32) + run_n * (sizeof(u32) + value_width);
+    SizeT word_n = (value_n * bit_width + 63) / 64;
+    SizeT for_size = header_size + sizeof(i64) + sizeof(u8) + word_n * sizeof(u64);
+    SizeT max_size = size - size / kMinSavingDivisor;
+    if (std::min(rle_size, for_size) >= max_size) {
+        return {};
+    }
+
+    Vector<char> encoded;
+    if (rle_size <= for_size) {
+        encoded.reserve(rle_size);
+        Append(encoded, static_cast<u8>(ColumnBlockEncodingType::kRLE));
+        Append(encoded, static_cast<u8>(value_width));
+        Append(encoded, static_cast<u32>(run_n));
+        SizeT run_begin = 0;
+        for (SizeT i = 1; i <= value_n; ++i) {
+            if (i == value_n || std::memcmp(data + i * value_width, data + run_begin * value_width, value_width) != 0) {
+                Append(encoded, static_cast<u32>(i - run_begin));
+                encoded.insert(encoded.end(), data + run_begin * value_width, data + (run_begin + 1) * value_width);
+                run_begin = i;
+            }
+        }
+    } else {
+        encoded.reserve(for_size);
+        Append(encoded, static_cast<u8>(ColumnBlockEncodingType::kFORBitPack));
+        Append(encoded, static_cast<u8>(value_width));
+        Append(encoded, min_value);
+        Append(encoded, bit_width);
+        Vector<u64> words(word_n, 0);
+        if (bit_width > 0) {
+            for (SizeT i = 0; i < value_n; ++i) {
+                u64 delta = static_cast<u64>(LoadValue(data + i * value_width, value_width)) - static_cast<u64>(min_value);
+                SizeT bit_pos = i * bit_width;
+                SizeT word_idx = bit_pos / 64;
+                SizeT bit_off = bit_pos % 64;
+                words[word_idx] |= delta << bit_off;
+                if (bit_off + bit_width > 64) {
+                    words[word_idx + 1] |= delta >> (64 - bit_off);
+                }
+            }
+        }
+        const char *words_ptr = reinterpret_cast<const char *>(words.data());
+        encoded.insert(encoded.end(), words_ptr, words_ptr + word_n * sizeof(u64));
+    }
+    return encoded;
+}
+
+void ColumnBlockEncoding::Decode(const char *encoded, SizeT encoded_size, char *data, SizeT size) {
+    const char *ptr = encoded;
+    const char *end = encoded + encoded_size;
+    auto type = static_cast<ColumnBlockEncodingType>(ReadAdv<u8>(ptr, end));
+    SizeT value_width = ReadAdv<u8>(ptr, end);
+    if (!SupportValueWidth(value_width) || size % value_width != 0) {
+        RecoverableError(Status::DataIOError(fmt::format("Invalid column block encoding value width: {}.", value_width)));
+    }
+    SizeT value_n = size / value_width;
+    switch (type) {
+        case ColumnBlockEncodingType::kRLE: {
+            u32 run_n = ReadAdv<u32>(ptr, end);
+            SizeT value_i = 0;
+            for (u32 run_i = 0; run_i < run_n; ++run_i) {
+                u32 run_len = ReadAdv<u32>(ptr, end);
+                if (ptr + value_width > end || value_i + run_len > value_n) {
+                    RecoverableError(Status::DataIOError("Column block RLE run is out of range."));
+                }
+                for (u32 j = 0; j < run_len; ++j, ++value_i) {
+                    std::memcpy(data + value_i * value_width, ptr, value_width);
+                }
+                ptr += value_width;
+            }
+            if (value_i != value_n) {
+                RecoverableError(Status::DataIOError(fmt::format("Column block RLE decodes {} values, expect {}.", value_i, value_n)));
+            }
+            break;
+        }
+        case ColumnBlockEncodingType::kFORBitPack: {
+            i64 reference = ReadAdv<i64>(ptr, end);
+            u8 bit_width = ReadAdv<u8>(ptr, end);
+            if (bit_width > 64) {
+                RecoverableError(Status::DataIOError(fmt::format("Invalid column block bit width: {}.", bit_width)));
+            }
+            SizeT word_n = (value_n * bit_width + 63) / 64;
+            if (ptr + word_n * sizeof(u64) > end) {
+                RecoverableError(Status::DataIOError("Column block bit packed data is truncated."));
+            }
+            Vector<u64> words(word_n);
+            if (word_n > 0) {
+                std::memcpy(words.data(), ptr, word_n * sizeof(u64));
+            }
+            u64 mask = bit_width == 64 ? ~u64(0) : (u64(1) << bit_width) - 1;
+            for (SizeT i = 0; i < value_n; ++i) {
+                u64 delta = 0;
+                if (bit_width > 0) {
+                    SizeT bit_pos = i * bit_width;
+                    SizeT word_idx = bit_pos / 64;
+                    SizeT bit_off = bit_pos % 64;
+                    delta = words[word_idx] >> bit_off;
+                    if (bit_off + bit_width > 64) {
+                        delta |= words[word_idx + 1] << (64 - bit_off);
+                    }
+                    delta &= mask;
+                }
+                StoreValue(data + i * value_width, value_width, static_cast<i64>(static_cast<u64>(reference) + delta));
+            }
+            break;
+        }
+        default: {
+            RecoverableError(Status::DataIOError(fmt::format("Unknown column block encoding: {}.", static_cast<u8>(type))));
+        }
+    }
+}
+
+} // namespace infinity
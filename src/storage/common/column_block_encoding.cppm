@@ -0,0 +1,52 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module column_block_encoding;
+
+import stl;
+
+namespace infinity {
+
+export enum class ColumnBlockEncodingType : u8 {
+    kPlain = 0,
+    kRLE = 1,         // runs of equal values
+    kFORBitPack = 2,  // frame of reference: value - min, bit packed
+};
+
+// Lightweight lossless encodings of a column block of fixed width values (1, 2, 4 or 8 bytes).
+// The values are handled as integers of the width, so any fixed width type can be encoded bit exact.
+// Encoded layout:
+// - u8: encoding type
+// - u8: value width
+// - kRLE: u32 run count, then for each run: u32 run length, value
+// - kFORBitPack: i64 reference, u8 bit width, then u64 words of packed (value - reference)
+export class ColumnBlockEncoding {
+public:
+    static bool SupportValueWidth(SizeT value_width) { return value_width == 1 || value_width == 2 || value_width == 4 || value_width == 8; }
+
+    // Return the encoded block, or an empty vector when no encoding saves enough space over the plain layout.
+    static Vector<char> Encode(const char *data, SizeT size, SizeT value_width);
+
+    // Decode into data of size bytes. Throw on corrupted input.
+    static void Decode(const char *encoded, SizeT encoded_size, char *data, SizeT size);
+
+private:
+    static i64 LoadValue(const char *ptr, SizeT value_width);
+
+    static void StoreValue(char *ptr, SizeT value_width, i64 value);
+};
+
+} // namespace infinity
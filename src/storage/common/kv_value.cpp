@@ -0,0 +1,130 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <string>
+
+module kv_value;
+
+import stl;
+import third_party;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+void PutVarint(String &out, u64 value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+u64 GetVarint(std::string_view value, SizeT &pos) {
+    u64 result = 0;
+    for (u32 shift = 0; shift < 64; shift += 7) {
+        if (pos >= value.size()) {
+            break;
+        }
+        u8 byte = static_cast<u8>(value[pos++]);
+        result |= static_cast<u64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return result;
+        }
+    }
+    UnrecoverableError(fmt::format("Truncated varint in catalog value of size {}", value.size()));
+    return 0;
+}
+
+u64 ParseLegacyU64(std::string_view value) {
+    // Legacy values are written with fmt::format("{}", ts), except the "-1" placeholder of uncommitted index keys,
+    // which std::stoull wraps to the max timestamp.
+    if (value == "-1") {
+        return std::numeric_limits<u64>::max();
+    }
+    u64 result = 0;
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (ec != std::errc() || ptr != value.data() + value.size()) {
+        UnrecoverableError(fmt::format("Invalid catalog value: {}", value));
+    }
+    return result;
+}
+
+} // namespace
+
+String KVValue::EncodeTimestamp(TxnTimeStamp ts) {
+    String out;
+    out.reserve(1 + 10);
+    out.push_back(static_cast<char>(kVersion1));
+    PutVarint(out, ts);
+    return out;
+}
+
+TxnTimeStamp KVValue::DecodeTimestamp(std::string_view value) {
+    if (!IsBinary(value)) {
+        return ParseLegacyU64(value);
+    }
+    SizeT pos = 1;
+    TxnTimeStamp ts = GetVarint(value, pos);
+    if (pos != value.size()) {
+        UnrecoverableError(fmt::format("Trailing bytes in catalog timestamp value of size {}", value.size()));
+    }
+    return ts;
+}
+
+String KVValue::EncodeIDs(const Vector<u32> &ids) {
+    String out;
+    out.reserve(1 + 2 + ids.size() * 2);
+    out.push_back(static_cast<char>(kVersion1));
+    PutVarint(out, ids.size());
+    i64 prev = 0;
+    for (u32 id : ids) {
+        i64 delta = static_cast<i64>(id) - prev;
+        PutVarint(out, (static_cast<u64>(delta) << 1) ^ static_cast<u64>(delta >> 63));
+        prev = id;
+    }
+    return out;
+}
+
+Vector<u32> KVValue::DecodeIDs(std::string_view value) {
+    if (!IsBinary(value)) {
+        return nlohmann::json::parse(value).get<Vector<u32>>();
+    }
+    SizeT pos = 1;
+    u64 count = GetVarint(value, pos);
+    if (count > value.size() - pos) {
+        // every id takes at least one byte
+        UnrecoverableError(fmt::format("Invalid id count {} in catalog value of size {}", count, value.size()));
+    }
+    Vector<u32> ids;
+    ids.reserve(count);
+    i64 prev = 0;
+    for (u64 i = 0; i < count; ++i) {
+        u64 zigzag = GetVarint(value, pos);
+        prev += static_cast<i64>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+        if (prev < 0 || prev > std::numeric_limits<u32>::max()) {
+            UnrecoverableError(fmt::format("Invalid id {} in catalog value", prev));
+        }
+        ids.push_back(static_cast<u32>(prev));
+    }
+    if (pos != value.size()) {
+        UnrecoverableError(fmt::format("Trailing bytes in catalog id list value of size {}", value.size()));
+    }
+    return ids;
+}
+
+} // namespace infinity
@@ -0,0 +1,42 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module kv_value;
+
+import stl;
+
+namespace infinity {
+
+// Binary encoding of catalog values.
+// A value starts with a version byte followed by LEB128 varints. The version byte is below '0', so it never collides
+// with the first byte of a legacy value (a decimal string like "123" / "-1", or a json array like "[1,2]"). Decoders
+// accept both forms: data directories written by older versions are read as is, and a value is upgraded to the
+// binary form the next time it is written.
+export struct KVValue {
+    static constexpr u8 kVersion1 = 0x01;
+
+    // commit_ts of the segment / block / index segment / chunk keys
+    static String EncodeTimestamp(TxnTimeStamp ts);
+    static TxnTimeStamp DecodeTimestamp(std::string_view value);
+
+    // segment / chunk id lists, delta coded with zigzag so that unsorted lists are supported
+    static String EncodeIDs(const Vector<u32> &ids);
+    static Vector<u32> DecodeIDs(std::string_view value);
+
+    static bool IsBinary(std::string_view value) { return !value.empty() && static_cast<u8>(value[0]) == kVersion1; }
+};
+
+} // namespace infinity
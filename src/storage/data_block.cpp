@@ -87,6 +87,70 @@ void DataBlock::Init(const DataBlock *input, const SharedPtr<Selection> &input_s
 
 void DataBlock::Init(const SharedPtr<DataBlock> &input, const SharedPtr<Selection> &input_select) { Init(input.get(), input_select); }
 
+void DataBlock::InitSelected(const DataBlock *input, const SharedPtr<Selection> &input_select) {
+    if (initialized) {
+        String error_message = "Data block was initialized before.";
+        UnrecoverableError(error_message);
+    }
+    if (input == nullptr || input_select.get() == nullptr) {
+        String error_message = "Invalid input data block or select";
+        UnrecoverableError(error_message);
+    }
+    column_count_ = input->column_count();
+    if (column_count_ == 0) {
+        String error_message = "Empty column vectors.";
+        UnrecoverableError(error_message);
+    }
+    column_vectors = input->column_vectors;
+    capacity_ = input->capacity();
+    row_count_ = input_select->Size();
+    initialized = true;
+    finalized = true;
+
+    if (row_count_ == input->row_count()) {
+        // all rows are selected
+        selection_ = input->selection_;
+        selected_columns_ = input->selected_columns_;
+        return;
+    }
+    if (input->selection_.get() == nullptr) {
+        selection_ = input_select;
+    } else {
+        // input_select refers to the selected rows of input, map them to the rows of the shared column vectors
+        selection_ = MakeShared<Selection>();
+        selection_->Initialize(row_count_);
+        for (SizeT idx = 0; idx < row_count_; ++idx) {
+            selection_->Append(input->selection_->Get(input_select->Get(idx)));
+        }
+    }
+    selected_columns_.resize(column_count_);
+}
+
+const SharedPtr<ColumnVector> &DataBlock::SelectedColumn(SizeT column_index) const {
+    if (selection_.get() == nullptr) {
+        return column_vectors[column_index];
+    }
+    SharedPtr<ColumnVector> &selected_column = selected_columns_[column_index];
+    if (selected_column.get() == nullptr) {
+        const SharedPtr<ColumnVector> &column = column_vectors[column_index];
+        selected_column = MakeShared<ColumnVector>(column->data_type());
+        selected_column->Initialize(*column, *selection_);
+    }
+    return selected_column;
+}
+
+void DataBlock::Materialize() {
+    if (selection_.get() == nullptr) {
+        return;
+    }
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        column_vectors[idx] = SelectedColumn(idx);
+    }
+    selection_.reset();
+    selected_columns_.clear();
+    capacity_ = column_vectors[0]->capacity();
+}
+
 void DataBlock::Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT end_idx) {
     if (initialized) {
         String error_message = "Data block was initialized before.";
@@ -170,6 +234,8 @@ void DataBlock::UnInit() {
     }
 
     column_vectors.clear();
+    selection_.reset();
+    selected_columns_.clear();
 
     row_count_ = 0;
     initialized = false;
@@ -186,6 +252,9 @@ void DataBlock::Reset() {
     // Reset each column into just initialized status.
     // No data is appended into any column.
 
+    // the column vectors of a selected block are shared with its input
+    Materialize();
+
     for (SizeT i = 0; i < column_count_; ++i) {
         ColumnVectorType old_vector_type = column_vectors[i]->vector_type();
         column_vectors[i]->Reset();
@@ -206,6 +275,9 @@ void DataBlock::Reset(SizeT capacity) {
     // Reset behavior:
     // Reset each column into just initialized status.
     // No data is appended into any column.
+
+    // the column vectors of a selected block are shared with its input
+    Materialize();
     for (SizeT i = 0; i < column_count_; ++i) {
         ColumnVectorType old_vector_type = column_vectors[i]->vector_type();
         column_vectors[i]->Reset();
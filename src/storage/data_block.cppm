@@ -48,6 +48,18 @@ public:
 
     void Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT end_idx);
 
+    // Share the column vectors of input and keep only the rows of input_select, a selection on input is composed.
+    // Rows aren't copied here: SelectedColumn() compacts a column on first access and Materialize() compacts all of them.
+    void InitSelected(const DataBlock *input, const SharedPtr<Selection> &input_select);
+
+    [[nodiscard]] inline bool HasSelection() const { return selection_.get() != nullptr; }
+
+    // Column with only the selected rows, same as column_vectors[column_index] if the block has no selection.
+    const SharedPtr<ColumnVector> &SelectedColumn(SizeT column_index) const;
+
+    // Copy the selected rows into new column vectors and drop the selection.
+    void Materialize();
+
     static SharedPtr<DataBlock> MoveFrom(SharedPtr<DataBlock> &input);
 
     void Init(const Vector<SharedPtr<DataType>> &types, SizeT capacity = DEFAULT_VECTOR_SIZE);
@@ -137,5 +149,9 @@ private:
     SizeT capacity_{0};
     bool initialized = false;
     bool finalized = false;
+
+    // With a selection, column_vectors hold all rows of the input and row_count_ is the number of selected rows.
+    SharedPtr<Selection> selection_{};
+    mutable Vector<SharedPtr<ColumnVector>> selected_columns_{};
 };
 } // namespace infinity
@@ -43,6 +43,8 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "lvq4") {
+        return HnswEncodeType::kLVQ4;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -54,6 +56,8 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kLVQ4:
+            return "lvq4";
         default:
             return "invalid";
     }
@@ -312,7 +316,11 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
     const auto embedding_info = dynamic_cast<const EmbeddingInfo *>(data_type_ptr->type_info().get());
     const EmbeddingDataType embedding_data_type = embedding_info->Type();
     for (const auto *param : index_param_list) {
-        if (param->param_name_ == "encode" && StringToHnswEncodeType(param->param_value_) == HnswEncodeType::kLVQ) {
+        if (param->param_name_ != "encode") {
+            continue;
+        }
+        if (HnswEncodeType encode_type = StringToHnswEncodeType(param->param_value_);
+            encode_type == HnswEncodeType::kLVQ || encode_type == HnswEncodeType::kLVQ4) {
             // TODO: now only support float?
             if (embedding_data_type != EmbeddingDataType::kElemFloat) {
                 RecoverableError(Status::InvalidIndexDefinition(
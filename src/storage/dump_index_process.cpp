@@ -38,6 +38,8 @@ import mem_index;
 import memory_indexer;
 import txn_state;
 import base_txn_store;
+import crc;
+import memindex_tracer;
 
 namespace infinity {
 
@@ -53,22 +55,43 @@ DumpIndexProcessor::~DumpIndexProcessor() {
 #endif
 }
 
-void DumpIndexProcessor::Start() {
-    LOG_INFO("Compaction processor is started.");
-    processor_thread_ = Thread([this] { Process(); });
+void DumpIndexProcessor::Start(SizeT worker_num) {
+    for (SizeT i = 0; i < worker_num; ++i) {
+        task_queues_.emplace_back(MakeShared<BlockingQueue<SharedPtr<BGTask>>>(fmt::format("DumpIndexProcessor {}", i)));
+        processor_threads_.emplace_back([this, task_queue = task_queues_.back().get()] { Process(task_queue); });
+    }
+    LOG_INFO(fmt::format("Dump index processor is started with {} workers.", worker_num));
 }
 
 void DumpIndexProcessor::Stop() {
-    LOG_INFO("Compaction processor is stopping.");
-    SharedPtr<StopProcessorTask> stop_task = MakeShared<StopProcessorTask>();
-    this->Submit(stop_task);
-    stop_task->Wait();
-    processor_thread_.join();
-    LOG_INFO("Compaction processor is stopped.");
+    LOG_INFO("Dump index processor is stopping.");
+    Vector<SharedPtr<StopProcessorTask>> stop_tasks;
+    for (auto &task_queue : task_queues_) {
+        stop_tasks.emplace_back(MakeShared<StopProcessorTask>());
+        task_queue->Enqueue(stop_tasks.back());
+        ++task_count_;
+    }
+    for (SizeT i = 0; i < processor_threads_.size(); ++i) {
+        stop_tasks[i]->Wait();
+        processor_threads_[i].join();
+    }
+    LOG_INFO("Dump index processor is stopped.");
 }
 
 void DumpIndexProcessor::Submit(SharedPtr<BGTask> bg_task) {
-    task_queue_.Enqueue(std::move(bg_task));
+    SizeT idx = 0;
+    if (bg_task->type_ == BGTaskType::kDumpIndex) {
+        auto *dump_task = static_cast<DumpIndexTask *>(bg_task.get());
+        String table_key;
+        if (dump_task->mem_index_ != nullptr) {
+            table_key = fmt::format("{}.{}", dump_task->mem_index_->db_name_, dump_task->mem_index_->table_name_);
+        } else if (dump_task->emvb_mem_index_ != nullptr) {
+            table_key = fmt::format("{}.{}", dump_task->emvb_mem_index_->db_name_, dump_task->emvb_mem_index_->table_name_);
+        }
+        u32 checksum = CRC32IEEE::makeCRC((const unsigned char *)table_key.data(), table_key.size());
+        idx = checksum % task_queues_.size();
+    }
+    task_queues_[idx]->Enqueue(std::move(bg_task));
     ++task_count_;
 }
 
@@ -151,11 +174,11 @@ void DumpIndexProcessor::DoDump(DumpIndexTask *dump_task) {
     } while (!commit_status.ok() && rollback_status.ok() && (commit_status.code_ == ErrorCode::kTxnConflict || ++retry_count <= 3));
 }
 
-void DumpIndexProcessor::Process() {
+void DumpIndexProcessor::Process(BlockingQueue<SharedPtr<BGTask>> *task_queue) {
     bool running = true;
     while (running) {
         Deque<SharedPtr<BGTask>> tasks;
-        task_queue_.DequeueBulk(tasks);
+        task_queue->DequeueBulk(tasks);
 
         for (const auto &bg_task : tasks) {
             switch (bg_task->type_) {
@@ -175,6 +198,10 @@ void DumpIndexProcessor::Process() {
                         DoDump(dump_task);
                         LOG_DEBUG("Dump index done.");
                     }
+                    if (auto dump_task = static_cast<DumpIndexTask *>(bg_task.get()); dump_task->mem_index_ != nullptr) {
+                        // the mem index may be released by the dump, it is only the key of the proposal
+                        InfinityContext::instance().storage()->memindex_tracer()->DumpFinished(dump_task->mem_index_);
+                    }
                     break;
                 }
                 default: {
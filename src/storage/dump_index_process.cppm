@@ -28,12 +28,14 @@ class NewTxn;
 class BGTask;
 class DumpIndexTask;
 
+// DumpIndexProcessor has a pool of threads, and dumps the mem indexes of a same table with the same thread orderly,
+// so a burst of dumps on one table does not hold back the dumps of the others.
 export class DumpIndexProcessor {
 public:
     DumpIndexProcessor();
     ~DumpIndexProcessor();
 
-    void Start();
+    void Start(SizeT worker_num);
 
     void Stop();
 
@@ -46,12 +48,12 @@ private:
 
     void DoDump(DumpIndexTask *dump_task);
 
-    void Process();
+    void Process(BlockingQueue<SharedPtr<BGTask>> *task_queue);
 
 private:
-    BlockingQueue<SharedPtr<BGTask>> task_queue_{"DumpIndexProcessor"};
+    Vector<SharedPtr<BlockingQueue<SharedPtr<BGTask>>>> task_queues_{};
 
-    Thread processor_thread_{};
+    Vector<Thread> processor_threads_{};
 
     Atomic<u64> task_count_{};
 };
@@ -53,6 +53,9 @@ import kv_store;
 
 import new_catalog;
 import buffer_handle;
+import infinity_context;
+import storage;
+import obj_prefetcher;
 
 namespace infinity {
 
@@ -108,6 +111,30 @@ Status ColumnIndexReader::Open(optionflag_t flag, TableIndexMeeta &table_index_m
     }
     SharedPtr<String> index_dir = table_index_meta.GetTableIndexDir();
 
+    // The segment readers below open the posting, dict and length files of the chunks one by one,
+    // fetch all of them from object storage concurrently first.
+    Storage *storage = InfinityContext::instance().storage();
+    if (ObjPrefetcher *obj_prefetcher = storage != nullptr ? storage->obj_prefetcher() : nullptr; obj_prefetcher != nullptr) {
+        Vector<String> file_paths;
+        for (SegmentID segment_id : *segment_ids_ptr) {
+            SegmentIndexMeta segment_index_meta(segment_id, table_index_meta);
+            // the prefetch is only a hint, the segment readers below report the errors
+            auto [chunk_ids_ptr, status] = segment_index_meta.GetChunkIDs1();
+            if (!status.ok()) {
+                LOG_WARN(fmt::format("Skip prefetching the chunks of segment {}: {}", segment_id, status.message()));
+                continue;
+            }
+            for (ChunkID chunk_id : *chunk_ids_ptr) {
+                ChunkIndexMeta chunk_index_meta(chunk_id, segment_index_meta);
+                status = chunk_index_meta.FilePaths(file_paths);
+                if (!status.ok()) {
+                    LOG_WARN(fmt::format("Skip prefetching chunk {} of segment {}: {}", chunk_id, segment_id, status.message()));
+                }
+            }
+        }
+        obj_prefetcher->Prefetch(file_paths);
+    }
+
     u64 column_len_sum = 0;
     u32 column_len_cnt = 0;
     // need to ensure that segment_id is in ascending order
@@ -174,6 +201,15 @@ Status ColumnIndexReader::Open(optionflag_t flag, TableIndexMeeta &table_index_m
 
         {
             SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+            // The frozen memory indexer is neither in the chunks nor in ft_info until its dump is committed.
+            SharedPtr<MemoryIndexer> dumping_memory_indexer = mem_index == nullptr ? nullptr : mem_index->GetDumpingFulltextIndex();
+            if (dumping_memory_indexer && dumping_memory_indexer->GetDocCount() != 0) {
+                SharedPtr<InMemIndexSegmentReader> segment_reader = MakeShared<InMemIndexSegmentReader>(segment_id, dumping_memory_indexer.get());
+                segment_readers_.push_back(std::move(segment_reader));
+                dumping_memory_indexer_ = dumping_memory_indexer;
+                column_len_sum += dumping_memory_indexer_->GetColumnLengthSum();
+                column_len_cnt += dumping_memory_indexer_->GetDocCount();
+            }
             SharedPtr<MemoryIndexer> memory_indexer = mem_index == nullptr ? nullptr : mem_index->GetFulltextIndex();
             if (memory_indexer && memory_indexer->GetDocCount() != 0) {
                 SharedPtr<InMemIndexSegmentReader> segment_reader = MakeShared<InMemIndexSegmentReader>(segment_id, memory_indexer.get());
@@ -86,6 +86,7 @@ public:
     // for loading column length files
     String index_dir_;
     SharedPtr<MemoryIndexer> memory_indexer_{nullptr};
+    SharedPtr<MemoryIndexer> dumping_memory_indexer_{nullptr}; // frozen memory indexer whose dump isn't committed yet
 
     Vector<ColumnReaderChunkInfo> chunk_index_meta_infos_;
 };
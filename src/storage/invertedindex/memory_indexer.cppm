@@ -36,6 +36,7 @@ import external_sort_merger;
 import persistence_manager;
 import base_memindex;
 import memindex_tracer;
+import create_index_info;
 import segment_index_entry;
 import table_index_entry;
 import mem_usage_change;
@@ -135,6 +136,8 @@ public:
 
     MemIndexTracerInfo GetInfo() const override;
 
+    IndexType GetIndexType() const override { return IndexType::kFullText; }
+
     TableIndexEntry *table_index_entry() const override;
 
     const ChunkIndexMetaInfo GetChunkIndexMetaInfo() const override;
@@ -23,6 +23,7 @@ import doc_iterator;
 import multi_doc_iterator;
 import internal_types;
 import infinity_exception;
+import blockmax_leaf_iterator;
 
 namespace infinity {
 
@@ -48,6 +49,47 @@ AndIterator::AndIterator(Vector<UniquePtr<DocIterator>> iterators) : MultiDocIte
                 break;
             }
         }
+        if (auto *leaf = dynamic_cast<BlockMaxLeafIterator *>(it.get()); leaf != nullptr) {
+            block_max_leaves_.push_back(leaf);
+        } else {
+            not_leaf_ub_sum_ += it->BM25ScoreUpperBound();
+        }
+        if (!it->HasBM25ScoreUpperBound()) {
+            bounded_ = false;
+        }
+    }
+    rest_ub_.resize(children_.size() + 1);
+    rest_ub_[children_.size()] = 0.0f;
+    for (SizeT i = children_.size(); i > 0; --i) {
+        rest_ub_[i - 1] = rest_ub_[i] + children_[i - 1]->BM25ScoreUpperBound();
+    }
+}
+
+bool AndIterator::NextShallow(RowID &target_doc_id) {
+    while (true) {
+        float block_max_sum = not_leaf_ub_sum_;
+        RowID block_min_possible_doc_id = target_doc_id;
+        RowID block_last_doc_id = INVALID_ROWID;
+        for (BlockMaxLeafIterator *leaf : block_max_leaves_) {
+            if (!leaf->NextShallow(target_doc_id)) {
+                return false;
+            }
+            block_max_sum += leaf->BlockMaxBM25Score();
+            block_min_possible_doc_id = std::max(block_min_possible_doc_id, leaf->BlockMinPossibleDocID());
+            block_last_doc_id = std::min(block_last_doc_id, leaf->BlockLastDocID());
+        }
+        if (block_min_possible_doc_id > target_doc_id) {
+            // some leaf skipped the blocks which can't exceed its own threshold
+            target_doc_id = block_min_possible_doc_id;
+            continue;
+        }
+        if (block_max_sum > threshold_) {
+            return true;
+        }
+        if (block_last_doc_id == INVALID_ROWID) {
+            return false;
+        }
+        target_doc_id = block_last_doc_id + 1;
     }
 }
 
@@ -57,6 +99,11 @@ bool AndIterator::Next(const RowID doc_id) {
         return true;
     RowID target_doc_id = doc_id;
     while (true) {
+        // block-max: skip the block ranges in which the children can't exceed threshold together
+        if (threshold_ > 0.0f && bounded_ && !block_max_leaves_.empty() && !NextShallow(target_doc_id)) {
+            doc_id_ = INVALID_ROWID;
+            return false;
+        }
         for (SizeT i = 0; i < children_.size(); i++) {
             const auto &it = children_[i];
             bool ok = it->Next(target_doc_id);
@@ -75,12 +122,14 @@ bool AndIterator::Next(const RowID doc_id) {
                 doc_id_ = target_doc_id;
                 return true;
             }
+            // stop scoring once the rest children can't lift the score above threshold
             float sum_score = 0.0f;
-            for (SizeT i = 0; i < children_.size(); i++) {
+            SizeT i = 0;
+            for (; i < children_.size() && (!bounded_ || sum_score + rest_ub_[i] > threshold_); i++) {
                 const auto &it = children_[i];
                 sum_score += it->Score();
             }
-            if (sum_score > threshold_) {
+            if (i == children_.size() && sum_score > threshold_) {
                 doc_id_ = target_doc_id;
                 score_cache_ = sum_score;
                 score_cache_docid_ = doc_id_;
@@ -21,6 +21,7 @@ import index_defines;
 import doc_iterator;
 import multi_doc_iterator;
 import internal_types;
+import blockmax_leaf_iterator;
 
 namespace infinity {
 
@@ -42,6 +43,17 @@ public:
     u32 MatchCount() const override;
 
 private:
+    // Move target_doc_id to the first block range in which the block max scores of children may exceed threshold_.
+    // Returns false if any child is exhausted.
+    bool NextShallow(RowID &target_doc_id);
+
+    // children which have block max info, and the upper bound sum of the others
+    Vector<BlockMaxLeafIterator *> block_max_leaves_{};
+    float not_leaf_ub_sum_ = 0.0f;
+    // rest_ub_[i]: sum of bm25_score_upper_bound of children_[i..]
+    Vector<float> rest_ub_{};
+    // false if any child has no finite upper bound, then the bounds can't be used for pruning
+    bool bounded_ = true;
     // score cache
     RowID score_cache_docid_ = INVALID_ROWID;
     float score_cache_ = 0.0f;
@@ -29,7 +29,7 @@ import buffer_handle;
 namespace infinity {
 
 FullTextColumnLengthReader::FullTextColumnLengthReader(ColumnIndexReader *reader)
-    : index_dir_(reader->index_dir_), memory_indexer_(reader->memory_indexer_) {
+    : index_dir_(reader->index_dir_), memory_indexer_(reader->memory_indexer_), dumping_memory_indexer_(reader->dumping_memory_indexer_) {
     chunk_index_meta_infos_ = reader->chunk_index_meta_infos_;
 
     Pair<u64, float> df_and_avg_column_len = reader->GetTotalDfAndAvgColumnLength();
@@ -41,11 +41,13 @@ public:
             assert(column_lengths_ != nullptr);
             return column_lengths_[row_id - current_chunk_base_rowid_];
         }
-        if (memory_indexer_.get() != nullptr) {
-            RowID base_rowid = memory_indexer_->GetBaseRowId();
-            u32 doc_count = memory_indexer_->GetDocCount();
-            if (row_id >= base_rowid && row_id < base_rowid + doc_count) {
-                return memory_indexer_->GetColumnLength(row_id - base_rowid);
+        for (MemoryIndexer *memory_indexer : {memory_indexer_.get(), dumping_memory_indexer_.get()}) {
+            if (memory_indexer != nullptr) {
+                RowID base_rowid = memory_indexer->GetBaseRowId();
+                u32 doc_count = memory_indexer->GetDocCount();
+                if (row_id >= base_rowid && row_id < base_rowid + doc_count) {
+                    return memory_indexer->GetColumnLength(row_id - base_rowid);
+                }
             }
         }
         return SeekFile(row_id);
@@ -61,6 +63,7 @@ private:
     Vector<ColumnReaderChunkInfo> chunk_index_meta_infos_{}; // must in ascending order
 
     SharedPtr<MemoryIndexer> memory_indexer_{};
+    SharedPtr<MemoryIndexer> dumping_memory_indexer_{};
     u64 total_df_{};
     float avg_column_len_{};
     const u32 *column_lengths_{nullptr};
@@ -25,7 +25,7 @@ namespace infinity {
 
 export enum class EarlyTermAlgo {
     kAuto,    // choose between kNaive, kBatch, kBMW
-    kNaive,   // naive or
+    kNaive,   // naive or, pruned with the score upper bounds of children (MaxScore) once the threshold is set
     kBatch,   // use batch_or if (sum_of_df > total_doc_num / 4) and term nodes under or node achieve a certain number
     kBMW,     // use bmw if it is "or iterator" on the top level and has only term children
     kCompare, // compare bmw, batch, naive
@@ -82,6 +82,12 @@ public:
 
     inline float BM25ScoreUpperBound() const { return bm25_score_upper_bound_; }
 
+    // False if the upper bound is unknown (the default max, infinite or nan), it can't be used for pruning then.
+    inline bool HasBM25ScoreUpperBound() const {
+        return !std::isinf(bm25_score_upper_bound_) && !std::isnan(bm25_score_upper_bound_) &&
+               bm25_score_upper_bound_ < std::numeric_limits<float>::max();
+    }
+
     inline float Threshold() const { return threshold_; }
 
     /* virtual methods */
@@ -31,7 +31,11 @@ namespace infinity {
 export class FilterIterator final : public DocIterator {
 public:
     explicit FilterIterator(CommonQueryFilter *common_query_filter, UniquePtr<DocIterator> &&query_iterator)
-        : common_query_filter_(common_query_filter), query_iterator_(std::move(query_iterator)) {}
+        : common_query_filter_(common_query_filter), query_iterator_(std::move(query_iterator)) {
+        // the filter only removes docs, so the bound of the query holds and the parent can prune with it
+        bm25_score_upper_bound_ = query_iterator_->BM25ScoreUpperBound();
+        estimate_iterate_cost_ = query_iterator_->GetEstimateIterateCost();
+    }
 
     DocIteratorType GetType() const override { return DocIteratorType::kFilterIterator; }
     String Name() const override { return "FilterIterator"; };
@@ -54,7 +58,12 @@ public:
 
     float Score() override { return query_iterator_->Score(); }
 
-    void UpdateScoreThreshold(const float threshold) override { query_iterator_->UpdateScoreThreshold(threshold); }
+    void UpdateScoreThreshold(const float threshold) override {
+        if (threshold <= threshold_)
+            return;
+        threshold_ = threshold;
+        query_iterator_->UpdateScoreThreshold(threshold);
+    }
 
     // for minimum_should_match parameter
     u32 MatchCount() const override { return query_iterator_->MatchCount(); }
@@ -32,25 +32,55 @@ public:
         for (u32 i = 0; i < children_.size(); ++i) {
             bm25_score_upper_bound_ += children_[i]->BM25ScoreUpperBound();
         }
+        // the optional children are sought from the largest upper bound
+        std::sort(children_.begin() + 1, children_.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs->BM25ScoreUpperBound() > rhs->BM25ScoreUpperBound();
+        });
+        rest_ub_.resize(children_.size() + 1);
+        rest_ub_[children_.size()] = 0.0f;
+        for (u32 i = children_.size(); i > 1; --i) {
+            rest_ub_[i - 1] = rest_ub_[i] + children_[i - 1]->BM25ScoreUpperBound();
+        }
+        bounded_ = std::all_of(children_.begin(), children_.end(), [](const auto &child) { return child->HasBM25ScoreUpperBound(); });
     }
 
     DocIteratorType GetType() const override { return DocIteratorType::kMustFirstIterator; }
 
     String Name() const override { return "MustFirstIterator"; }
 
-    bool Next(const RowID doc_id) override {
-        children_[0]->Next(doc_id);
-        const auto current_doc_id = children_[0]->DocID();
-        if (current_doc_id == INVALID_ROWID) [[unlikely]] {
-            doc_id_ = current_doc_id;
-            return false;
-        }
-        // now current_doc_id < INVALID_ROWID
-        for (u32 i = 1; i < children_.size(); ++i) {
-            children_[i]->Next(current_doc_id);
+    bool Next(RowID doc_id) override {
+        while (true) {
+            children_[0]->Next(doc_id);
+            const auto current_doc_id = children_[0]->DocID();
+            if (current_doc_id == INVALID_ROWID) [[unlikely]] {
+                doc_id_ = current_doc_id;
+                return false;
+            }
+            // now current_doc_id < INVALID_ROWID
+            if (threshold_ <= 0.0f || !bounded_) {
+                for (u32 i = 1; i < children_.size(); ++i) {
+                    children_[i]->Next(current_doc_id);
+                }
+                doc_id_ = current_doc_id;
+                return true;
+            }
+            // MaxScore: the optional children are non-essential, skip the doc once they can't lift its score above threshold
+            float sum_score = children_[0]->Score();
+            u32 i = 1;
+            for (; i < children_.size() && sum_score + rest_ub_[i] > threshold_; ++i) {
+                const auto &child = children_[i];
+                if (child->Next(current_doc_id) && child->DocID() == current_doc_id) {
+                    sum_score += child->Score();
+                }
+            }
+            if (i == children_.size() && sum_score > threshold_) {
+                doc_id_ = current_doc_id;
+                score_cache_docid_ = doc_id_;
+                score_cache_ = sum_score;
+                return true;
+            }
+            doc_id = current_doc_id + 1;
         }
-        doc_id_ = current_doc_id;
-        return true;
     }
 
     float Score() override {
@@ -95,6 +125,10 @@ public:
     }
 
 private:
+    // rest_ub_[i]: sum of bm25_score_upper_bound of children_[i..]
+    Vector<float> rest_ub_{};
+    // false if any child has no finite upper bound, then the bounds can't be used for pruning
+    bool bounded_ = true;
     // score cache
     RowID score_cache_docid_ = INVALID_ROWID;
     float score_cache_ = 0.0f;
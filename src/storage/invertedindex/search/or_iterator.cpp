@@ -58,30 +58,81 @@ OrIterator::OrIterator(Vector<UniquePtr<DocIterator>> iterators) : MultiDocItera
     for (const auto &child : children_) {
         bm25_score_upper_bound_ += child->BM25ScoreUpperBound();
         estimate_iterate_cost_ += child->GetEstimateIterateCost();
+        bounded_ = bounded_ && child->HasBM25ScoreUpperBound();
     }
+    sorted_ids_.resize(children_.size());
+    std::iota(sorted_ids_.begin(), sorted_ids_.end(), 0u);
+    std::sort(sorted_ids_.begin(), sorted_ids_.end(), [this](const u32 lhs, const u32 rhs) {
+        return children_[lhs]->BM25ScoreUpperBound() < children_[rhs]->BM25ScoreUpperBound();
+    });
+    ub_prefix_sum_.resize(children_.size() + 1);
+    ub_prefix_sum_[0] = 0.0f;
+    for (u32 k = 0; k < sorted_ids_.size(); ++k) {
+        ub_prefix_sum_[k + 1] = ub_prefix_sum_[k] + children_[sorted_ids_[k]]->BM25ScoreUpperBound();
+    }
+}
+
+void OrIterator::BuildEssentialHeap() {
+    heap_.iterator_heap_.resize(1);
+    for (u32 k = non_essential_num_; k < sorted_ids_.size(); ++k) {
+        const u32 i = sorted_ids_[k];
+        DocIteratorEntry entry = {children_[i]->DocID(), i};
+        heap_.AddEntry(entry);
+    }
+    heap_.BuildHeap();
 }
 
-bool OrIterator::Next(const RowID doc_id) {
+bool OrIterator::Next(RowID doc_id) {
     assert(doc_id != INVALID_ROWID);
-    if (doc_id_ == INVALID_ROWID) {
-        for (u32 i = 0; i < children_.size(); ++i) {
-            children_[i]->Next();
-            DocIteratorEntry entry = {children_[i]->DocID(), i};
-            heap_.AddEntry(entry);
+    if (non_essential_num_ == children_.size()) [[unlikely]] {
+        // no doc can exceed the threshold
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+    if (!heap_built_) {
+        for (u32 k = non_essential_num_; k < sorted_ids_.size(); ++k) {
+            children_[sorted_ids_[k]]->Next();
         }
-        heap_.BuildHeap();
-        doc_id_ = heap_.TopEntry().doc_id_;
+        BuildEssentialHeap();
+        heap_built_ = true;
     }
     if (doc_id_ != INVALID_ROWID && doc_id_ >= doc_id)
         return true;
-    while (doc_id > heap_.TopEntry().doc_id_) {
-        DocIterator *top = GetDocIterator(heap_.TopEntry().entry_id_);
-        top->Next(doc_id);
-        heap_.TopEntry().doc_id_ = top->DocID();
-        heap_.AdjustDown(1);
+    while (true) {
+        while (doc_id > heap_.TopEntry().doc_id_) {
+            DocIterator *top = GetDocIterator(heap_.TopEntry().entry_id_);
+            top->Next(doc_id);
+            heap_.TopEntry().doc_id_ = top->DocID();
+            heap_.AdjustDown(1);
+        }
+        const RowID candidate_doc_id = heap_.TopEntry().doc_id_;
+        if (non_essential_num_ == 0 || candidate_doc_id == INVALID_ROWID) {
+            doc_id_ = candidate_doc_id;
+            return doc_id_ != INVALID_ROWID;
+        }
+        float sum_score = 0.0f;
+        for (u32 k = non_essential_num_; k < sorted_ids_.size(); ++k) {
+            const auto &child = children_[sorted_ids_[k]];
+            if (child->DocID() == candidate_doc_id) {
+                sum_score += child->Score();
+            }
+        }
+        // seek the non-essential children from the largest upper bound, stop once the rest can't lift the score above threshold
+        u32 k = non_essential_num_;
+        for (; k > 0 && sum_score + ub_prefix_sum_[k] > threshold_; --k) {
+            const auto &child = children_[sorted_ids_[k - 1]];
+            if (child->Next(candidate_doc_id) && child->DocID() == candidate_doc_id) {
+                sum_score += child->Score();
+            }
+        }
+        if (k == 0 && sum_score > threshold_) {
+            doc_id_ = candidate_doc_id;
+            score_cache_docid_ = doc_id_;
+            score_cache_ = sum_score;
+            return true;
+        }
+        doc_id = candidate_doc_id + 1;
     }
-    doc_id_ = heap_.TopEntry().doc_id_;
-    return doc_id_ != INVALID_ROWID;
 }
 
 float OrIterator::Score() {
@@ -108,6 +159,13 @@ void OrIterator::UpdateScoreThreshold(const float threshold) {
         const float new_threshold = std::max(0.0f, base_threshold + child->BM25ScoreUpperBound());
         child->UpdateScoreThreshold(new_threshold);
     }
+    const u32 old_non_essential_num = non_essential_num_;
+    while (bounded_ && non_essential_num_ < sorted_ids_.size() && ub_prefix_sum_[non_essential_num_ + 1] <= threshold_) {
+        ++non_essential_num_;
+    }
+    if (heap_built_ && non_essential_num_ != old_non_essential_num && non_essential_num_ < sorted_ids_.size()) {
+        BuildEssentialHeap();
+    }
 }
 
 u32 OrIterator::MatchCount() const {
@@ -67,7 +67,18 @@ private:
 
     const DocIterator *GetDocIterator(u32 i) const { return children_[i].get(); }
 
+    void BuildEssentialHeap();
+
     DocIteratorHeap heap_;
+    bool heap_built_ = false;
+    // MaxScore: children sorted by bm25_score_upper_bound in ascending order.
+    // The first non_essential_num_ children can't make a doc exceed threshold_ on their own, so only the essential ones
+    // are in heap_ and drive the iteration, the non-essential ones are only sought to complete the score of a candidate.
+    Vector<u32> sorted_ids_{};
+    Vector<float> ub_prefix_sum_{}; // ub_prefix_sum_[k]: sum of bm25_score_upper_bound of the first k children in sorted_ids_
+    u32 non_essential_num_ = 0;
+    // false if any child has no finite upper bound, then the bounds can't be used for pruning
+    bool bounded_ = true;
     // score cache
     RowID score_cache_docid_ = INVALID_ROWID;
     float score_cache_ = 0.0f;
@@ -26,22 +26,36 @@ import blocking_queue;
 import infinity_exception;
 import third_party;
 import virtual_store;
+import s3_client;
+import default_values;
 
 namespace fs = std::filesystem;
 
 namespace infinity {
 
 void ObjectStorageProcess::Start() {
-    processor_thread_ = Thread([this] { Process(); });
-    LOG_INFO("Object storage processor is started.");
+    for (SizeT i = 0; i < DEFAULT_OBJECT_STORAGE_TRANSFER_WORKER_NUM; ++i) {
+        s3_clients_.emplace_back(VirtualStore::s3_client_->Clone());
+        processor_threads_.emplace_back([this, s3_client = s3_clients_.back().get()] { Process(s3_client); });
+    }
+    LOG_INFO(fmt::format("Object storage processor is started with {} workers.", processor_threads_.size()));
 }
 
 void ObjectStorageProcess::Stop() {
     LOG_INFO("Object storage processor is stopping.");
-    SharedPtr<StopObjectStorageProcessTask> stop_task = MakeShared<StopObjectStorageProcessTask>();
-    task_queue_.Enqueue(stop_task);
-    stop_task->Wait();
-    processor_thread_.join();
+    Vector<SharedPtr<StopObjectStorageProcessTask>> stop_tasks;
+    for (SizeT i = 0; i < processor_threads_.size(); ++i) {
+        stop_tasks.emplace_back(MakeShared<StopObjectStorageProcessTask>());
+        task_queue_.Enqueue(stop_tasks.back());
+    }
+    for (auto &stop_task : stop_tasks) {
+        stop_task->Wait();
+    }
+    for (auto &processor_thread : processor_threads_) {
+        processor_thread.join();
+    }
+    processor_threads_.clear();
+    s3_clients_.clear();
     LOG_INFO("Object storage processor is stopped.");
 }
 
@@ -50,78 +64,91 @@ void ObjectStorageProcess::Submit(SharedPtr<BaseObjectStorageTask> object_storag
     task_queue_.Enqueue(std::move(object_storage_task));
 }
 
-void ObjectStorageProcess::Process() {
+void ObjectStorageProcess::Process(S3Client *s3_client) {
     bool running{true};
-    Deque<SharedPtr<BaseObjectStorageTask>> tasks;
     while (running) {
-        task_queue_.DequeueBulk(tasks);
-        for (const auto &object_storage_task : tasks) {
-            switch (object_storage_task->type_) {
-                case ObjectStorageTaskType::kStopProcessor: {
-                    LOG_INFO("Stop the Object storage processor");
-                    {
-                        std::unique_lock<std::mutex> locker(task_mutex_);
-                        task_text_ = object_storage_task->ToString();
-                    }
-                    running = false;
-                    break;
-                }
-                case ObjectStorageTaskType::kDownload: {
-                    LOG_TRACE("Download task");
-                    DownloadTask *download_task = static_cast<DownloadTask *>(object_storage_task.get());
-                    assert(download_task != nullptr);
-                    VirtualStore::s3_client_->DownloadObject(VirtualStore::bucket_, download_task->object_name, download_task->file_dir);
-                    LOG_TRACE("Download task done");
-                    break;
-                }
-                case ObjectStorageTaskType::kUpload: {
-                    LOG_TRACE("Upload task");
-                    UploadTask *upload_task = static_cast<UploadTask *>(object_storage_task.get());
-                    assert(upload_task != nullptr);
-                    VirtualStore::s3_client_->UploadObject(VirtualStore::bucket_, upload_task->object_name, upload_task->file_dir);
-                    LOG_TRACE("Upload task done");
-                    break;
-                }
-                case ObjectStorageTaskType::kCopy: {
-                    LOG_TRACE("Copy task");
-                    CopyTask *copy_task = static_cast<CopyTask *>(object_storage_task.get());
-                    assert(copy_task != nullptr);
-                    VirtualStore::s3_client_->CopyObject(VirtualStore::bucket_,
-                                                         copy_task->src_object_name,
-                                                         VirtualStore::bucket_,
-                                                         copy_task->dst_object_name);
-                    LOG_TRACE("Copy task done");
-                    break;
-                }
-                case ObjectStorageTaskType::kRemove: {
-                    LOG_TRACE("Remove task");
-                    RemoveTask *remove_task = static_cast<RemoveTask *>(object_storage_task.get());
-                    assert(remove_task != nullptr);
-                    VirtualStore::s3_client_->RemoveObject(VirtualStore::bucket_, remove_task->object_name);
-                    LOG_TRACE("Remove task done");
-                    break;
-                }
-                case ObjectStorageTaskType::kLocalDrop: {
-                    LOG_TRACE("Local drop task");
-                    LocalDropTask *local_drop_task = static_cast<LocalDropTask *>(object_storage_task.get());
-                    bool removed = fs::remove(local_drop_task->drop_path_);
-                    if (!removed) {
-                        LOG_WARN(fmt::format("ObjectStorageProcess::Process failed to remove file: {}", local_drop_task->drop_path_));
-                    }
-                    LOG_TRACE("Local drop task done");
-                    break;
-                }
-                default: {
-                    String error_message = fmt::format("Invalid object storage: {}", (u8)object_storage_task->type_);
-                    UnrecoverableError(error_message);
-                    break;
+        // one task at a time so that the parts of a transfer spread over the workers
+        SharedPtr<BaseObjectStorageTask> object_storage_task;
+        task_queue_.Dequeue(object_storage_task);
+        switch (object_storage_task->type_) {
+            case ObjectStorageTaskType::kStopProcessor: {
+                LOG_INFO("Stop the Object storage processor");
+                running = false;
+                break;
+            }
+            case ObjectStorageTaskType::kDownload: {
+                LOG_TRACE("Download task");
+                DownloadTask *download_task = static_cast<DownloadTask *>(object_storage_task.get());
+                assert(download_task != nullptr);
+                s3_client->DownloadObject(VirtualStore::bucket_, download_task->object_name, download_task->file_dir);
+                LOG_TRACE("Download task done");
+                break;
+            }
+            case ObjectStorageTaskType::kUpload: {
+                LOG_TRACE("Upload task");
+                UploadTask *upload_task = static_cast<UploadTask *>(object_storage_task.get());
+                assert(upload_task != nullptr);
+                s3_client->UploadObject(VirtualStore::bucket_, upload_task->object_name, upload_task->file_dir);
+                LOG_TRACE("Upload task done");
+                break;
+            }
+            case ObjectStorageTaskType::kDownloadRange: {
+                LOG_TRACE("Download range task");
+                DownloadRangeTask *range_task = static_cast<DownloadRangeTask *>(object_storage_task.get());
+                assert(range_task != nullptr);
+                s3_client->DownloadObjectRange(VirtualStore::bucket_, range_task->object_name, range_task->file_dir, range_task->offset, range_task->length);
+                LOG_TRACE("Download range task done");
+                break;
+            }
+            case ObjectStorageTaskType::kUploadPart: {
+                LOG_TRACE("Upload part task");
+                UploadPartTask *part_task = static_cast<UploadPartTask *>(object_storage_task.get());
+                assert(part_task != nullptr);
+                s3_client->UploadPart(VirtualStore::bucket_,
+                                      part_task->object_name,
+                                      part_task->upload_id,
+                                      part_task->part_number,
+                                      part_task->file_dir,
+                                      part_task->offset,
+                                      part_task->length,
+                                      part_task->etag);
+                LOG_TRACE("Upload part task done");
+                break;
+            }
+            case ObjectStorageTaskType::kCopy: {
+                LOG_TRACE("Copy task");
+                CopyTask *copy_task = static_cast<CopyTask *>(object_storage_task.get());
+                assert(copy_task != nullptr);
+                s3_client->CopyObject(VirtualStore::bucket_, copy_task->src_object_name, VirtualStore::bucket_, copy_task->dst_object_name);
+                LOG_TRACE("Copy task done");
+                break;
+            }
+            case ObjectStorageTaskType::kRemove: {
+                LOG_TRACE("Remove task");
+                RemoveTask *remove_task = static_cast<RemoveTask *>(object_storage_task.get());
+                assert(remove_task != nullptr);
+                s3_client->RemoveObject(VirtualStore::bucket_, remove_task->object_name);
+                LOG_TRACE("Remove task done");
+                break;
+            }
+            case ObjectStorageTaskType::kLocalDrop: {
+                LOG_TRACE("Local drop task");
+                LocalDropTask *local_drop_task = static_cast<LocalDropTask *>(object_storage_task.get());
+                bool removed = fs::remove(local_drop_task->drop_path_);
+                if (!removed) {
+                    LOG_WARN(fmt::format("ObjectStorageProcess::Process failed to remove file: {}", local_drop_task->drop_path_));
                 }
+                LOG_TRACE("Local drop task done");
+                break;
+            }
+            default: {
+                String error_message = fmt::format("Invalid object storage: {}", (u8)object_storage_task->type_);
+                UnrecoverableError(error_message);
+                break;
             }
-            task_text_.clear();
-            object_storage_task->Complete();
         }
-        task_count_ -= tasks.size();
-        tasks.clear();
+        object_storage_task->Complete();
+        --task_count_;
     }
 }
 
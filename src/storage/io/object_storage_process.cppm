@@ -18,6 +18,7 @@ import blocking_queue;
 import stl;
 import object_storage_task;
 import global_resource_usage;
+import s3_client;
 
 export module object_storage_process;
 
@@ -45,17 +46,16 @@ public:
     void Submit(SharedPtr<BaseObjectStorageTask> object_storage_task);
 
 private:
-    void Process();
+    void Process(S3Client *s3_client);
 
 private:
     BlockingQueue<SharedPtr<BaseObjectStorageTask>> task_queue_{"ObjectStorageProcess"};
 
-    Thread processor_thread_{};
+    // The transfer workers share the queue, each with its own client since a client isn't thread safe.
+    Vector<Thread> processor_threads_{};
+    Vector<UniquePtr<S3Client>> s3_clients_{};
 
     Atomic<u64> task_count_{};
-
-    mutable std::mutex task_mutex_;
-    String task_text_;
 };
 
 } // namespace infinity
@@ -29,6 +29,8 @@ export enum class ObjectStorageTaskType {
     kInvalid,
     kDownload,
     kUpload,
+    kDownloadRange,
+    kUploadPart,
     kCopy,
     kRemove,
     kStopProcessor,
@@ -82,6 +84,38 @@ export struct UploadTask final : public BaseObjectStorageTask {
     String object_name;
 };
 
+// One range of a download split across the transfer workers, or of a file read within a packed object.
+export struct DownloadRangeTask final : public BaseObjectStorageTask {
+    DownloadRangeTask(const String &_file_dir, const String &_object_name, SizeT _offset, SizeT _length)
+        : BaseObjectStorageTask(ObjectStorageTaskType::kDownloadRange), file_dir(_file_dir), object_name(_object_name), offset(_offset),
+          length(_length) {}
+
+    ~DownloadRangeTask() = default;
+
+    String ToString() const final { return "Download Range Task"; }
+    String file_dir;
+    String object_name;
+    SizeT offset;
+    SizeT length;
+};
+
+export struct UploadPartTask final : public BaseObjectStorageTask {
+    UploadPartTask(const String &_file_dir, const String &_object_name, const String &_upload_id, SizeT _part_number, SizeT _offset, SizeT _length)
+        : BaseObjectStorageTask(ObjectStorageTaskType::kUploadPart), file_dir(_file_dir), object_name(_object_name), upload_id(_upload_id),
+          part_number(_part_number), offset(_offset), length(_length) {}
+
+    ~UploadPartTask() = default;
+
+    String ToString() const final { return "Upload Part Task"; }
+    String file_dir;
+    String object_name;
+    String upload_id;
+    SizeT part_number;
+    SizeT offset;
+    SizeT length;
+    String etag; // set by the worker
+};
+
 export struct CopyTask final : public BaseObjectStorageTask {
     CopyTask(const String &_src_object_name, const String &_dst_object_name)
         : BaseObjectStorageTask(ObjectStorageTaskType::kCopy), src_object_name(_src_object_name), dst_object_name(_dst_object_name) {}
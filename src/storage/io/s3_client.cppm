@@ -22,6 +22,27 @@ public:
 
     virtual Status UploadObject(const String &bucket_name, const String &object_name, const String &file_path) = 0;
 
+    virtual Status StatObject(const String &bucket_name, const String &object_name, SizeT &object_size) = 0;
+
+    // Download [offset, offset + length) of the object into the same range of file_path, which must exist.
+    virtual Status
+    DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) = 0;
+
+    virtual Status CreateMultipartUpload(const String &bucket_name, const String &object_name, String &upload_id) = 0;
+
+    // Upload [offset, offset + length) of file_path as part part_number (starting from 1) of the multipart upload.
+    virtual Status UploadPart(const String &bucket_name,
+                              const String &object_name,
+                              const String &upload_id,
+                              SizeT part_number,
+                              const String &file_path,
+                              SizeT offset,
+                              SizeT length,
+                              String &etag) = 0;
+
+    virtual Status
+    CompleteMultipartUpload(const String &bucket_name, const String &object_name, const String &upload_id, const Vector<String> &etags) = 0;
+
     virtual Status RemoveObject(const String &bucket_name, const String &object_name) = 0;
 
     virtual Status
@@ -30,6 +51,9 @@ public:
     virtual Status BucketExists(const String &bucket_name) = 0;
     virtual Status MakeBucket(const String &bucket_name) = 0;
 
+    // A client of the same endpoint, each transfer worker uses its own.
+    virtual UniquePtr<S3Client> Clone() const = 0;
+
 protected:
     String url;
     bool https;
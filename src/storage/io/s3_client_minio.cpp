@@ -1,5 +1,7 @@
 module;
 
+#include <fstream>
+#include <list>
 #include <string>
 
 module s3_client_minio;
@@ -61,6 +63,118 @@ Status S3ClientMinio::UploadObject(const String &bucket_name, const String &obje
     return Status::OK();
 }
 
+Status S3ClientMinio::StatObject(const String &bucket_name, const String &object_name, SizeT &object_size) {
+    minio::s3::StatObjectArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+
+    minio::s3::StatObjectResponse resp = client_->StatObject(args);
+    if (!resp) {
+        UnrecoverableError(fmt::format("Unable to stat object: {}/{}, reason: {}", bucket_name, object_name, resp.Error().String()));
+    }
+    object_size = resp.size;
+    return Status::OK();
+}
+
+Status S3ClientMinio::DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) {
+    std::ofstream fout(file_path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!fout.is_open()) {
+        UnrecoverableError(fmt::format("Unable to open file {} to download object {}/{}", file_path, bucket_name, object_name));
+    }
+    fout.seekp(offset);
+
+    minio::s3::GetObjectArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+    args.offset = &offset;
+    args.length = &length;
+    SizeT received = 0;
+    args.datafunc = [&](minio::http::DataFunctionArgs data_args) -> bool {
+        fout.write(data_args.datachunk.data(), data_args.datachunk.size());
+        received += data_args.datachunk.size();
+        return true;
+    };
+
+    LOG_TRACE(fmt::format("Downloading range [{}, {}) of object {} from {} to {}", offset, offset + length, object_name, bucket_name, file_path));
+    minio::s3::GetObjectResponse resp = client_->GetObject(args);
+    fout.close();
+    if (!resp) {
+        UnrecoverableError(fmt::format("Unable to download object range: {}/{}, reason: {}", bucket_name, object_name, resp.Error().String()));
+    }
+    if (received != length || !fout) {
+        UnrecoverableError(fmt::format("Download object range: {}/{} [{}, {}), received {} bytes", bucket_name, object_name, offset, offset + length, received));
+    }
+    return Status::OK();
+}
+
+Status S3ClientMinio::CreateMultipartUpload(const String &bucket_name, const String &object_name, String &upload_id) {
+    minio::s3::CreateMultipartUploadArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+
+    minio::s3::CreateMultipartUploadResponse resp = client_->CreateMultipartUpload(args);
+    if (!resp) {
+        UnrecoverableError(fmt::format("Unable to create multipart upload: {}/{}, reason: {}", bucket_name, object_name, resp.Error().String()));
+    }
+    upload_id = resp.upload_id;
+    return Status::OK();
+}
+
+Status S3ClientMinio::UploadPart(const String &bucket_name,
+                                 const String &object_name,
+                                 const String &upload_id,
+                                 SizeT part_number,
+                                 const String &file_path,
+                                 SizeT offset,
+                                 SizeT length,
+                                 String &etag) {
+    String data(length, '\0');
+    {
+        std::ifstream fin(file_path, std::ios::binary);
+        fin.seekg(offset);
+        fin.read(data.data(), length);
+        if (!fin || static_cast<SizeT>(fin.gcount()) != length) {
+            UnrecoverableError(fmt::format("Unable to read [{}, {}) of file {}", offset, offset + length, file_path));
+        }
+    }
+
+    minio::s3::UploadPartArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+    args.upload_id = upload_id;
+    args.part_number = part_number;
+    args.data = data;
+
+    minio::s3::UploadPartResponse resp = client_->UploadPart(args);
+    if (!resp) {
+        UnrecoverableError(
+            fmt::format("Unable to upload part {} of object: {}/{}, reason: {}", part_number, bucket_name, object_name, resp.Error().String()));
+    }
+    etag = resp.etag;
+    return Status::OK();
+}
+
+Status S3ClientMinio::CompleteMultipartUpload(const String &bucket_name,
+                                              const String &object_name,
+                                              const String &upload_id,
+                                              const Vector<String> &etags) {
+    minio::s3::CompleteMultipartUploadArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+    args.upload_id = upload_id;
+    for (SizeT i = 0; i < etags.size(); ++i) {
+        args.parts.emplace_back(i + 1, etags[i]);
+    }
+
+    minio::s3::CompleteMultipartUploadResponse resp = client_->CompleteMultipartUpload(args);
+    if (resp) {
+        LOG_INFO(fmt::format("{}/{} uploaded in {} parts successfully", bucket_name, object_name, etags.size()));
+    } else {
+        UnrecoverableError(fmt::format("Unable to complete multipart upload: {}/{}, reason: {}", bucket_name, object_name, resp.Error().String()));
+    }
+    return Status::OK();
+}
+
 Status S3ClientMinio::RemoveObject(const String &bucket_name, const String &object_name) {
     // Create remove object arguments.
     minio::s3::RemoveObjectArgs args;
@@ -151,4 +265,6 @@ Status S3ClientMinio::MakeBucket(const String &bucket_name) {
     return Status::OK();
 }
 
+UniquePtr<S3Client> S3ClientMinio::Clone() const { return MakeUnique<S3ClientMinio>(url, https, access_key, secret_key); }
+
 } // namespace infinity
@@ -32,11 +32,25 @@ public:
 
     Status DownloadObject(const String &bucket_name, const String &object_name, const String &file_path) final;
     Status UploadObject(const String &bucket_name, const String &object_name, const String &file_path) final;
+    Status StatObject(const String &bucket_name, const String &object_name, SizeT &object_size) final;
+    Status DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) final;
+    Status CreateMultipartUpload(const String &bucket_name, const String &object_name, String &upload_id) final;
+    Status UploadPart(const String &bucket_name,
+                      const String &object_name,
+                      const String &upload_id,
+                      SizeT part_number,
+                      const String &file_path,
+                      SizeT offset,
+                      SizeT length,
+                      String &etag) final;
+    Status
+    CompleteMultipartUpload(const String &bucket_name, const String &object_name, const String &upload_id, const Vector<String> &etags) final;
     Status RemoveObject(const String &bucket_name, const String &object_name) final;
     Status
     CopyObject(const String &src_bucket_name, const String &src_object_name, const String &dst_bucket_name, const String &dst_object_name) final;
     Status BucketExists(const String &bucket_name) final;
     Status MakeBucket(const String &bucket_name) final;
+    UniquePtr<S3Client> Clone() const final;
 
 private:
     minio::s3::BaseUrl base_url;
@@ -581,6 +581,7 @@ void VirtualStore::MunmapAllFiles() {
 StorageType VirtualStore::storage_type_ = StorageType::kInvalid;
 String VirtualStore::bucket_ = "infinity";
 UniquePtr<S3Client> VirtualStore::s3_client_ = nullptr;
+std::mutex VirtualStore::s3_client_mtx_;
 Atomic<u64> VirtualStore::total_request_count_ = 0;
 Atomic<u64> VirtualStore::cache_miss_count_ = 0;
 
@@ -606,6 +607,7 @@ Status VirtualStore::InitRemoteStore(StorageType storage_type,
 }
 
 Status VirtualStore::CreateBucket() {
+    std::lock_guard<std::mutex> lock(s3_client_mtx_);
     Status bucket_check = s3_client_->BucketExists(bucket_);
     if (!bucket_check.ok()) {
         if (bucket_check.code() == ErrorCode::kMinioBucketNotExists) {
@@ -625,16 +627,34 @@ Status VirtualStore::UnInitRemoteStore() {
 
 bool VirtualStore::IsInit() { return s3_client_.get() != nullptr; }
 
-Status VirtualStore::DownloadObject(const String &file_path, const String &object_name) {
+Status VirtualStore::DownloadObject(const String &file_path, const String &object_name, Optional<SizeT> object_size) {
     if (VirtualStore::storage_type_ == StorageType::kLocal) {
         return Status::OK();
     }
     switch (VirtualStore::storage_type_) {
         case StorageType::kMinio: {
-            auto download_task = MakeShared<DownloadTask>(file_path, object_name);
+            if (!object_size.has_value()) {
+                SizeT stat_size = 0;
+                {
+                    std::lock_guard<std::mutex> lock(s3_client_mtx_);
+                    s3_client_->StatObject(bucket_, object_name, stat_size);
+                }
+                object_size = stat_size;
+            }
             auto object_storage_processor = infinity::InfinityContext::instance().storage()->object_storage_processor();
-            object_storage_processor->Submit(download_task);
-            download_task->Wait();
+            if (*object_size <= DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE) {
+                auto download_task = MakeShared<DownloadTask>(file_path, object_name);
+                object_storage_processor->Submit(download_task);
+                download_task->Wait();
+                break;
+            }
+            // Fetch the parts on the transfer workers into a temporary file, which replaces file_path when complete.
+            String temp_path = fmt::format("{}.download", file_path);
+            VirtualStore::Truncate(temp_path, 0);
+            VirtualStore::Truncate(temp_path, *object_size);
+            DownloadRangeParallel(temp_path, object_name, 0, *object_size);
+            std::filesystem::rename(temp_path, file_path);
+            LOG_INFO(fmt::format("{}/{} downloaded to {} in parallel", bucket_, object_name, file_path));
             break;
         }
         default: {
@@ -645,16 +665,71 @@ Status VirtualStore::DownloadObject(const String &file_path, const String &objec
     return Status::OK();
 }
 
+Status VirtualStore::DownloadObjectRange(const String &file_path, const String &object_name, SizeT offset, SizeT length) {
+    if (VirtualStore::storage_type_ == StorageType::kLocal) {
+        return Status::OK();
+    }
+    switch (VirtualStore::storage_type_) {
+        case StorageType::kMinio: {
+            DownloadRangeParallel(file_path, object_name, offset, length);
+            break;
+        }
+        default: {
+            return Status::NotSupport("Not support storage type");
+        }
+    }
+
+    return Status::OK();
+}
+
+void VirtualStore::DownloadRangeParallel(const String &file_path, const String &object_name, SizeT offset, SizeT length) {
+    auto object_storage_processor = infinity::InfinityContext::instance().storage()->object_storage_processor();
+    Vector<SharedPtr<DownloadRangeTask>> range_tasks;
+    for (SizeT part_offset = offset; part_offset < offset + length; part_offset += DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE) {
+        SizeT part_length = std::min(DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE, offset + length - part_offset);
+        range_tasks.emplace_back(MakeShared<DownloadRangeTask>(file_path, object_name, part_offset, part_length));
+        object_storage_processor->Submit(range_tasks.back());
+    }
+    for (auto &range_task : range_tasks) {
+        range_task->Wait();
+    }
+}
+
 Status VirtualStore::UploadObject(const String &file_path, const String &object_name) {
     if (VirtualStore::storage_type_ == StorageType::kLocal) {
         return Status::OK();
     }
     switch (VirtualStore::storage_type_) {
         case StorageType::kMinio: {
-            auto upload_task = MakeShared<UploadTask>(file_path, object_name);
             auto object_storage_processor = infinity::InfinityContext::instance().storage()->object_storage_processor();
-            object_storage_processor->Submit(upload_task);
-            upload_task->Wait();
+            SizeT file_size = std::filesystem::file_size(file_path);
+            if (file_size <= DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE) {
+                auto upload_task = MakeShared<UploadTask>(file_path, object_name);
+                object_storage_processor->Submit(upload_task);
+                upload_task->Wait();
+                break;
+            }
+            // Multipart upload, the parts are uploaded by the transfer workers in parallel.
+            String upload_id;
+            {
+                std::lock_guard<std::mutex> lock(s3_client_mtx_);
+                s3_client_->CreateMultipartUpload(bucket_, object_name, upload_id);
+            }
+            Vector<SharedPtr<UploadPartTask>> part_tasks;
+            for (SizeT offset = 0; offset < file_size; offset += DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE) {
+                SizeT length = std::min(DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE, file_size - offset);
+                part_tasks.emplace_back(MakeShared<UploadPartTask>(file_path, object_name, upload_id, part_tasks.size() + 1, offset, length));
+                object_storage_processor->Submit(part_tasks.back());
+            }
+            Vector<String> etags;
+            for (auto &part_task : part_tasks) {
+                part_task->Wait();
+                etags.push_back(std::move(part_task->etag));
+            }
+            {
+                std::lock_guard<std::mutex> lock(s3_client_mtx_);
+                s3_client_->CompleteMultipartUpload(bucket_, object_name, upload_id, etags);
+            }
             break;
         }
         default: {
@@ -710,6 +785,7 @@ Status VirtualStore::BucketExists() {
     }
     switch (VirtualStore::storage_type_) {
         case StorageType::kMinio: {
+            std::lock_guard<std::mutex> lock(s3_client_mtx_);
             return s3_client_->BucketExists(VirtualStore::bucket_);
         }
         default: {
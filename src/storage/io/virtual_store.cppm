@@ -95,7 +95,10 @@ public:
 
     static bool IsInit();
     static Status CreateBucket();
-    static Status DownloadObject(const String &file_dir, const String &object_name);
+    // Download the first object_size bytes of the object into file_dir, the whole object is stat'ed for its size if None.
+    static Status DownloadObject(const String &file_dir, const String &object_name, Optional<SizeT> object_size = None);
+    // Download [offset, offset + length) of the object into the same range of file_dir, which must exist.
+    static Status DownloadObjectRange(const String &file_dir, const String &object_name, SizeT offset, SizeT length);
     static Status UploadObject(const String &file_dir, const String &object_name);
     static Status RemoveObject(const String &object_name);
     static Status CopyObject(const String &src_object_name, const String &dst_object_name);
@@ -107,6 +110,9 @@ public:
     static u64 TotalRequestCount() { return total_request_count_; }
     static u64 CacheMissCount() { return cache_miss_count_; }
 
+private:
+    static void DownloadRangeParallel(const String &file_path, const String &object_name, SizeT offset, SizeT length);
+
 private:
     static std::mutex mtx_;
     static HashMap<String, MmapInfo> mapped_files_;
@@ -114,6 +120,7 @@ private:
     static StorageType storage_type_;
     static String bucket_;
     static UniquePtr<S3Client> s3_client_;
+    static std::mutex s3_client_mtx_; // the requests not going through the transfer workers
 
     static Atomic<u64> total_request_count_;
     static Atomic<u64> cache_miss_count_;
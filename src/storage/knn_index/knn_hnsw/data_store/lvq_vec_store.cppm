@@ -33,12 +33,42 @@ import data_store_util;
 
 namespace infinity {
 
+// 4 bits per dimension, two dimensions are packed in one byte and the low nibble holds the even dimension
+export struct LVQ4 {};
+
+export template <typename CompressType>
+struct LVQCodeTraits {
+    using StorageType = CompressType;
+
+    static constexpr i32 MinCode() { return std::numeric_limits<CompressType>::min(); }
+    static constexpr i32 MaxCode() { return std::numeric_limits<CompressType>::max(); }
+    static constexpr SizeT CodeSize(SizeT dim) { return sizeof(CompressType) * dim; }
+
+    static i32 Get(const StorageType *codes, SizeT i) { return codes[i]; }
+    static void Set(StorageType *codes, SizeT i, i32 code) { codes[i] = code; }
+};
+
+export template <>
+struct LVQCodeTraits<LVQ4> {
+    using StorageType = u8;
+
+    static constexpr i32 MinCode() { return 0; }
+    static constexpr i32 MaxCode() { return 15; }
+    static constexpr SizeT CodeSize(SizeT dim) { return (dim + 1) / 2; }
+
+    static i32 Get(const StorageType *codes, SizeT i) { return (codes[i >> 1] >> ((i & 1) << 2)) & 0xF; }
+    // codes must be zeroed before set
+    static void Set(StorageType *codes, SizeT i, i32 code) { codes[i >> 1] |= code << ((i & 1) << 2); }
+};
+
 export template <typename DataType, typename LocalCacheType, typename CompressType>
 struct LVQData {
+    using StorageType = typename LVQCodeTraits<CompressType>::StorageType;
+
     DataType scale_;
     DataType bias_;
     LocalCacheType local_cache_;
-    CompressType compress_vec_[];
+    StorageType compress_vec_[];
 };
 
 export template <typename DataType, typename CompressType, typename LVQCache, bool OwnMem>
@@ -66,9 +96,11 @@ public:
 template <typename DataType, typename CompressType, typename LVQCache, bool OwnMem>
 class LVQVecStoreMetaBase {
 public:
-    // Compress type must be i8 temporarily
-    static_assert(std::is_same<CompressType, i8>() || std::is_same<CompressType, void>());
-    constexpr static SizeT max_bucket_idx_ = std::numeric_limits<CompressType>::max() - std::numeric_limits<CompressType>::min(); // 255 for i8
+    // Compress type must be i8 or LVQ4 temporarily
+    static_assert(std::is_same<CompressType, i8>() || std::is_same<CompressType, LVQ4>() || std::is_same<CompressType, void>());
+    using CodeTraits = LVQCodeTraits<CompressType>;
+    using StorageType = typename CodeTraits::StorageType;
+    constexpr static SizeT max_bucket_idx_ = CodeTraits::MaxCode() - CodeTraits::MinCode(); // 255 for i8, 15 for LVQ4
 
     using This = LVQVecStoreMetaBase<DataType, CompressType, LVQCache, OwnMem>;
     using Inner = LVQVecStoreInner<DataType, CompressType, LVQCache, OwnMem>;
@@ -129,7 +161,7 @@ public:
             src = normalized.get();
         }
 
-        CompressType *compress = dest->compress_vec_;
+        StorageType *compress = dest->compress_vec_;
 
         DataType lower = std::numeric_limits<DataType>::max();
         DataType upper = -std::numeric_limits<DataType>::max();
@@ -139,15 +171,14 @@ public:
             upper = std::max(upper, x);
         }
         DataType scale = (upper - lower) / max_bucket_idx_;
-        DataType bias = lower - std::numeric_limits<CompressType>::min() * scale;
-        if (scale == 0) {
-            std::fill(compress, compress + dim_, 0);
-        } else {
+        DataType bias = lower - CodeTraits::MinCode() * scale;
+        std::fill(compress, compress + CodeTraits::CodeSize(dim_), 0);
+        if (scale != 0) {
             DataType scale_inv = 1 / scale;
             for (SizeT j = 0; j < dim_; ++j) {
                 auto c = std::floor((src[j] - mean_[j] - bias) * scale_inv + 0.5);
-                assert(c <= std::numeric_limits<CompressType>::max() && c >= std::numeric_limits<CompressType>::min());
-                compress[j] = c;
+                assert(c <= CodeTraits::MaxCode() && c >= CodeTraits::MinCode());
+                CodeTraits::Set(compress, j, c);
             }
         }
         dest->scale_ = scale;
@@ -165,11 +196,11 @@ public:
 
 protected:
     void DecompressByMeanTo(const LVQData *src, const MeanType *mean, DataType *dest) const {
-        const CompressType *compress = src->compress_vec_;
+        const StorageType *compress = src->compress_vec_;
         DataType scale = src->scale_;
         DataType bias = src->bias_;
         for (SizeT i = 0; i < dim_; ++i) {
-            dest[i] = scale * compress[i] + bias + mean[i];
+            dest[i] = scale * CodeTraits::Get(compress, i) + bias + mean[i];
         }
     }
 
@@ -207,7 +238,7 @@ class LVQVecStoreMeta : public LVQVecStoreMetaBase<DataType, CompressType, LVQCa
 private:
     LVQVecStoreMeta(SizeT dim) {
         this->dim_ = dim;
-        this->compress_data_size_ = sizeof(LVQData) + sizeof(CompressType) * dim;
+        this->compress_data_size_ = sizeof(LVQData) + LVQCodeTraits<CompressType>::CodeSize(dim);
         this->mean_ = MakeUnique<MeanType[]>(dim);
         std::fill(this->mean_.get(), this->mean_.get() + dim, 0);
         this->global_cache_ = LVQCache::MakeGlobalCache(this->mean_.get(), dim);
@@ -295,7 +326,7 @@ class LVQVecStoreMeta<DataType, CompressType, LVQCache, false> : public LVQVecSt
 private:
     LVQVecStoreMeta(SizeT dim, MeanType *mean, GlobalCacheType global_cache) {
         this->dim_ = dim;
-        this->compress_data_size_ = sizeof(LVQData) + sizeof(CompressType) * dim;
+        this->compress_data_size_ = sizeof(LVQData) + LVQCodeTraits<CompressType>::CodeSize(dim);
         this->mean_ = mean;
         this->global_cache_ = global_cache;
     }
@@ -356,7 +387,7 @@ public:
             os << "scale: " << vec->scale_ << ", bias: " << vec->bias_ << std::endl;
             os << "compress_vec: ";
             for (SizeT j = 0; j < meta.dim(); ++j) {
-                os << static_cast<int>(vec->compress_vec_[j]) << " ";
+                os << LVQCodeTraits<CompressType>::Get(vec->compress_vec_, j) << " ";
             }
             os << std::endl;
             LVQCache::DumpLocalCache(os, vec->local_cache_);
@@ -143,8 +143,9 @@ public:
 
     static constexpr bool HasOptimize = true;
 
-    template <typename CompressType>
-    static constexpr LVQCosVecStoreType<DataType, CompressType> ToLVQ() {
+    // already compressed, keep the code type of the store
+    template <typename>
+    static constexpr LVQCosVecStoreType<DataType, CompressT> ToLVQ() {
         return {};
     }
 };
@@ -166,8 +167,9 @@ public:
 
     static constexpr bool HasOptimize = true;
 
-    template <typename CompressType>
-    static constexpr LVQL2VecStoreType<DataType, CompressType> ToLVQ() {
+    // already compressed, keep the code type of the store
+    template <typename>
+    static constexpr LVQL2VecStoreType<DataType, CompressT> ToLVQ() {
         return {};
     }
 };
@@ -189,8 +191,9 @@ public:
 
     static constexpr bool HasOptimize = true;
 
-    template <typename CompressType>
-    static constexpr LVQIPVecStoreType<DataType, CompressType> ToLVQ() {
+    // already compressed, keep the code type of the store
+    template <typename>
+    static constexpr LVQIPVecStoreType<DataType, CompressT> ToLVQ() {
         return {};
     }
 };
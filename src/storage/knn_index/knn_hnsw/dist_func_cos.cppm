@@ -91,12 +91,13 @@ public:
     using LocalCacheType = Pair<DataType, DataType>;
     using GlobalCacheType = Pair<DataType, DataType>;
 
-    static LocalCacheType MakeLocalCache(const CompressType *c, DataType scale, SizeT dim, const MeanType *mean) {
+    static LocalCacheType MakeLocalCache(const typename LVQCodeTraits<CompressType>::StorageType *c, DataType scale, SizeT dim, const MeanType *mean) {
         i64 norm1 = 0;
         MeanType mean_c = 0;
         for (SizeT i = 0; i < dim; ++i) {
-            norm1 += c[i];
-            mean_c += mean[i] * c[i];
+            i32 code = LVQCodeTraits<CompressType>::Get(c, i);
+            norm1 += code;
+            mean_c += mean[i] * code;
         }
         return {norm1 * scale, mean_c * scale};
     }
@@ -129,7 +130,8 @@ public:
     using DistanceType = typename VecStoreMetaType::DistanceType;
 
 private:
-    using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
+    using CodeType = typename LVQCodeTraits<CompressType>::StorageType;
+    using SIMDFuncType = i32 (*)(const CodeType *, const CodeType *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
 
@@ -154,6 +156,8 @@ public:
             } else {
                 SIMDFunc = GetSIMD_FUNCTIONS().HNSW_I8IP_ptr_;
             }
+        } else if constexpr (std::is_same<CompressType, LVQ4>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U4IP_ptr_;
         }
     }
 
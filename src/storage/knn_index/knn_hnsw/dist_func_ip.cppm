@@ -106,12 +106,13 @@ public:
     // for ip distance, const1 = norm1(mean), const2 = norm2(mean)
     using GlobalCacheType = Pair<double, double>;
 
-    static LocalCacheType MakeLocalCache(const CompressType *c, DataType scale, SizeT dim, const MeanType *mean) {
+    static LocalCacheType MakeLocalCache(const typename LVQCodeTraits<CompressType>::StorageType *c, DataType scale, SizeT dim, const MeanType *mean) {
         i64 norm1 = 0;
         MeanType mean_c = 0;
         for (SizeT i = 0; i < dim; i++) {
-            norm1 += c[i];
-            mean_c += mean[i] * c[i];
+            i32 code = LVQCodeTraits<CompressType>::Get(c, i);
+            norm1 += code;
+            mean_c += mean[i] * code;
         }
         return {norm1 * scale, mean_c * scale};
     }
@@ -144,7 +145,8 @@ public:
     using DistanceType = typename VecStoreMetaType::DistanceType;
 
 private:
-    using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
+    using CodeType = typename LVQCodeTraits<CompressType>::StorageType;
+    using SIMDFuncType = i32 (*)(const CodeType *, const CodeType *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
 
@@ -169,6 +171,8 @@ public:
             } else {
                 SIMDFunc = GetSIMD_FUNCTIONS().HNSW_I8IP_ptr_;
             }
+        } else if constexpr (std::is_same<CompressType, LVQ4>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U4IP_ptr_;
         }
     }
 
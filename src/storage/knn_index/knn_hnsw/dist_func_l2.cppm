@@ -109,12 +109,13 @@ public:
     using LocalCacheType = Pair<DataType, DataType>;
     using GlobalCacheType = Tuple<>;
 
-    static LocalCacheType MakeLocalCache(const CompressType *c, DataType scale, SizeT dim, const MeanType *) {
+    static LocalCacheType MakeLocalCache(const typename LVQCodeTraits<CompressType>::StorageType *c, DataType scale, SizeT dim, const MeanType *) {
         i64 norm1 = 0;
         i64 norm2 = 0;
         for (SizeT i = 0; i < dim; ++i) {
-            norm1 += c[i];
-            norm2 += c[i] * c[i];
+            i32 code = LVQCodeTraits<CompressType>::Get(c, i);
+            norm1 += code;
+            norm2 += code * code;
         }
         return {norm1 * scale, norm2 * scale * scale};
     }
@@ -138,7 +139,8 @@ public:
     using DistanceType = typename VecStoreMetaType::DistanceType;
 
 private:
-    using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
+    using CodeType = typename LVQCodeTraits<CompressType>::StorageType;
+    using SIMDFuncType = i32 (*)(const CodeType *, const CodeType *, SizeT);
 
     SIMDFuncType SIMDFunc = nullptr;
 
@@ -163,6 +165,8 @@ public:
             } else {
                 SIMDFunc = GetSIMD_FUNCTIONS().HNSW_I8IP_ptr_;
             }
+        } else if constexpr (std::is_same<CompressType, LVQ4>()) {
+            SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U4IP_ptr_;
         }
     }
 
@@ -14,6 +14,7 @@
 
 module;
 
+#include <future>
 #include <ostream>
 #include <random>
 
@@ -351,10 +352,52 @@ public:
 
     void Optimize() { data_store_.Optimize(); }
 
-    void Build(VertexType vertex_i) {
+    void Build(VertexType vertex_i) { Build(vertex_i, GenerateRandomLayer()); }
+
+    // Build the stored vertices [start_i, end_i) on the thread pool. The layers are drawn up front and the build runs in
+    // two phases: vertices reaching the upper layers first, then the layer 0 only ones. So the bulk of the insertions
+    // search a settled upper graph and seldom race on the enter point.
+    void ParallelBuild(VertexType start_i, VertexType end_i, ThreadPool &thread_pool, SizeT min_bucket_size) {
+        if (start_i >= end_i) {
+            return;
+        }
+        Vector<i32> layers(end_i - start_i);
+        Vector<VertexType> upper_vertices;
+        Vector<VertexType> bottom_vertices;
+        bottom_vertices.reserve(end_i - start_i);
+        for (VertexType vertex_i = start_i; vertex_i < end_i; ++vertex_i) {
+            i32 q_layer = GenerateRandomLayer();
+            layers[vertex_i - start_i] = q_layer;
+            (q_layer > 0 ? upper_vertices : bottom_vertices).push_back(vertex_i);
+        }
+        auto build_phase = [&](const Vector<VertexType> &vertices) {
+            if (vertices.empty()) {
+                return;
+            }
+            SizeT bucket_size = std::max(min_bucket_size, (vertices.size() - 1) / thread_pool.size() + 1);
+            SizeT bucket_n = (vertices.size() - 1) / bucket_size + 1;
+            Vector<std::future<void>> futs;
+            futs.reserve(bucket_n);
+            for (SizeT i = 0; i < bucket_n; ++i) {
+                SizeT i1 = i * bucket_size;
+                SizeT i2 = std::min(i1 + bucket_size, vertices.size());
+                futs.emplace_back(thread_pool.push([&, i1, i2](int id) {
+                    for (SizeT j = i1; j < i2; ++j) {
+                        Build(vertices[j], layers[vertices[j] - start_i]);
+                    }
+                }));
+            }
+            for (auto &fut : futs) {
+                fut.get();
+            }
+        };
+        build_phase(upper_vertices);
+        build_phase(bottom_vertices);
+    }
+
+    void Build(VertexType vertex_i, i32 q_layer) {
         std::unique_lock<std::shared_mutex> lock = data_store_.UniqueLock(vertex_i);
 
-        i32 q_layer = GenerateRandomLayer();
         auto [max_layer, ep] = data_store_.TryUpdateEnterPoint(q_layer, vertex_i);
 
         StoreType query = data_store_.GetVec(vertex_i);
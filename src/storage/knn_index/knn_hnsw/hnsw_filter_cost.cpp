@@ -0,0 +1,45 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+module hnsw_filter_cost;
+
+import stl;
+
+namespace infinity {
+
+double HnswFilterCost::GraphCost(SizeT segment_row_count, SizeT filter_row_count, SizeT topk, SizeT ef, SizeT M) {
+    if (segment_row_count == 0) {
+        return 0;
+    }
+    const double candidate_count = std::max(ef, topk);
+    const double selectivity = static_cast<double>(std::max<SizeT>(filter_row_count, 1)) / segment_row_count;
+    // the upper layers are searched without the filter
+    const double upper_layer_cost = M * std::log2(static_cast<double>(segment_row_count) + 1);
+    const double expand_count = std::min(candidate_count / selectivity, static_cast<double>(segment_row_count));
+    return kGraphDistanceCost * (upper_layer_cost + expand_count * M);
+}
+
+double HnswFilterCost::ScanCost(SizeT segment_row_count, SizeT filter_row_count) {
+    return filter_row_count + kScanRowCost * segment_row_count;
+}
+
+bool HnswFilterCost::PreferScan(SizeT segment_row_count, SizeT filter_row_count, SizeT topk, SizeT ef, SizeT M) {
+    return ScanCost(segment_row_count, filter_row_count) < GraphCost(segment_row_count, filter_row_count, topk, ef, M);
+}
+
+} // namespace infinity
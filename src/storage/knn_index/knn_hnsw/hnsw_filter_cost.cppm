@@ -0,0 +1,42 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module hnsw_filter_cost;
+
+import stl;
+
+namespace infinity {
+
+// Cost model of a filtered KNN search in one segment with a HNSW index, in units of one sequential distance computation.
+// The row counts are exact, the filter of the search is evaluated for the segment before the search.
+export struct HnswFilterCost {
+    // A graph step reads the vector of a random vertex, a scan reads the vectors of a block in order.
+    static constexpr double kGraphDistanceCost = 2.0;
+    // Checking the filter of a row during a block scan.
+    static constexpr double kScanRowCost = 0.01;
+
+    // Distance computations of the graph search: it expands about max(ef, topk) vertices that pass the filter, and
+    // 1 / selectivity vertices for each of them, computing the distances to the M new neighbors of each vertex.
+    static double GraphCost(SizeT segment_row_count, SizeT filter_row_count, SizeT topk, SizeT ef, SizeT M);
+
+    // Distances of the rows passing the filter, and the filter check of every row of the segment.
+    static double ScanCost(SizeT segment_row_count, SizeT filter_row_count);
+
+    // Whether scanning the rows passing the filter is cheaper than searching the graph, true on very selective filters.
+    static bool PreferScan(SizeT segment_row_count, SizeT filter_row_count, SizeT topk, SizeT ef, SizeT M);
+};
+
+} // namespace infinity
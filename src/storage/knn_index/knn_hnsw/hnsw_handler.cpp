@@ -92,6 +92,29 @@ AbstractHnsw InitAbstractIndexT(const IndexHnsw *index_hnsw) {
                 }
             }
         }
+        case HnswEncodeType::kLVQ4: {
+            if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+                return nullptr;
+            } else if (index_hnsw->build_type_ == HnswBuildType::kPlain) {
+                switch (index_hnsw->metric_type_) {
+                    case MetricType::kMetricL2: {
+                        using HnswIndex = KnnHnsw<LVQL2VecStoreType<DataType, LVQ4>, SegmentOffset, OwnMem>;
+                        return static_cast<HnswIndex *>(nullptr);
+                    }
+                    case MetricType::kMetricInnerProduct: {
+                        using HnswIndex = KnnHnsw<LVQIPVecStoreType<DataType, LVQ4>, SegmentOffset, OwnMem>;
+                        return static_cast<HnswIndex *>(nullptr);
+                    }
+                    case MetricType::kMetricCosine: {
+                        using HnswIndex = KnnHnsw<LVQCosVecStoreType<DataType, LVQ4>, SegmentOffset, OwnMem>;
+                        return static_cast<HnswIndex *>(nullptr);
+                    }
+                    default: {
+                        return nullptr;
+                    }
+                }
+            }
+        }
         default: {
             return nullptr;
         }
@@ -661,6 +684,10 @@ void HnswIndexInMem::Dump(BufferObj *buffer_obj, SizeT *dump_size_ptr) {
     BufferHandle handle = buffer_obj->Load();
     auto *data_ptr = static_cast<HnswHandlerPtr *>(handle.GetDataMut());
     *data_ptr = hnsw_handler_;
+    if (!own_memory_) {
+        // Dumped again because the dump into the previous chunk wasn't committed, take the index back from that chunk.
+        *static_cast<HnswHandlerPtr *>(chunk_handle_.GetDataMut()) = nullptr;
+    }
     own_memory_ = false;
     chunk_handle_ = std::move(handle);
 }
@@ -16,6 +16,7 @@ import stl;
 import hnsw_alg;
 import data_store;
 import vec_store_type;
+import lvq_vec_store;
 import dist_func_l2;
 import dist_func_ip;
 import hnsw_common;
@@ -23,6 +24,7 @@ import column_def;
 import index_hnsw;
 import infinity_exception;
 import index_base;
+import create_index_info;
 import logger;
 import internal_types;
 import embedding_info;
@@ -57,6 +59,9 @@ using AbstractHnsw = std::variant<KnnHnsw<PlainCosVecStoreType<float>, SegmentOf
                                   KnnHnsw<LVQCosVecStoreType<float, i8>, SegmentOffset> *,
                                   KnnHnsw<LVQIPVecStoreType<float, i8>, SegmentOffset> *,
                                   KnnHnsw<LVQL2VecStoreType<float, i8>, SegmentOffset> *,
+                                  KnnHnsw<LVQCosVecStoreType<float, LVQ4>, SegmentOffset> *,
+                                  KnnHnsw<LVQIPVecStoreType<float, LVQ4>, SegmentOffset> *,
+                                  KnnHnsw<LVQL2VecStoreType<float, LVQ4>, SegmentOffset> *,
                                   KnnHnsw<PlainCosVecStoreType<float, true>, SegmentOffset> *,
                                   KnnHnsw<PlainIPVecStoreType<float, true>, SegmentOffset> *,
                                   KnnHnsw<PlainL2VecStoreType<float, true>, SegmentOffset> *,
@@ -79,6 +84,9 @@ using AbstractHnsw = std::variant<KnnHnsw<PlainCosVecStoreType<float>, SegmentOf
                                   KnnHnsw<LVQCosVecStoreType<float, i8>, SegmentOffset, false> *,
                                   KnnHnsw<LVQIPVecStoreType<float, i8>, SegmentOffset, false> *,
                                   KnnHnsw<LVQL2VecStoreType<float, i8>, SegmentOffset, false> *,
+                                  KnnHnsw<LVQCosVecStoreType<float, LVQ4>, SegmentOffset, false> *,
+                                  KnnHnsw<LVQIPVecStoreType<float, LVQ4>, SegmentOffset, false> *,
+                                  KnnHnsw<LVQL2VecStoreType<float, LVQ4>, SegmentOffset, false> *,
                                   KnnHnsw<PlainCosVecStoreType<float, true>, SegmentOffset, false> *,
                                   KnnHnsw<PlainIPVecStoreType<float, true>, SegmentOffset, false> *,
                                   KnnHnsw<PlainL2VecStoreType<float, true>, SegmentOffset, false> *,
@@ -151,23 +159,7 @@ private:
             } else {
                 SizeT mem1 = index->mem_usage();
                 auto [start, end] = index->StoreData(std::forward<Iter>(iter), config);
-                SizeT bucket_size = std::max(kBuildBucketSize, SizeT(end - start - 1) / thread_pool.size() + 1);
-                SizeT bucket_n = (end - start - 1) / bucket_size + 1;
-
-                Vector<std::future<void>> futs;
-                futs.reserve(bucket_n);
-                for (SizeT i = 0; i < bucket_n; ++i) {
-                    SizeT i1 = start + i * bucket_size;
-                    SizeT i2 = std::min(i1 + bucket_size, SizeT(end));
-                    futs.emplace_back(thread_pool.push([&index, i1, i2](int id) {
-                        for (SizeT j = i1; j < i2; ++j) {
-                            index->Build(j);
-                        }
-                    }));
-                }
-                for (auto &fut : futs) {
-                    fut.get();
-                }
+                index->ParallelBuild(start, end, thread_pool, kBuildBucketSize);
                 SizeT mem2 = index->mem_usage();
                 mem_usage = mem2 - mem1;
             }
@@ -349,6 +341,8 @@ public:
 protected:
     MemIndexTracerInfo GetInfo() const override;
 
+    IndexType GetIndexType() const override { return IndexType::kHnsw; }
+
 private:
     static constexpr SizeT kBuildBucketSize = 1024;
 
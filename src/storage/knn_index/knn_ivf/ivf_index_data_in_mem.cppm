@@ -25,6 +25,7 @@ import logical_type;
 import buffer_handle;
 import base_memindex;
 import memindex_tracer;
+import create_index_info;
 import table_index_entry;
 import chunk_index_meta;
 
@@ -64,6 +65,8 @@ public:
     virtual ~IVFIndexInMem();
     u32 GetInputRowCount() const;
 
+    IndexType GetIndexType() const override { return IndexType::kIVF; }
+
     virtual RowID GetBeginRowID() const = 0;
 
     virtual u32 GetRowCount() const = 0;
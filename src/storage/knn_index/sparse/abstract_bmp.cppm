@@ -24,6 +24,7 @@ import stl;
 import bmp_alg;
 import bmp_util;
 import index_base;
+import create_index_info;
 import column_def;
 import internal_types;
 import index_bmp;
@@ -80,6 +81,8 @@ public:
 
     MemIndexTracerInfo GetInfo() const override;
 
+    IndexType GetIndexType() const override { return IndexType::kBMP; }
+
     TableIndexEntry *table_index_entry() const override;
 
 private:
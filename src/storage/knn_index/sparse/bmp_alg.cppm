@@ -28,6 +28,7 @@ import bp_reordering;
 import serialize;
 import third_party;
 import infinity_exception;
+import parallel_for;
 
 namespace infinity {
 
@@ -40,7 +41,9 @@ class BMPAlgBase {
 public:
 protected:
     BMPAlgBase(BMPIvt<DataType, CompressType, OwnMem> bm_ivt, BlockFwd<DataType, IdxType, OwnMem> block_fwd, VecPtr<BMPDocID, OwnMem> doc_ids)
-        : bm_ivt_(std::move(bm_ivt)), block_fwd_(std::move(block_fwd)), doc_ids_(std::move(doc_ids)) {}
+        : bm_ivt_(std::move(bm_ivt)), block_fwd_(std::move(block_fwd)), doc_ids_(std::move(doc_ids)) {
+        quantized_block_max_.Build(bm_ivt_);
+    }
     BMPAlgBase(SizeT term_num, SizeT block_size) : bm_ivt_(term_num), block_fwd_(block_size) {}
 
 public:
@@ -77,18 +80,16 @@ public:
 
         DataType threshold = 0.0;
         SizeT block_num = block_fwd_.block_num();
-        Vector<DataType> upper_bounds(block_num, 0.0);
         for (i32 i = 0; i < query_ref.nnz_; ++i) {
-            // if (i + 1 < query_ref.nnz_) {
-            //     IdxType next_query_term = query_ref.indices_[i + 1];
-            //     bm_ivt_.Prefetch(next_query_term);
-            // }
             IdxType query_term = query_ref.indices_[i];
             DataType query_score = query_ref.data_[i];
-            const auto &posting = bm_ivt_.GetPostings(query_term);
-            threshold = std::max(threshold, query_score * posting.kth(topk));
-            Calculate2(upper_bounds, query_score, posting.data());
+            threshold = std::max(threshold, query_score * bm_ivt_.GetPostings(query_term).kth(topk));
         }
+        Vector<DataType> upper_bounds(block_num, 0.0);
+        SizeT ub_thread_num = std::min(SizeT(std::max(options.thread_num_, 1)), block_num / kParallelUpperBoundMinBlocks);
+        RunParallel(options, block_num, ub_thread_num, [&](SizeT block_begin, SizeT block_end) {
+            CalculateUpperBounds(query_ref, BMPBlockID(block_begin), BMPBlockID(block_end), upper_bounds.data());
+        });
 
         Vector<Pair<DataType, BMPBlockID>> block_scores;
         for (SizeT block_id = 0; block_id < block_num; ++block_id) {
@@ -151,7 +152,51 @@ public:
         return {result_docid, result_score};
     }
 
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>>
+    SearchKnnBatch(const Vector<SparseVecRef<DataType, IdxType>> &queries, i32 topk, const BmpSearchOptions &options) const {
+        return SearchKnnBatch(queries, topk, options, nullptr);
+    }
+
+    // Queries of the batch are split into options.thread_num_ ranges on options.thread_pool_, each query is searched by one thread
+    template <FilterConcept<BMPDocID> Filter = NoneType>
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> SearchKnnBatch(const Vector<SparseVecRef<DataType, IdxType>> &queries,
+                                                                    i32 topk,
+                                                                    const BmpSearchOptions &options,
+                                                                    const Filter &filter) const {
+        Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> results(queries.size());
+        BmpSearchOptions query_options = options;
+        query_options.thread_num_ = 1;
+        RunParallel(options, queries.size(), SizeT(std::max(options.thread_num_, 1)), [&](SizeT query_begin, SizeT query_end) {
+            for (SizeT i = query_begin; i < query_end; ++i) {
+                results[i] = SearchKnn(queries[i], topk, query_options, filter);
+            }
+        });
+        return results;
+    }
+
 protected:
+    template <typename Func>
+    static void RunParallel(const BmpSearchOptions &options, SizeT n, SizeT task_num, Func &&func) {
+        if (options.thread_pool_ == nullptr) {
+            func(SizeT(0), n);
+            return;
+        }
+        ParallelFor(*options.thread_pool_, n, task_num, std::forward<Func>(func));
+    }
+
+    void CalculateUpperBounds(const SparseVecRef<DataType, IdxType> &query, BMPBlockID block_begin, BMPBlockID block_end, DataType *upper_bounds) const {
+        for (i32 i = 0; i < query.nnz_; ++i) {
+            IdxType query_term = query.indices_[i];
+            DataType query_score = query.data_[i];
+            const auto &posting = bm_ivt_.GetPostings(query_term);
+            if (!quantized_block_max_.Empty()) {
+                quantized_block_max_.Accumulate(query_term, posting.data(), query_score, block_begin, block_end, upper_bounds);
+            } else {
+                Calculate2(upper_bounds, query_score, posting.data(), block_begin, block_end);
+            }
+        }
+    }
+
     Vector<DataType> GetScores(const BlockTerms<DataType, IdxType, OwnMem> &block_terms, const SparseVecRef<DataType, IdxType> &query) const {
         Vector<DataType> res(block_fwd_.block_size(), 0.0);
 
@@ -179,31 +224,40 @@ protected:
         }
     }
 
-    static void Calculate2(Vector<DataType> &upper_bounds, DataType query_score, const BlockData<DataType, CompressType, OwnMem> &block_data) {
+    static void Calculate2(DataType *upper_bounds,
+                           DataType query_score,
+                           const BlockData<DataType, CompressType, OwnMem> &block_data,
+                           BMPBlockID block_begin,
+                           BMPBlockID block_end) {
         if constexpr (CompressType == BMPCompressType::kCompressed) {
             SizeT block_num = block_data.block_num();
             const BMPBlockID *block_ids = block_data.block_ids();
             const DataType *max_scores = block_data.max_scores();
-            for (SizeT i = 0; i < block_num; ++i) {
+            // block ids of a posting are ascending
+            SizeT i = std::lower_bound(block_ids, block_ids + block_num, block_begin) - block_ids;
+            for (; i < block_num && block_ids[i] < block_end; ++i) {
                 BMPBlockID block_id = block_ids[i];
                 DataType score = max_scores[i];
                 upper_bounds[block_id] += score * query_score;
             }
         } else {
-            SizeT block_num = block_data.block_num();
+            BMPBlockID end = std::min(block_end, BMPBlockID(block_data.block_num()));
             const DataType *max_scores = block_data.max_scores();
-            for (BMPBlockID block_id = 0; block_id < BMPBlockID(block_num); ++block_id) {
-                if (max_scores[block_id] > 0.0) {
-                    upper_bounds[block_id] += max_scores[block_id] * query_score;
-                }
+            // branch free so that the loop is vectorized
+            for (BMPBlockID block_id = block_begin; block_id < end; ++block_id) {
+                upper_bounds[block_id] += std::max(max_scores[block_id], DataType(0.0)) * query_score;
             }
         }
     }
 
 protected:
+    static constexpr SizeT kParallelUpperBoundMinBlocks = 1 << 16;
+
     BMPIvt<DataType, CompressType, OwnMem> bm_ivt_;
     BlockFwd<DataType, IdxType, OwnMem> block_fwd_;
     VecPtr<BMPDocID, OwnMem> doc_ids_;
+    // empty when blocks were added after the last build, then the f32 table is used
+    BMPQuantizedBlockMax<DataType, CompressType> quantized_block_max_;
 };
 
 export template <typename DataType, typename IdxType, BMPCompressType CompressType, BMPOwnMem OwnMem = BMPOwnMem::kTrue>
@@ -244,6 +298,10 @@ public:
         const auto &tail_terms = tail_fwd->GetTailTerms();
         this->bm_ivt_.AddBlock(block_id, tail_terms, mem_usage);
         mem_usage_.fetch_add(sizeof(BMPDocID) + mem_usage);
+        if (!this->quantized_block_max_.Empty()) {
+            mem_usage_.fetch_sub(this->quantized_block_max_.GetSizeInBytes());
+            this->quantized_block_max_.Clear();
+        }
     }
 
     template <DataIteratorConcept<SparseVecRef<DataType, IdxType>, BMPDocID> Iterator>
@@ -307,6 +365,9 @@ public:
             Vector<Vector<DataType>> ivt_scores = this->block_fwd_.GetIvtScores(term_num);
             this->bm_ivt_.Optimize(options.topk_, std::move(ivt_scores));
         }
+        mem_usage_.fetch_sub(this->quantized_block_max_.GetSizeInBytes());
+        this->quantized_block_max_.Build(this->bm_ivt_);
+        mem_usage_.fetch_add(this->quantized_block_max_.GetSizeInBytes());
     }
 
     Pair<Vector<BMPDocID>, Vector<DataType>>
@@ -324,6 +385,23 @@ public:
         return BMPAlgBase<DataType, IdxType, CompressType, BMPOwnMem::kTrue>::SearchKnn(query, topk, options, filter);
     }
 
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>>
+    SearchKnnBatch(const Vector<SparseVecRef<DataType, IdxType>> &queries, i32 topk, const BmpSearchOptions &options) const {
+        return SearchKnnBatch(queries, topk, options, nullptr);
+    }
+
+    template <FilterConcept<BMPDocID> Filter = NoneType>
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> SearchKnnBatch(const Vector<SparseVecRef<DataType, IdxType>> &queries,
+                                                                    i32 topk,
+                                                                    const BmpSearchOptions &options,
+                                                                    const Filter &filter) const {
+        std::shared_lock lock(mtx_, std::defer_lock);
+        if (options.use_lock_) {
+            lock.lock();
+        }
+        return BMPAlgBase<DataType, IdxType, CompressType, BMPOwnMem::kTrue>::SearchKnnBatch(queries, topk, options, filter);
+    }
+
     void Save(LocalFileHandle &file_handle) const {
         auto size = GetSizeInBytes();
         auto buffer = MakeUnique<char[]>(sizeof(size) + size);
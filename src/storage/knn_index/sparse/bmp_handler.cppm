@@ -24,6 +24,7 @@ import stl;
 import bmp_alg;
 import bmp_util;
 import index_base;
+import create_index_info;
 import column_def;
 import internal_types;
 import index_bmp;
@@ -229,6 +230,8 @@ public:
     SizeT GetRowCount() const;
     SizeT GetSizeInBytes() const;
     MemIndexTracerInfo GetInfo() const override;
+
+    IndexType GetIndexType() const override { return IndexType::kBMP; }
     TableIndexEntry *table_index_entry() const override;
     RowID GetBeginRowID() const { return begin_row_id_; }
     const BMPHandlerPtr &get() const { return bmp_handler_; }
@@ -16,6 +16,7 @@ module;
 
 #include "common/simd/simd_common_intrin_include.h"
 #include <algorithm>
+#include <cmath>
 
 export module bmp_ivt;
 
@@ -451,6 +452,9 @@ private:
 
 template <typename DataType>
 class BMPIvtBase {
+public:
+    SizeT term_num() const { return posting_size_; }
+
 protected:
     SizeT posting_size_ = 0;
     const i32 *kth_ = nullptr;
@@ -520,4 +524,81 @@ private:
     const DataType *max_scores_ = nullptr;
 };
 
-} // namespace infinity
\ No newline at end of file
+// u8 copy of the block max scores, a quarter of the f32 table to stream in the block-max phase.
+// Every term has its own scale and scores are rounded up, so the dequantized value is still an upper bound.
+export template <typename DataType, BMPCompressType CompressType>
+class BMPQuantizedBlockMax {
+public:
+    template <typename Ivt>
+    void Build(const Ivt &ivt) {
+        SizeT term_num = ivt.term_num();
+        offsets_.assign(1, 0);
+        scales_.assign(term_num, 0.0);
+        for (SizeT term_id = 0; term_id < term_num; ++term_id) {
+            offsets_.push_back(offsets_.back() + ivt.GetPostings(term_id).data().block_num());
+        }
+        max_scores_.assign(offsets_.back(), 0);
+        for (SizeT term_id = 0; term_id < term_num; ++term_id) {
+            const auto &posting = ivt.GetPostings(term_id);
+            SizeT block_num = posting.data().block_num();
+            const DataType *max_scores = posting.data().max_scores();
+            DataType term_max = 0.0;
+            for (SizeT i = 0; i < block_num; ++i) {
+                term_max = std::max(term_max, max_scores[i]);
+            }
+            if (term_max <= 0.0) {
+                continue;
+            }
+            // slightly enlarged so that rounding never produces a value below the original score
+            DataType scale = term_max / 255 * DataType(1.0 + 1e-6);
+            scales_[term_id] = scale;
+            u8 *quantized = max_scores_.data() + offsets_[term_id];
+            for (SizeT i = 0; i < block_num; ++i) {
+                DataType score = std::max(max_scores[i], DataType(0.0));
+                quantized[i] = static_cast<u8>(std::min(DataType(255.0), std::ceil(score / scale)));
+            }
+        }
+    }
+
+    void Clear() {
+        offsets_.clear();
+        scales_.clear();
+        max_scores_.clear();
+    }
+
+    bool Empty() const { return offsets_.empty(); }
+
+    SizeT GetSizeInBytes() const { return offsets_.size() * sizeof(SizeT) + scales_.size() * sizeof(DataType) + max_scores_.size() * sizeof(u8); }
+
+    // Add the upper bounds of term_id to blocks in [block_begin, block_end)
+    template <typename BlockDataT>
+    void Accumulate(SizeT term_id,
+                    const BlockDataT &block_data,
+                    DataType query_score,
+                    BMPBlockID block_begin,
+                    BMPBlockID block_end,
+                    DataType *upper_bounds) const {
+        const u8 *quantized = max_scores_.data() + offsets_[term_id];
+        const DataType weight = query_score * scales_[term_id];
+        if constexpr (CompressType == BMPCompressType::kCompressed) {
+            SizeT block_num = block_data.block_num();
+            const BMPBlockID *block_ids = block_data.block_ids();
+            SizeT i = std::lower_bound(block_ids, block_ids + block_num, block_begin) - block_ids;
+            for (; i < block_num && block_ids[i] < block_end; ++i) {
+                upper_bounds[block_ids[i]] += quantized[i] * weight;
+            }
+        } else {
+            BMPBlockID end = std::min(block_end, BMPBlockID(block_data.block_num()));
+            for (BMPBlockID block_id = block_begin; block_id < end; ++block_id) {
+                upper_bounds[block_id] += quantized[block_id] * weight;
+            }
+        }
+    }
+
+private:
+    Vector<SizeT> offsets_;
+    Vector<DataType> scales_;
+    Vector<u8> max_scores_;
+};
+
+} // namespace infinity
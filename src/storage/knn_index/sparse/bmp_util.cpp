@@ -53,6 +53,13 @@ BmpSearchOptions BMPUtil::ParseBmpSearchOptions(const Vector<UniquePtr<InitParam
                 continue;
             }
             options.use_lock_ = IsEqual(opt_param->param_value_, "T");
+        } else if (opt_param->param_name_ == "threads") {
+            i32 thread_num = std::stoi(opt_param->param_value_);
+            if (thread_num <= 0) {
+                LOG_WARN("Invalid threads value, should be greater than 0");
+                continue;
+            }
+            options.thread_num_ = thread_num;
         }
     }
     return options;
@@ -105,6 +105,10 @@ export struct BmpSearchOptions {
     f32 beta_ = 1.0;
     bool use_tail_ = true;
     bool use_lock_ = true;
+    // threads for the block-max phase of one query, or for the queries of a batch
+    i32 thread_num_ = 1;
+    // the pool running thread_num_ - 1 of the threads, set by the caller; all of the work runs on the calling thread if null
+    ThreadPool *thread_pool_ = nullptr;
 };
 
 export struct BMPOptimizeOptions {
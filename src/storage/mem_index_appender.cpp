@@ -90,11 +90,11 @@ void MemIndexAppender::Process() {
                     }
                     if (storage_mode == StorageMode::kWritable) {
                         auto append_mem_index_task = static_cast<AppendMemIndexTask *>(bg_task.get());
-                        if (append_mem_index_task->mem_index_->memory_indexer_ == nullptr) {
+                        if (append_mem_index_task->memory_indexer_ == nullptr) {
                             // Only used for full text index, currently
                             UnrecoverableError("Not inverted index");
                         }
-                        MemoryIndexer *memory_indexer = append_mem_index_task->mem_index_->memory_indexer_.get();
+                        MemoryIndexer *memory_indexer = append_mem_index_task->memory_indexer_.get();
                         if (memory_indexer_map.find(memory_indexer) == memory_indexer_map.end()) {
                             memory_indexers.push_back(memory_indexer);
                             memory_indexer_map.emplace(memory_indexer, MakeShared<AppendMemIndexBatch>());
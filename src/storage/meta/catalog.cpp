@@ -467,8 +467,9 @@ void Catalog::Append(TableEntry *table_entry,
                      void *txn_store,
                      TxnTimeStamp commit_ts,
                      BufferManager *buffer_mgr,
-                     bool is_replay) {
-    return table_entry->AppendData(txn_id, txn_store, commit_ts, buffer_mgr, is_replay);
+                     bool is_replay,
+                     bool replicate_index) {
+    return table_entry->AppendData(txn_id, txn_store, commit_ts, buffer_mgr, is_replay, replicate_index);
 }
 
 void Catalog::RollbackAppend(TableEntry *table_entry, TransactionID txn_id, TxnTimeStamp commit_ts, void *txn_store) {
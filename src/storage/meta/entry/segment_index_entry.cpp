@@ -74,6 +74,7 @@ import infinity_context;
 import defer_op;
 import memory_indexer;
 import hnsw_lsg_builder;
+import chunk_index_meta;
 
 namespace infinity {
 
@@ -459,6 +460,67 @@ u32 SegmentIndexEntry::MemIndexRowCount() {
     }
 }
 
+void SegmentIndexEntry::MemIndexReplaceReplayWal(RowID chunk_end_rowid, TxnTimeStamp commit_ts) {
+    RowID mem_end_rowid = chunk_end_rowid;
+    {
+        std::lock_guard lck_m(mem_index_locker_);
+        std::unique_lock lck(rw_locker_);
+        auto release_memory_index = [&](auto &memory_index) {
+            if (memory_index.get() == nullptr) {
+                return;
+            }
+            const ChunkIndexMetaInfo meta_info = memory_index->GetChunkIndexMetaInfo();
+            mem_end_rowid = std::max(mem_end_rowid, meta_info.base_row_id_ + static_cast<u32>(meta_info.row_cnt_));
+            memory_index.reset();
+        };
+        switch (table_index_entry_->index_base()->index_type_) {
+            case IndexType::kFullText: {
+                release_memory_index(memory_indexer_);
+                break;
+            }
+            case IndexType::kHnsw: {
+                release_memory_index(memory_hnsw_index_);
+                break;
+            }
+            case IndexType::kSecondary: {
+                release_memory_index(memory_secondary_index_);
+                break;
+            }
+            case IndexType::kIVF: {
+                release_memory_index(memory_ivf_index_);
+                break;
+            }
+            case IndexType::kEMVB: {
+                release_memory_index(memory_emvb_index_);
+                break;
+            }
+            case IndexType::kBMP: {
+                release_memory_index(memory_bmp_index_);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+    if (mem_end_rowid <= chunk_end_rowid) {
+        return;
+    }
+
+    // The rows appended after the dump of leader
+    TableEntry *table_entry = table_index_entry_->table_index_meta()->GetTableEntry();
+    SharedPtr<SegmentEntry> segment_entry = table_entry->GetSegmentByID(segment_id_, MAX_TIMESTAMP);
+    const u32 begin_offset = chunk_end_rowid.segment_offset_;
+    const u32 end_offset = mem_end_rowid.segment_offset_;
+    for (const auto &block_entry : segment_entry->block_entries()) {
+        const u32 block_begin = std::max(begin_offset, block_entry->segment_offset());
+        const u32 block_end = std::min(end_offset, static_cast<u32>(block_entry->segment_offset() + block_entry->row_count()));
+        if (block_begin < block_end) {
+            MemIndexInsert(block_entry, block_begin - block_entry->segment_offset(), block_end - block_begin, commit_ts, buffer_manager_, nullptr);
+        }
+    }
+}
+
 void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
@@ -732,7 +794,8 @@ void SegmentIndexEntry::CommitOptimize(ChunkIndexEntry *new_chunk, const Vector<
 void SegmentIndexEntry::OptIndex(SharedPtr<IndexBase> new_index_base,
                                  TxnTableStore *txn_table_store,
                                  const Vector<UniquePtr<InitParameter>> &opt_params,
-                                 bool replay) {
+                                 bool replay,
+                                 bool save_index) {
     SharedPtr<ChunkIndexEntry> dumped_memindex_entry = nullptr;
     auto set_fileworker_index_def = [&](ChunkIndexEntry *chunk_index_entry) {
         auto *index_file_worker = static_cast<IndexFileWorker *>(chunk_index_entry->GetBufferObj()->file_worker());
@@ -777,7 +840,9 @@ void SegmentIndexEntry::OptIndex(SharedPtr<IndexBase> new_index_base,
                 auto *abstract_bmp = static_cast<AbstractBMP *>(buffer_handle.GetDataMut());
                 optimize_index(*abstract_bmp);
 #endif
-                chunk_index_entry->SaveIndexFile();
+                if (save_index) {
+                    chunk_index_entry->SaveIndexFile();
+                }
 
                 set_fileworker_index_def(chunk_index_entry.get());
             }
@@ -789,7 +854,9 @@ void SegmentIndexEntry::OptIndex(SharedPtr<IndexBase> new_index_base,
                 optimize_index(memory_index_entry->get());
 #endif
 
-                dumped_memindex_entry = this->MemIndexDump(false /*spill*/);
+                if (save_index) {
+                    dumped_memindex_entry = this->MemIndexDump(false /*spill*/);
+                }
             }
             break;
         }
@@ -849,7 +916,9 @@ void SegmentIndexEntry::OptIndex(SharedPtr<IndexBase> new_index_base,
                 auto *abstract_hnsw = reinterpret_cast<AbstractHnsw *>(buffer_handle.GetDataMut());
                 optimize_index(abstract_hnsw);
 #endif
-                chunk_index_entry->SaveIndexFile();
+                if (save_index) {
+                    chunk_index_entry->SaveIndexFile();
+                }
 
                 set_fileworker_index_def(chunk_index_entry.get());
             }
@@ -865,7 +934,9 @@ void SegmentIndexEntry::OptIndex(SharedPtr<IndexBase> new_index_base,
 #else
                 optimize_index(memory_index_entry->get_ptr());
 #endif
-                dumped_memindex_entry = this->MemIndexDump(false /*spill*/);
+                if (save_index) {
+                    dumped_memindex_entry = this->MemIndexDump(false /*spill*/);
+                }
             }
             break;
         }
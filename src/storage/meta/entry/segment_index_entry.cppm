@@ -94,7 +94,12 @@ public:
 
     void CommitOptimize(ChunkIndexEntry *new_chunk, const Vector<ChunkIndexEntry *> &old_chunks, TxnTimeStamp commit_ts);
 
-    void OptIndex(SharedPtr<IndexBase> index_base, TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay);
+    // save_index is false on follower when the index is replicated, the optimized chunks and memory index are saved by leader
+    void OptIndex(SharedPtr<IndexBase> index_base,
+                  TxnTableStore *txn_table_store,
+                  const Vector<UniquePtr<InitParameter>> &opt_params,
+                  bool replay,
+                  bool save_index = true);
 
     bool Flush(TxnTimeStamp checkpoint_ts);
 
@@ -139,6 +144,10 @@ public:
 
     u32 MemIndexRowCount();
 
+    // Used by follower when the index is replicated. The chunks dumped by leader take the place of the memory index rows before
+    // chunk_end_rowid, the rows after it are inserted into a new memory index. Hnsw has no memory index on follower.
+    void MemIndexReplaceReplayWal(RowID chunk_end_rowid, TxnTimeStamp commit_ts);
+
     Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts);
 
     Status CreateIndexDo(atomic_u64 &create_index_idx);
@@ -544,7 +544,12 @@ void TableEntry::AddCompactNew(SharedPtr<SegmentEntry> segment_entry) {
     }
 }
 
-void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay) {
+void TableEntry::AppendData(TransactionID txn_id,
+                            void *txn_store,
+                            TxnTimeStamp commit_ts,
+                            BufferManager *buffer_mgr,
+                            bool is_replay,
+                            bool replicate_index) {
     SizeT row_count = 0;
 
     // Read-only no lock needed.
@@ -595,7 +600,7 @@ void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp
     // Needn't inserting into MemIndex since MemIndexRecover is responsible for recovering MemIndex
     if (!is_replay) {
         // Realtime index insertion.
-        MemIndexInsert(txn, append_state_ptr->append_ranges_);
+        MemIndexInsert(txn, append_state_ptr->append_ranges_, replicate_index);
     }
 
     this->row_count_ += row_count;
@@ -793,7 +798,7 @@ Status TableEntry::RollbackWrite(TxnTimeStamp commit_ts, const Vector<TxnSegment
     return Status::OK();
 }
 
-void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
+void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges, bool replicate_index) {
     Map<SegmentID, Vector<AppendRange>> seg_append_ranges;
     SizeT num_ranges = append_ranges.size();
     for (SizeT i = 0; i < num_ranges; i++) {
@@ -806,6 +811,10 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
         if (!status.ok())
             continue;
         const IndexBase *index_base = table_index_entry->index_base();
+        if (replicate_index && index_base->index_type_ == IndexType::kHnsw) {
+            // the graph is built by leader only, knn scan searches the rows past the replicated chunks by brute force
+            continue;
+        }
         switch (index_base->index_type_) {
             case IndexType::kHnsw:
             case IndexType::kFullText:
@@ -816,7 +825,7 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
                 for (auto &[seg_id, ranges] : seg_append_ranges) {
                     LOG_TRACE(
                         fmt::format("Table {}.{} index {} segment {} MemIndexInsert.", *GetDBName(), *table_name_, *index_base->index_name_, seg_id));
-                    MemIndexInsertInner(table_index_entry, txn, seg_id, ranges);
+                    MemIndexInsertInner(table_index_entry, txn, seg_id, ranges, replicate_index);
                 }
                 break;
             }
@@ -829,7 +838,11 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
     }
 }
 
-void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *txn, SegmentID seg_id, Vector<AppendRange> &append_ranges) {
+void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry,
+                                     Txn *txn,
+                                     SegmentID seg_id,
+                                     Vector<AppendRange> &append_ranges,
+                                     bool replicate_index) {
     const IndexBase *index_base = table_index_entry->index_base();
 
     SharedPtr<SegmentEntry> segment_entry = GetSegmentByID(seg_id, MAX_TIMESTAMP);
@@ -861,6 +874,9 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
         AppendRange &range = append_ranges[i];
         SharedPtr<BlockEntry> block_entry = block_entries[i];
         segment_index_entry->MemIndexInsert(block_entry, range.start_offset_, range.row_count_, txn->CommitTS(), txn->buffer_mgr(), txn->txn_store());
+        if (replicate_index) {
+            continue;
+        }
         if ((i == dump_idx && segment_index_entry->MemIndexRowCount() >= infinity::InfinityContext::instance().config()->MemIndexCapacity()) ||
             (i == num_ranges - 1 && segment_entry->Room() <= 0)) {
             SharedPtr<ChunkIndexEntry> chunk_index_entry = segment_index_entry->MemIndexDump();
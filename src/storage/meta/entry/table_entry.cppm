@@ -184,7 +184,14 @@ public:
 
     void AddCompactNew(SharedPtr<SegmentEntry> segment_entry);
 
-    void AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay = false);
+    // replicate_index is true when the index chunks are dumped by leader and loaded from the logs, the memory indexes are never dumped
+    // and no hnsw graph is built
+    void AppendData(TransactionID txn_id,
+                    void *txn_store,
+                    TxnTimeStamp commit_ts,
+                    BufferManager *buffer_mgr,
+                    bool is_replay = false,
+                    bool replicate_index = false);
 
     void RollbackAppend(TransactionID txn_id, TxnTimeStamp commit_ts, void *txn_store);
 
@@ -212,7 +219,7 @@ public:
     static SharedPtr<String> DetermineTableDir(const String &parent_dir, const String &table_name);
 
     // MemIndexInsert is non-blocking. Caller must ensure there's no RowID gap between each call.
-    void MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges);
+    void MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges, bool replicate_index = false);
 
     // User shall invoke this regularly to populate recently inserted rows into the fulltext index. Noop for other types of index.
     void MemIndexCommit();
@@ -364,7 +371,8 @@ private:
     mutable UniquePtr<CompactionAlg> compaction_alg_{};
 
 private:
-    void MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *txn, SegmentID seg_id, Vector<AppendRange> &append_ranges);
+    void
+    MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *txn, SegmentID seg_id, Vector<AppendRange> &append_ranges, bool replicate_index);
 
 public:
     bool CheckIfIndexColumn(ColumnID column_id, TransactionID txn_id, TxnTimeStamp begin_ts);
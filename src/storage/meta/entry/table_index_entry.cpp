@@ -531,7 +531,7 @@ void TableIndexEntry::UpdateEntryReplay(TransactionID txn_id, TxnTimeStamp begin
     txn_id_ = txn_id;
 }
 
-void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay) {
+void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay, bool save_index) {
     switch (index_base_->index_type_) {
         case IndexType::kBMP: {
             if (replay) {
@@ -573,7 +573,7 @@ void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<Uniq
             }
             if (params->lvq_avg) {
                 for (const auto &[segment_id, segment_index_entry] : index_by_segment_) {
-                    segment_index_entry->OptIndex(index_base_, txn_table_store, opt_params, false /*replay*/);
+                    segment_index_entry->OptIndex(index_base_, txn_table_store, opt_params, false /*replay*/, save_index);
                 }
             }
             break;
@@ -278,6 +278,7 @@ export struct DumpMemIndexTxnStore : public BaseTxnStore {
     u64 index_id_{};
     Vector<SegmentID> segment_ids_{};
     Map<SegmentID, Vector<WalChunkIndexInfo>> chunk_infos_in_segments_{};
+    Set<SegmentID> dumped_segment_ids_{}; // segments whose frozen mem index is dumped before commit
     String table_key_{};
 
     String ToString() const final;
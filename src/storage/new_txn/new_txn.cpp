@@ -60,6 +60,7 @@ import snapshot_info;
 import kv_store;
 import random;
 import kv_code;
+import kv_value;
 import constant_expr;
 import buffer_obj;
 import data_file_worker;
@@ -3614,7 +3615,7 @@ void NewTxn::CommitBottom() {
     }
 
     TxnTimeStamp commit_ts = this->CommitTS();
-    String commit_ts_str = std::to_string(commit_ts);
+    String commit_ts_str = KVValue::EncodeTimestamp(commit_ts);
     for (const String &meta_key : keys_wait_for_commit_) {
         kv_instance_->Put(meta_key, commit_ts_str);
     }
@@ -530,6 +530,8 @@ private:
 
     Status DumpSegmentMemIndex(SegmentIndexMeta &segment_index_meta, const ChunkID &new_chunk_id);
 
+    Status DumpFrozenMemIndex(SegmentIndexMeta &segment_index_meta, const ChunkID &new_chunk_id);
+
     Status CheckpointDB(DBMeeta &db_meta, const CheckpointOption &option, CheckpointTxnStore *ckp_txn_store);
 
     Status CheckpointTable(TableMeeta &table_meta, const CheckpointOption &option, CheckpointTxnStore *ckp_txn_store);
@@ -115,7 +115,11 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
         SegmentIndexMeta segment_index_meta(segment_id, *table_index_meta);
 
         SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
-        if (mem_index == nullptr || (mem_index->GetBaseMemIndex() == nullptr && mem_index->GetEMVBIndex() == nullptr)) {
+        if (mem_index == nullptr) {
+            continue;
+        }
+        bool frozen = mem_index->FreezeMemIndex();
+        if (!frozen && mem_index->GetBaseMemIndex() == nullptr && mem_index->GetEMVBIndex() == nullptr) {
             continue;
         }
 
@@ -132,7 +136,9 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
         }
 
         ChunkIndexMetaInfo chunk_index_meta_info;
-        if (mem_index->GetBaseMemIndex() != nullptr) {
+        if (frozen) {
+            chunk_index_meta_info = mem_index->GetDumpingBaseMemIndex()->GetChunkIndexMetaInfo();
+        } else if (mem_index->GetBaseMemIndex() != nullptr) {
             chunk_index_meta_info = mem_index->GetBaseMemIndex()->GetChunkIndexMetaInfo();
         } else if (mem_index->GetEMVBIndex() != nullptr) {
             chunk_index_meta_info = mem_index->GetEMVBIndex()->GetChunkIndexMetaInfo();
@@ -145,6 +151,14 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
         chunk_infos.emplace_back(chunk_index_meta);
 
         txn_store->chunk_infos_in_segments_.emplace(segment_id, chunk_infos);
+
+        if (frozen) {
+            status = this->DumpFrozenMemIndex(segment_index_meta, chunk_id);
+            if (!status.ok()) {
+                return status;
+            }
+            txn_store->dumped_segment_ids_.insert(segment_id);
+        }
     }
 
     return Status::OK();
@@ -167,7 +181,12 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
     SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
 
     // Return when there is no mem index to dump.
-    if (mem_index == nullptr || (mem_index->GetBaseMemIndex() == nullptr && mem_index->GetEMVBIndex() == nullptr)) {
+    if (mem_index == nullptr) {
+        return Status::OK();
+    }
+    // Swap the hnsw / full text mem index for a new one, so that it's dumped below without blocking the appends to the segment.
+    bool frozen = mem_index->FreezeMemIndex();
+    if (!frozen && mem_index->GetBaseMemIndex() == nullptr && mem_index->GetEMVBIndex() == nullptr) {
         return Status::OK();
     }
 
@@ -186,7 +205,9 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
 
     // Get chunk index info of the mem index and put it to chunk index meta.
     ChunkIndexMetaInfo chunk_index_meta_info;
-    if (mem_index->GetBaseMemIndex() != nullptr) {
+    if (frozen) {
+        chunk_index_meta_info = mem_index->GetDumpingBaseMemIndex()->GetChunkIndexMetaInfo();
+    } else if (mem_index->GetBaseMemIndex() != nullptr) {
         chunk_index_meta_info = mem_index->GetBaseMemIndex()->GetChunkIndexMetaInfo();
     } else if (mem_index->GetEMVBIndex() != nullptr) {
         chunk_index_meta_info = mem_index->GetEMVBIndex()->GetChunkIndexMetaInfo();
@@ -218,6 +239,15 @@ Status NewTxn::DumpMemIndex(const String &db_name, const String &table_name, con
         txn_store->chunk_infos_in_segments_.emplace(segment_id, chunk_infos);
     }
 
+    if (frozen) {
+        status = this->DumpFrozenMemIndex(segment_index_meta, chunk_id);
+        if (!status.ok()) {
+            return status;
+        }
+        DumpMemIndexTxnStore *txn_store = static_cast<DumpMemIndexTxnStore *>(base_txn_store_.get());
+        txn_store->dumped_segment_ids_.insert(segment_id);
+    }
+
     return Status::OK();
 }
 
@@ -239,18 +269,26 @@ Status NewTxn::CommitBottomDumpMemIndex(WalCmdDumpIndexV2 *dump_index_cmd) {
     status = GetTableIndexMeta(db_name, table_name, index_name, db_meta, table_meta, table_index_meta, &table_key, &index_key);
     SegmentIndexMeta segment_index_meta(segment_id, *table_index_meta);
 
-    // Dump Mem Index
-    status = this->DumpSegmentMemIndex(segment_index_meta, chunk_id);
-    if (!status.ok()) {
-        return status;
-    }
-
-    // Clean Mem Index
-    if (dump_index_cmd->clear_mem_index_) {
-        SegmentIndexMeta segment_index_meta(segment_id, *table_index_meta);
+    if (dump_index_txn_store->dumped_segment_ids_.contains(segment_id)) {
+        // The frozen mem index has been dumped before commit, it's replaced by the chunk index from now on.
         SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
         if (mem_index != nullptr) {
-            mem_index->ClearMemIndex();
+            mem_index->ClearDumpingMemIndex();
+        }
+    } else {
+        // Dump Mem Index
+        status = this->DumpSegmentMemIndex(segment_index_meta, chunk_id);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // Clean Mem Index
+        if (dump_index_cmd->clear_mem_index_) {
+            SegmentIndexMeta segment_index_meta(segment_id, *table_index_meta);
+            SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+            if (mem_index != nullptr) {
+                mem_index->ClearMemIndex();
+            }
         }
     }
 
@@ -814,7 +852,8 @@ NewTxn::AppendMemIndex(SegmentIndexMeta &segment_index_meta, BlockID block_id, c
                     txn_store()->AddSemaphore(std::move(sema));
                 } else {
                     // mem_index->memory_indexer_->Insert(col_ptr, offset, row_cnt, false);
-                    SharedPtr<AppendMemIndexTask> append_mem_index_task = MakeShared<AppendMemIndexTask>(mem_index, col_ptr, offset, row_cnt);
+                    SharedPtr<AppendMemIndexTask> append_mem_index_task =
+                        MakeShared<AppendMemIndexTask>(mem_index->memory_indexer_, col_ptr, offset, row_cnt);
                     mem_index->memory_indexer_->AsyncInsertTop(append_mem_index_task.get());
                     auto *mem_index_appender = InfinityContext::instance().storage()->mem_index_appender();
                     mem_index_appender->Submit(append_mem_index_task);
@@ -846,6 +885,8 @@ NewTxn::AppendMemIndex(SegmentIndexMeta &segment_index_meta, BlockID block_id, c
         }
         case IndexType::kHnsw: {
             SharedPtr<HnswIndexInMem> memory_hnsw_index;
+            // The insert below is out of mtx_, keep the mem index from being frozen for dump until it's done.
+            std::shared_lock<std::shared_mutex> append_lock(mem_index->append_mtx_);
             {
                 std::unique_lock<std::mutex> lock(mem_index->mtx_);
                 if (mem_index->memory_hnsw_index_.get() == nullptr) {
@@ -1740,6 +1781,57 @@ Status NewTxn::DumpSegmentMemIndex(SegmentIndexMeta &segment_index_meta, const C
     return Status::OK();
 }
 
+Status NewTxn::DumpFrozenMemIndex(SegmentIndexMeta &segment_index_meta, const ChunkID &new_chunk_id) {
+    SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+    SharedPtr<HnswIndexInMem> memory_hnsw_index = mem_index->GetDumpingHnswIndex();
+    SharedPtr<MemoryIndexer> memory_indexer = mem_index->GetDumpingFulltextIndex();
+    if (memory_hnsw_index == nullptr && memory_indexer == nullptr) {
+        UnrecoverableError("Invalid frozen mem index");
+    }
+    TableIndexMeeta &table_index_meta = segment_index_meta.table_index_meta();
+
+    // Nothing is appended to the frozen mem index any more, so the chunk index is written here rather than in commit bottom,
+    // which is shared with the appends of the table. The rows are searched from the frozen mem index until the commit.
+    ChunkIndexMetaInfo chunk_index_meta_info = mem_index->GetDumpingBaseMemIndex()->GetChunkIndexMetaInfo();
+    Optional<ChunkIndexMeta> chunk_index_meta;
+    BufferObj *buffer_obj = nullptr;
+    {
+        Status status = NewCatalog::AddNewChunkIndex1(segment_index_meta,
+                                                      this,
+                                                      new_chunk_id,
+                                                      chunk_index_meta_info.base_row_id_,
+                                                      chunk_index_meta_info.row_cnt_,
+                                                      chunk_index_meta_info.base_name_,
+                                                      chunk_index_meta_info.index_size_,
+                                                      chunk_index_meta);
+        if (!status.ok()) {
+            return status;
+        }
+
+        chunk_infos_.push_back(
+            {table_index_meta.table_meta().db_id_str(), table_index_meta.table_meta().table_id_str(), segment_index_meta.segment_id(), new_chunk_id});
+
+        status = chunk_index_meta->GetIndexBuffer(buffer_obj);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    if (memory_hnsw_index != nullptr) {
+        memory_hnsw_index->Dump(buffer_obj);
+        buffer_obj->Save();
+        if (buffer_obj->type() != BufferType::kMmap) {
+            buffer_obj->ToMmap();
+        }
+    } else {
+        memory_indexer->Dump(false /*offline*/, false /*spill*/);
+        Status status = segment_index_meta.UpdateFtInfo(memory_indexer->GetColumnLengthSum(), memory_indexer->GetDocCount());
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 Status NewTxn::CountMemIndexGapInSegment(SegmentIndexMeta &segment_index_meta, SegmentMeta &segment_meta, Vector<Pair<RowID, u64>> &append_ranges) {
     Status status;
     Vector<ChunkID> *chunk_ids_ptr = nullptr;
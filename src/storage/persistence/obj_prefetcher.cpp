@@ -0,0 +1,146 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <thread>
+
+module obj_prefetcher;
+
+import stl;
+import persistence_manager;
+import persist_result_handler;
+import virtual_store;
+import default_values;
+import logger;
+import third_party;
+
+namespace infinity {
+
+ObjPrefetcher::ObjPrefetcher(PersistenceManager *pm, SizeT worker_num) : pm_(pm), worker_num_(worker_num) {}
+
+ObjPrefetcher::~ObjPrefetcher() { Stop(); }
+
+void ObjPrefetcher::Start() {
+    {
+        std::unique_lock lock(mtx_);
+        running_ = true;
+    }
+    for (SizeT i = 0; i < worker_num_; ++i) {
+        workers_.emplace_back([this] { Process(); });
+    }
+    LOG_INFO(fmt::format("Object prefetcher is started with {} workers.", worker_num_));
+}
+
+void ObjPrefetcher::Stop() {
+    {
+        std::unique_lock lock(mtx_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        queue_.clear();
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    pending_.clear();
+    LOG_INFO(fmt::format("Object prefetcher is stopped, {} files prefetched.", prefetch_count_.load()));
+}
+
+void ObjPrefetcher::Prefetch(const Vector<String> &file_paths) {
+    if (!VirtualStore::IsInit()) {
+        return;
+    }
+    SizeT queued = 0;
+    {
+        std::unique_lock lock(mtx_);
+        if (!running_) {
+            return;
+        }
+        for (const String &file_path : file_paths) {
+            if (queue_.size() >= DEFAULT_OBJECT_STORAGE_PREFETCH_QUEUE_SIZE) {
+                break;
+            }
+            if (pending_.insert(file_path).second) {
+                queue_.push_back(file_path);
+                ++queued;
+            }
+        }
+    }
+    if (queued == 1) {
+        cv_.notify_one();
+    } else if (queued > 1) {
+        cv_.notify_all();
+    }
+}
+
+String ObjPrefetcher::RecordMiss(const String &file_path) {
+    String predicted;
+    {
+        std::unique_lock lock(history_mtx_);
+        String &last_miss = last_miss_[std::this_thread::get_id()];
+        if (!last_miss.empty() && last_miss != file_path) {
+            if (next_miss_.size() >= DEFAULT_OBJECT_STORAGE_PREFETCH_HISTORY_SIZE) {
+                next_miss_.clear();
+            }
+            next_miss_[last_miss] = file_path;
+        }
+        last_miss = file_path;
+        if (auto iter = next_miss_.find(file_path); iter != next_miss_.end()) {
+            predicted = iter->second;
+        }
+    }
+    if (!predicted.empty()) {
+        Prefetch({predicted});
+    }
+    return predicted;
+}
+
+void ObjPrefetcher::Process() {
+    while (true) {
+        String file_path;
+        {
+            std::unique_lock lock(mtx_);
+            cv_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+            if (!running_) {
+                break;
+            }
+            file_path = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        Fetch(file_path);
+        std::unique_lock lock(mtx_);
+        pending_.erase(file_path);
+    }
+}
+
+void ObjPrefetcher::Fetch(const String &file_path) {
+    // Same as the demand fetch of a FileWorker, the reference is released as soon as the part is in localdisk cache.
+    PersistResultHandler handler(pm_);
+    PersistReadResult result = pm_->GetObjCache(file_path);
+    if (!result.obj_addr_.Valid()) {
+        return;
+    }
+    if (result.obj_stat_ != nullptr) {
+        handler.HandleReadResult(result);
+        ++prefetch_count_;
+    }
+    PersistWriteResult write_result = pm_->PutObjCache(file_path);
+    handler.HandleWriteResult(write_result);
+}
+
+} // namespace infinity
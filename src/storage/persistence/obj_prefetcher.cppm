@@ -0,0 +1,75 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <thread>
+
+export module obj_prefetcher;
+
+import stl;
+import default_values;
+
+namespace infinity {
+
+class PersistenceManager;
+
+// Fetches files into the localdisk cache in background, so that the object store round trips of the files a query is
+// about to read overlap with each other instead of being serialized by the demand fetch of each BufferObj.
+// Prefetch is driven by the plan (the segments a KNN or match scan touches) and by the history of demand misses.
+export class ObjPrefetcher {
+public:
+    explicit ObjPrefetcher(PersistenceManager *pm, SizeT worker_num = DEFAULT_OBJECT_STORAGE_PREFETCH_WORKER_NUM);
+
+    ~ObjPrefetcher();
+
+    void Start();
+
+    void Stop();
+
+    // Queue file_paths to be fetched, the paths already queued are skipped. Paths are dropped when the queue is full.
+    void Prefetch(const Vector<String> &file_paths);
+
+    // Record a demand fetch of file_path which wasn't cached, and prefetch the file which missed after it last time.
+    // The successor is learned from the misses of the same thread, so concurrent queries do not mix their sequences.
+    // Returns the prefetched file, empty if none.
+    String RecordMiss(const String &file_path);
+
+    u64 prefetch_count() const { return prefetch_count_; }
+
+private:
+    void Process();
+
+    void Fetch(const String &file_path);
+
+private:
+    PersistenceManager *pm_{};
+    const SizeT worker_num_{};
+
+    std::mutex mtx_{};
+    std::condition_variable cv_{};
+    Deque<String> queue_{};
+    HashSet<String> pending_{}; // queued or being fetched
+    bool running_{false};
+    Vector<Thread> workers_{};
+
+    // first order successor of the demand misses
+    std::mutex history_mtx_{};
+    HashMap<std::thread::id, String> last_miss_{}; // the last demand miss of each reader thread
+    HashMap<String, String> next_miss_{};
+
+    Atomic<u64> prefetch_count_{};
+};
+
+} // namespace infinity
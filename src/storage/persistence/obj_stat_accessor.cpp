@@ -62,19 +62,47 @@ void ObjectStatAccessorBase::RemoveObjStatFromKVStore(const String &key) {
     }
 }
 
+DiskCachePinPolicy DiskCachePinPolicyFromString(const String &str) {
+    if (str == "none") {
+        return DiskCachePinPolicy::kNone;
+    }
+    if (str == "index") {
+        return DiskCachePinPolicy::kIndex;
+    }
+    if (str == "data") {
+        return DiskCachePinPolicy::kData;
+    }
+    UnrecoverableError(fmt::format("Invalid disk cache pin policy: {}", str));
+    return DiskCachePinPolicy::kIndex;
+}
+
 // ObjectStatMap
 
 ObjectStatMap::~ObjectStatMap() {
     [[maybe_unused]] SizeT sum_ref_count = 0;
-    for (const auto &lru_iter : lru_list_) {
-        if (lru_iter.obj_stat_.ref_count_ > 0) {
-            LOG_ERROR(fmt::format("ObjectStatMap {} still has ref count {}", lru_iter.key_, lru_iter.obj_stat_.ref_count_));
+    for (const LRUList *list : {&lru_list_, &pinned_lru_list_}) {
+        for (const auto &lru_iter : *list) {
+            if (lru_iter.obj_stat_.ref_count_ > 0) {
+                LOG_ERROR(fmt::format("ObjectStatMap {} still has ref count {}", lru_iter.key_, lru_iter.obj_stat_.ref_count_));
+            }
+            sum_ref_count += lru_iter.obj_stat_.ref_count_;
         }
-        sum_ref_count += lru_iter.obj_stat_.ref_count_;
     }
     assert(sum_ref_count == 0);
 }
 
+bool ObjectStatMap::Pinned(const ObjStat &obj_stat) const {
+    switch (pin_policy_) {
+        case DiskCachePinPolicy::kNone:
+            return false;
+        case DiskCachePinPolicy::kIndex:
+            return obj_stat.has_index_;
+        case DiskCachePinPolicy::kData:
+            return !obj_stat.has_index_;
+    }
+    return false;
+}
+
 ObjStat *ObjectStatMap::Get(const String &key) {
     auto map_iter = obj_map_.find(key);
     if (map_iter == obj_map_.end()) {
@@ -83,7 +111,7 @@ ObjStat *ObjectStatMap::Get(const String &key) {
     LRUListIter lru_iter = map_iter->second;
     ObjStat *obj_stat = &lru_iter->obj_stat_;
     if (obj_stat->ref_count_ == 0) {
-        using_list_.splice(using_list_.begin(), lru_list_, lru_iter);
+        using_list_.splice(using_list_.begin(), CachedList(*lru_iter), lru_iter);
     }
     ++obj_stat->ref_count_;
     return obj_stat;
@@ -111,7 +139,8 @@ Pair<bool, ObjStat *> ObjectStatMap::Release(const String &key) {
     if (obj_stat->ref_count_ > 0) {
         return {false, obj_stat};
     }
-    lru_list_.splice(lru_list_.begin(), using_list_, lru_iter);
+    LRUList &cached_list = CachedList(*lru_iter);
+    cached_list.splice(cached_list.begin(), using_list_, lru_iter);
     return {true, obj_stat};
 }
 
@@ -122,8 +151,10 @@ void ObjectStatMap::PutNew(const String &key, ObjStat obj_stat) {
         LOG_DEBUG(fmt::format("PutNew: {} is already in object map", key));
         return;
     }
-    lru_list_.emplace_front(key, std::move(obj_stat));
-    obj_map_.emplace(key, lru_list_.begin());
+    bool pinned = Pinned(obj_stat);
+    LRUList &cached_list = pinned ? pinned_lru_list_ : lru_list_;
+    cached_list.emplace_front(key, std::move(obj_stat), pinned);
+    obj_map_.emplace(key, cached_list.begin());
 }
 
 void ObjectStatMap::Recover(const String &key) {
@@ -136,7 +167,8 @@ void ObjectStatMap::Recover(const String &key) {
     if (obj_stat.ref_count_ > 0) {
         UnrecoverableError(fmt::format("Recover object {} ref count is {}", key, lru_iter->obj_stat_.ref_count_));
     }
-    lru_list_.splice(lru_list_.begin(), cleanuped_list_, lru_iter);
+    LRUList &cached_list = CachedList(*lru_iter);
+    cached_list.splice(cached_list.begin(), cleanuped_list_, lru_iter);
     auto expect = ObjCached::kNotCached;
     if (not obj_stat.cached_.compare_exchange_strong(expect, ObjCached::kCached)) {
         UnrecoverableError(fmt::format("Recover object {} not cleaned", key));
@@ -157,8 +189,8 @@ Optional<ObjStat> ObjectStatMap::Invalidate(const String &key) {
     if (cached == ObjCached::kDownloading) {
         UnrecoverableError(fmt::format("Invalidate object {} is downloading", key));
     }
-    if (cached == ObjCached::kCached) {
-        lru_list_.erase(lru_iter);
+    if (cached == ObjCached::kCached || cached == ObjCached::kPartial) {
+        CachedList(*lru_iter).erase(lru_iter);
     } else {
         cleanuped_list_.erase(lru_iter);
     }
@@ -167,19 +199,23 @@ Optional<ObjStat> ObjectStatMap::Invalidate(const String &key) {
 }
 
 LRUListEntry *ObjectStatMap::EnvictLast() {
-    if (lru_list_.empty()) {
+    LRUList &envict_list = lru_list_.empty() ? pinned_lru_list_ : lru_list_;
+    if (envict_list.empty()) {
         return nullptr;
     }
-    LRUListIter lru_iter = std::prev(lru_list_.end());
+    LRUListIter lru_iter = std::prev(envict_list.end());
     ObjStat &obj_stat = lru_iter->obj_stat_;
     if (obj_stat.ref_count_ > 0) {
         UnrecoverableError(fmt::format("EnvictLast object {} ref count is {}", lru_iter->key_, obj_stat.ref_count_));
     }
     auto expect = ObjCached::kCached;
     if (not obj_stat.cached_.compare_exchange_strong(expect, ObjCached::kNotCached)) {
-        UnrecoverableError(fmt::format("EnvictLast object {} is already cleaned", lru_iter->key_));
+        if (expect != ObjCached::kPartial || not obj_stat.cached_.compare_exchange_strong(expect, ObjCached::kNotCached)) {
+            UnrecoverableError(fmt::format("EnvictLast object {} is already cleaned", lru_iter->key_));
+        }
     }
-    cleanuped_list_.splice(cleanuped_list_.begin(), lru_list_, lru_iter);
+    obj_stat.ClearCachedRanges();
+    cleanuped_list_.splice(cleanuped_list_.begin(), envict_list, lru_iter);
     return &(*lru_iter);
 }
 
@@ -318,7 +354,8 @@ HashMap<String, ObjStat> ObjectStatAccessor_LocalStorage::GetAllObjects() const
 
 // ObjectStatAccessor_ObjectStorage
 
-ObjectStatAccessor_ObjectStorage::ObjectStatAccessor_ObjectStorage(SizeT disk_capacity_limit) : disk_capacity_limit_(disk_capacity_limit) {}
+ObjectStatAccessor_ObjectStorage::ObjectStatAccessor_ObjectStorage(SizeT disk_capacity_limit, DiskCachePinPolicy pin_policy)
+    : obj_map_(pin_policy), disk_capacity_limit_(disk_capacity_limit) {}
 
 ObjectStatAccessor_ObjectStorage::~ObjectStatAccessor_ObjectStorage() = default;
 
@@ -24,11 +24,22 @@ namespace infinity {
 
 class KVInstance;
 
+// Which cached objects are kept in the disk cache as long as there are other objects to envict
+export enum class DiskCachePinPolicy {
+    kNone,
+    kIndex, // objects containing index files
+    kData,  // objects containing only column data
+};
+
+// "none", "index" or "data", as disk_cache_pin_policy in the config
+export DiskCachePinPolicy DiskCachePinPolicyFromString(const String &str);
+
 struct LRUListEntry {
-    LRUListEntry(String key, ObjStat obj_stat) : key_(std::move(key)), obj_stat_(std::move(obj_stat)) {}
+    LRUListEntry(String key, ObjStat obj_stat, bool pinned) : key_(std::move(key)), obj_stat_(std::move(obj_stat)), pinned_(pinned) {}
 
     String key_{};
     ObjStat obj_stat_{};
+    bool pinned_{};
 };
 
 class ObjectStatMap {
@@ -37,6 +48,8 @@ class ObjectStatMap {
     using LRUMap = HashMap<String, LRUListIter>;
 
 public:
+    explicit ObjectStatMap(DiskCachePinPolicy pin_policy = DiskCachePinPolicy::kIndex) : pin_policy_(pin_policy) {}
+
     ~ObjectStatMap();
 
     // Get stat of object[key], if not in cache, return nullptr
@@ -64,13 +77,22 @@ public:
 
     // Envict old object
     // move the last object in lru_list to cleanuped_list. called when disk used over limit, return nullptr if lru_list is empty
+    // pinned objects are envicted only when there is no unpinned one
     LRUListEntry *EnvictLast();
 
     const LRUMap &obj_map() const { return obj_map_; }
 
 private:
+    bool Pinned(const ObjStat &obj_stat) const;
+
+    // the list of the cached objects of entry which is not in use
+    LRUList &CachedList(const LRUListEntry &entry) { return entry.pinned_ ? pinned_lru_list_ : lru_list_; }
+
+private:
+    const DiskCachePinPolicy pin_policy_{};
     LRUMap obj_map_{};
     LRUList lru_list_{};
+    LRUList pinned_lru_list_{};
     LRUList using_list_{};
     LRUList cleanuped_list_{};
 };
@@ -142,7 +164,7 @@ private:
 // envict and recover is encapsulated
 export class ObjectStatAccessor_ObjectStorage : public ObjectStatAccessorBase {
 public:
-    ObjectStatAccessor_ObjectStorage(SizeT disk_capacity_limit);
+    ObjectStatAccessor_ObjectStorage(SizeT disk_capacity_limit, DiskCachePinPolicy pin_policy = DiskCachePinPolicy::kIndex);
 
     ~ObjectStatAccessor_ObjectStorage() override;
 
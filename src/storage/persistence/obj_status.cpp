@@ -25,10 +25,43 @@ import third_party;
 
 namespace infinity {
 
+void ObjStat::AddCachedRange(Range range) {
+    std::lock_guard<std::mutex> lock(ranges_mtx_);
+    auto iter = cached_ranges_.upper_bound(range);
+    if (iter != cached_ranges_.begin()) {
+        auto prev_iter = std::prev(iter);
+        if (prev_iter->end_ >= range.start_) {
+            range.start_ = prev_iter->start_;
+            range.end_ = std::max(range.end_, prev_iter->end_);
+            cached_ranges_.erase(prev_iter);
+        }
+    }
+    while (iter != cached_ranges_.end() && iter->start_ <= range.end_) {
+        range.end_ = std::max(range.end_, iter->end_);
+        iter = cached_ranges_.erase(iter);
+    }
+    cached_ranges_.insert(range);
+}
+
+bool ObjStat::RangeCached(const Range &range) const {
+    std::lock_guard<std::mutex> lock(ranges_mtx_);
+    auto iter = cached_ranges_.upper_bound(range);
+    if (iter == cached_ranges_.begin()) {
+        return false;
+    }
+    return std::prev(iter)->Cover(range);
+}
+
+void ObjStat::ClearCachedRanges() {
+    std::lock_guard<std::mutex> lock(ranges_mtx_);
+    cached_ranges_.clear();
+}
+
 nlohmann::json ObjStat::Serialize() const {
     nlohmann::json obj;
     obj["obj_size"] = obj_size_;
     obj["parts"] = parts_;
+    obj["has_index"] = has_index_;
     obj["deleted_ranges"] = nlohmann::json::array();
     for (auto &range : deleted_ranges_) {
         nlohmann::json range_obj;
@@ -43,6 +76,9 @@ void ObjStat::Deserialize(const nlohmann::json &obj) {
     ref_count_ = 0;
     obj_size_ = obj["obj_size"];
     parts_ = obj["parts"];
+    if (obj.contains("has_index")) {
+        has_index_ = obj["has_index"];
+    }
     if (obj.contains("deleted_ranges")) {
         SizeT start = 0;
         SizeT end = 0;
@@ -62,6 +98,7 @@ String ObjStat::ToString() const {
     nlohmann::json obj;
     obj["obj_size"] = obj_size_;
     obj["parts"] = parts_;
+    obj["has_index"] = has_index_;
     obj["deleted_ranges"] = nlohmann::json::array();
     for (auto &range : deleted_ranges_) {
         nlohmann::json range_obj;
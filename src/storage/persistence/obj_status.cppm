@@ -36,6 +36,7 @@ export enum class ObjCached {
     kNotCached,
     kDownloading,
     kCached,
+    kPartial, // only cached_ranges_ of the object are in localdisk cache, the rest of the local file is a hole
 };
 
 export struct ObjStat {
@@ -43,8 +44,13 @@ export struct ObjStat {
     SizeT parts_{};     // an object attribute
     SizeT ref_count_{}; // the number of user (R and W) of some part of this object
     Set<Range> deleted_ranges_{};
+    bool has_index_{}; // some part of this object is an index file, used by the disk cache pin policy
 
     Atomic<ObjCached> cached_ = ObjCached::kCached; // whether the object is in localdisk cache
+    // disjoint and not adjacent, changed only by the reader that switches cached_ to kDownloading, under ranges_mtx_ so that the
+    // readers of a kPartial object can check theirs without waiting for the download slot
+    Set<Range> cached_ranges_{};
+    mutable std::mutex ranges_mtx_{};
 
     ObjStat() = default;
 
@@ -53,7 +59,7 @@ export struct ObjStat {
 
     ObjStat(const ObjStat &other)
         : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(other.deleted_ranges_),
-          cached_(other.cached_.load()) {}
+          has_index_(other.has_index_), cached_(other.cached_.load()), cached_ranges_(other.cached_ranges_) {}
 
     ObjStat &operator=(const ObjStat &other) {
         if (this != &other) {
@@ -61,14 +67,16 @@ export struct ObjStat {
             parts_ = other.parts_;
             ref_count_ = other.ref_count_;
             deleted_ranges_ = other.deleted_ranges_;
+            has_index_ = other.has_index_;
             cached_.store(other.cached_.load());
+            cached_ranges_ = other.cached_ranges_;
         }
         return *this;
     }
 
     ObjStat(ObjStat &&other)
         : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(std::move(other.deleted_ranges_)),
-          cached_(other.cached_.load()) {}
+          has_index_(other.has_index_), cached_(other.cached_.load()), cached_ranges_(std::move(other.cached_ranges_)) {}
 
     ObjStat &operator=(ObjStat &&other) {
         if (this != &other) {
@@ -76,11 +84,19 @@ export struct ObjStat {
             parts_ = other.parts_;
             ref_count_ = other.ref_count_;
             deleted_ranges_ = std::move(other.deleted_ranges_);
+            has_index_ = other.has_index_;
             cached_.store(other.cached_.load());
+            cached_ranges_ = std::move(other.cached_ranges_);
         }
         return *this;
     }
 
+    void AddCachedRange(Range range);
+
+    bool RangeCached(const Range &range) const;
+
+    void ClearCachedRanges();
+
     nlohmann::json Serialize() const;
 
     void Deserialize(const nlohmann::json &obj);
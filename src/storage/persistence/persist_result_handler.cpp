@@ -26,6 +26,7 @@ import peer_task;
 import logger;
 import admin_statement;
 import obj_status;
+import default_values;
 
 namespace infinity {
 
@@ -40,10 +41,12 @@ void PersistResultHandler::HandleWriteResult(const PersistWriteResult &result) {
     for (const String &drop_key : result.drop_keys_) {
         String drop_path = pm_->GetObjPath(drop_key);
         VirtualStore::DeleteFileBG(drop_path);
+        DropPartialMark(drop_key);
     }
     for (const String &drop_key : result.drop_from_remote_keys_) {
         String drop_path = pm_->GetObjPath(drop_key);
         VirtualStore::DeleteFileBG(drop_path);
+        DropPartialMark(drop_key);
         if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader or
             InfinityContext::instance().GetServerRole() == NodeRole::kStandalone) {
             VirtualStore::RemoveObject(drop_key);
@@ -51,28 +54,81 @@ void PersistResultHandler::HandleWriteResult(const PersistWriteResult &result) {
     }
 }
 
+void PersistResultHandler::DropPartialMark(const String &obj_key) {
+    String mark_path = pm_->GetObjPartialMarkPath(obj_key);
+    if (VirtualStore::Exists(mark_path)) {
+        VirtualStore::DeleteFileBG(mark_path);
+    }
+}
+
 ObjAddr PersistResultHandler::HandleReadResult(const PersistReadResult &result) {
     if (result.obj_stat_ != nullptr) {
-        ObjCached expect = ObjCached::kNotCached;
+        VirtualStore::AddRequestCount();
         Atomic<ObjCached> &cached = result.obj_stat_->cached_;
-        if (cached.compare_exchange_strong(expect, ObjCached::kDownloading)) {
-            VirtualStore::AddRequestCount();
-            String read_path = InfinityContext::instance().persistence_manager()->GetObjPath(result.obj_addr_.obj_key_);
+        while (true) {
+            ObjCached expect = cached.load();
+            if (expect == ObjCached::kCached) {
+                break;
+            }
+            if (expect == ObjCached::kPartial) {
+                // the part being read is fetched already, no need to take the download slot
+                const ObjAddr &obj_addr = result.obj_addr_;
+                if (result.obj_stat_->RangeCached(Range{.start_ = obj_addr.part_offset_, .end_ = obj_addr.part_offset_ + obj_addr.part_size_})) {
+                    break;
+                }
+            }
+            if (expect == ObjCached::kDownloading) {
+                LOG_TRACE(fmt::format("GetObjCache waiting downloading object {}", result.obj_addr_.obj_key_));
+                cached.wait(ObjCached::kDownloading);
+                LOG_TRACE(fmt::format("GetObjCache finish waiting object {}", result.obj_addr_.obj_key_));
+                continue;
+            }
+            if (cached.compare_exchange_strong(expect, ObjCached::kDownloading)) {
+                cached.store(DownloadObjCache(result.obj_addr_, *result.obj_stat_, expect == ObjCached::kNotCached));
+                cached.notify_all();
+                break;
+            }
+        }
+    }
+    return result.obj_addr_;
+}
+
+ObjCached PersistResultHandler::DownloadObjCache(const ObjAddr &obj_addr, ObjStat &obj_stat, bool reset) {
+    PersistenceManager *pm = InfinityContext::instance().persistence_manager();
+    String read_path = pm->GetObjPath(obj_addr.obj_key_);
+    String mark_path = pm->GetObjPartialMarkPath(obj_addr.obj_key_);
+    if (reset) {
+        obj_stat.ClearCachedRanges();
+        if (!VirtualStore::IsInit() || obj_addr.part_size_ * 4 >= obj_stat.obj_size_ ||
+            obj_stat.obj_size_ <= DEFAULT_OBJECT_STORAGE_TRANSFER_PART_SIZE) {
+            // most of the object is read, fetch all of it
             LOG_TRACE(fmt::format("GetObjCache download object {}.", read_path));
-            VirtualStore::DownloadObject(read_path, result.obj_addr_.obj_key_);
+            VirtualStore::DownloadObject(read_path, obj_addr.obj_key_, obj_stat.obj_size_);
+            if (VirtualStore::Exists(mark_path)) {
+                VirtualStore::DeleteFile(mark_path);
+            }
             LOG_TRACE(fmt::format("GetObjCache download object {} done.", read_path));
-            cached.store(ObjCached::kCached);
-            cached.notify_all();
             VirtualStore::AddCacheMissCount();
-        } else if (expect == ObjCached::kDownloading) {
-            LOG_TRACE(fmt::format("GetObjCache waiting downloading object {}", result.obj_addr_.obj_key_));
-            cached.wait(ObjCached::kDownloading);
-            LOG_TRACE(fmt::format("GetObjCache finish waiting object {}", result.obj_addr_.obj_key_));
-        } else {
-            VirtualStore::AddRequestCount();
+            return ObjCached::kCached;
         }
+        // Only the parts being read of a large packed object are fetched into a sparse local file.
+        VirtualStore::Truncate(mark_path, 0);
+        VirtualStore::Truncate(read_path, 0);
+        VirtualStore::Truncate(read_path, obj_stat.obj_size_);
     }
-    return result.obj_addr_;
+    Range range{.start_ = obj_addr.part_offset_, .end_ = obj_addr.part_offset_ + obj_addr.part_size_};
+    if (!obj_stat.RangeCached(range)) {
+        LOG_TRACE(fmt::format("GetObjCache download [{}, {}) of object {}.", range.start_, range.end_, read_path));
+        VirtualStore::DownloadObjectRange(read_path, obj_addr.obj_key_, range.start_, obj_addr.part_size_);
+        obj_stat.AddCachedRange(range);
+        VirtualStore::AddCacheMissCount();
+    }
+    if (obj_stat.RangeCached(Range{.start_ = 0, .end_ = obj_stat.obj_size_})) {
+        obj_stat.ClearCachedRanges();
+        VirtualStore::DeleteFile(mark_path);
+        return ObjCached::kCached;
+    }
+    return ObjCached::kPartial;
 }
 
 } // namespace infinity
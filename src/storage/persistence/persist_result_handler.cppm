@@ -18,6 +18,7 @@ export module persist_result_handler;
 
 import stl;
 import persistence_manager;
+import obj_status;
 import global_resource_usage;
 
 namespace infinity {
@@ -46,6 +47,12 @@ public:
 
     ObjAddr HandleReadResult(const PersistReadResult &result);
 
+private:
+    void DropPartialMark(const String &obj_key);
+
+    // Fetch the part of obj_addr into localdisk cache, the caller holds the object in kDownloading. Returns the state afterwards.
+    static ObjCached DownloadObjCache(const ObjAddr &obj_addr, ObjStat &obj_stat, bool reset);
+
 private:
     PersistenceManager *pm_;
 };
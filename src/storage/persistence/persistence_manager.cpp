@@ -71,12 +71,17 @@ ObjAddr ObjAddr::ReadBufAdv(const char *&buf) {
     return ret;
 }
 
-PersistenceManager::PersistenceManager(const String &workspace, const String &data_dir, SizeT object_size_limit, bool local_storage)
+PersistenceManager::PersistenceManager(const String &workspace,
+                                       const String &data_dir,
+                                       SizeT object_size_limit,
+                                       bool local_storage,
+                                       SizeT disk_cache_limit,
+                                       DiskCachePinPolicy pin_policy)
     : workspace_(workspace), local_data_dir_(data_dir), object_size_limit_(object_size_limit) {
     if (local_storage) {
         objects_ = MakeUnique<ObjectStatAccessor_LocalStorage>();
     } else {
-        UnrecoverableError("Remote storage is not supported yet.");
+        objects_ = MakeUnique<ObjectStatAccessor_ObjectStorage>(disk_cache_limit, pin_policy);
     }
     current_object_key_ = ObjCreate();
     current_object_size_ = 0;
@@ -159,7 +164,9 @@ PersistWriteResult PersistenceManager::Persist(const String &file_path, const St
         }
         ObjAddr obj_addr(obj_key, 0, src_size);
         std::lock_guard<std::mutex> lock(mtx_);
-        objects_->PutNew(obj_key, ObjStat(src_size, 1, 0), result.drop_keys_);
+        ObjStat obj_stat(src_size, 1, 0);
+        obj_stat.has_index_ = IsIndexPath(local_path);
+        objects_->PutNew(obj_key, std::move(obj_stat), result.drop_keys_);
         LOG_TRACE(fmt::format("Persist added dedicated object {}", obj_key));
 
         local_path_obj_[local_path] = obj_addr;
@@ -181,6 +188,7 @@ PersistWriteResult PersistenceManager::Persist(const String &file_path, const St
     current_object_size_ = (current_object_size_ + ObjAlignment - 1) & ~(ObjAlignment - 1);
     ObjAddr obj_addr(current_object_key_, current_object_size_, src_size);
     CurrentObjAppendNoLock(tmp_file_path, src_size);
+    current_object_has_index_ = current_object_has_index_ || IsIndexPath(local_path);
     fs::remove(tmp_file_path, ec);
     if (ec) {
         String error_message = fmt::format("Failed to remove {}", tmp_file_path);
@@ -244,12 +252,15 @@ void PersistenceManager::CurrentObjFinalizeNoLock(Vector<String> &persist_keys,
             outFile.close();
         }
 
-        objects_->PutNew(current_object_key_, ObjStat(current_object_size_, current_object_parts_, current_object_ref_count_), drop_keys);
+        ObjStat obj_stat(current_object_size_, current_object_parts_, current_object_ref_count_);
+        obj_stat.has_index_ = current_object_has_index_;
+        objects_->PutNew(current_object_key_, std::move(obj_stat), drop_keys);
         LOG_TRACE(fmt::format("CurrentObjFinalizeNoLock added composed object {}", current_object_key_));
         current_object_key_ = ObjCreate();
         current_object_size_ = 0;
         current_object_parts_ = 0;
         current_object_ref_count_ = 0;
+        current_object_has_index_ = false;
     } else {
         LOG_TRACE(fmt::format("CurrentObjFinalizeNoLock added empty object {}", current_object_key_));
     }
@@ -285,6 +296,10 @@ PersistReadResult PersistenceManager::GetObjCache(const String &file_path) {
             auto expect = ObjCached::kCached;
             obj_stat->cached_.compare_exchange_strong(expect, ObjCached::kNotCached);
             result.obj_stat_ = obj_stat;
+        } else if (ObjCached cached = obj_stat->cached_.load(); cached == ObjCached::kPartial || cached == ObjCached::kDownloading ||
+                                                                (cached == ObjCached::kNotCached && VirtualStore::Exists(GetObjPartialMarkPath(result.obj_addr_.obj_key_)))) {
+            // the part may not be downloaded yet
+            result.obj_stat_ = obj_stat;
         }
     } else {
         if (it->second.obj_key_ != current_object_key_) {
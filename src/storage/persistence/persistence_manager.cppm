@@ -20,13 +20,14 @@ import stl;
 import serialize;
 import third_party;
 import obj_status;
+import obj_stat_accessor;
 import status;
+import default_values;
 
 // A view means a logical plan
 namespace infinity {
 
 class KVInstance;
-class ObjectStatAccessorBase;
 
 export struct ObjAddr {
     String obj_key_{};
@@ -68,7 +69,14 @@ public:
     constexpr static SizeT ObjAlignment = 8;
 
     // TODO: build cache from existing files under workspace
-    PersistenceManager(const String &workspace, const String &data_dir, SizeT object_size_limit, bool local_storage = true);
+    // Unless local_storage, the objects cached on local disk are bounded by disk_cache_limit, and those not selected by
+    // pin_policy are envicted first.
+    PersistenceManager(const String &workspace,
+                       const String &data_dir,
+                       SizeT object_size_limit,
+                       bool local_storage = true,
+                       SizeT disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT,
+                       DiskCachePinPolicy pin_policy = DiskCachePinPolicy::kIndex);
 
     ~PersistenceManager();
 
@@ -97,6 +105,10 @@ public:
      * Utils
      */
     String GetObjPath(const String &obj_key) const { return std::filesystem::path(workspace_).append(obj_key).string(); }
+    // Exists while the local file of the object is sparse, so that a partial file left by a previous run isn't taken as cached.
+    String GetObjPartialMarkPath(const String &obj_key) const { return GetObjPath(obj_key) + ".partial"; }
+    // Index files are under the index directory "db_{}/tbl_{}/idx_{}" of the table
+    static bool IsIndexPath(const String &local_path) { return local_path.find("/idx_") != String::npos; }
     nlohmann::json Serialize();
 
     void Deserialize(const nlohmann::json &obj);
@@ -153,6 +165,7 @@ private:
     SizeT current_object_size_ = 0;
     SizeT current_object_parts_ = 0;
     SizeT current_object_ref_count_ = 0;
+    bool current_object_has_index_ = false;
 
     friend struct AddrSerializer;
 };
@@ -23,6 +23,7 @@ import column_def;
 import table_index_entry;
 import base_memindex;
 import memindex_tracer;
+import create_index_info;
 import chunk_index_meta;
 
 namespace infinity {
@@ -51,6 +52,8 @@ public:
 
     MemIndexTracerInfo GetInfo() const override;
 
+    IndexType GetIndexType() const override { return IndexType::kSecondary; }
+
     TableIndexEntry *table_index_entry() const override;
 
     const ChunkIndexMetaInfo GetChunkIndexMetaInfo() const override;
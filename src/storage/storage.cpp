@@ -53,6 +53,8 @@ import infinity_context;
 import memindex_tracer;
 import cleanup_scanner;
 import persistence_manager;
+import obj_prefetcher;
+import obj_stat_accessor;
 import extra_ddl_info;
 import virtual_store;
 import result_cache_manager;
@@ -117,6 +119,10 @@ Status Storage::InitToAdmin() {
                 }
 
                 if (object_storage_processor_ != nullptr) {
+                    if (obj_prefetcher_ != nullptr) {
+                        obj_prefetcher_->Stop();
+                        obj_prefetcher_.reset();
+                    }
                     object_storage_processor_->Stop();
                     object_storage_processor_.reset();
                 }
@@ -135,7 +141,18 @@ Status Storage::InitToAdmin() {
                 persistence_manager_.reset();
             }
             i64 persistence_object_size_limit = config_ptr_->PersistenceObjectSizeLimit();
-            persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir, config_ptr_->DataDir(), (SizeT)persistence_object_size_limit);
+            if (config_ptr_->StorageType() == StorageType::kMinio) {
+                persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir,
+                                                                      config_ptr_->DataDir(),
+                                                                      (SizeT)persistence_object_size_limit,
+                                                                      false,
+                                                                      (SizeT)config_ptr_->ObjectStorageDiskCacheLimit(),
+                                                                      DiskCachePinPolicyFromString(config_ptr_->ObjectStorageDiskCachePinPolicy()));
+                obj_prefetcher_ = MakeUnique<ObjPrefetcher>(persistence_manager_.get());
+                obj_prefetcher_->Start();
+            } else {
+                persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir, config_ptr_->DataDir(), (SizeT)persistence_object_size_limit);
+            }
         }
 
         current_storage_mode_ = StorageMode::kAdmin;
@@ -149,6 +166,10 @@ Status Storage::UnInitFromAdmin() {
     {
         std::unique_lock<std::mutex> lock(mutex_);
 
+        if (obj_prefetcher_ != nullptr) {
+            obj_prefetcher_->Stop();
+            obj_prefetcher_.reset();
+        }
         if (persistence_manager_ != nullptr) {
             persistence_manager_.reset();
         }
@@ -333,7 +354,7 @@ Status Storage::AdminToWriter() {
         UnrecoverableError("dump index processor was initialized before.");
     }
     dump_index_processor_ = MakeUnique<DumpIndexProcessor>();
-    dump_index_processor_->Start();
+    dump_index_processor_->Start(config_ptr_->MemIndexDumpWorker());
 
     if (mem_index_appender_ != nullptr) {
         UnrecoverableError("mem index appender was initialized before.");
@@ -442,6 +463,10 @@ Status Storage::UnInitFromReader() {
             }
             case StorageType::kMinio: {
                 if (object_storage_processor_ != nullptr) {
+                    if (obj_prefetcher_ != nullptr) {
+                        obj_prefetcher_->Stop();
+                        obj_prefetcher_.reset();
+                    }
                     object_storage_processor_->Stop();
                     object_storage_processor_.reset();
                     VirtualStore::UnInitRemoteStore();
@@ -505,7 +530,7 @@ Status Storage::ReaderToWriter() {
         UnrecoverableError("dump index processor was initialized before.");
     }
     dump_index_processor_ = MakeUnique<DumpIndexProcessor>();
-    dump_index_processor_->Start();
+    dump_index_processor_->Start(config_ptr_->MemIndexDumpWorker());
 
     if (mem_index_appender_ != nullptr) {
         UnrecoverableError("mem index appender was initialized before.");
@@ -674,6 +699,10 @@ Status Storage::UnInitFromWriter() {
         }
         case StorageType::kMinio: {
             if (object_storage_processor_ != nullptr) {
+                if (obj_prefetcher_ != nullptr) {
+                    obj_prefetcher_->Stop();
+                    obj_prefetcher_.reset();
+                }
                 object_storage_processor_->Stop();
                 object_storage_processor_.reset();
                 VirtualStore::UnInitRemoteStore();
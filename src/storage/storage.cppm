@@ -41,6 +41,7 @@ class ObjectStorageProcess;
 class Config;
 class BufferManager;
 class PersistenceManager;
+class ObjPrefetcher;
 
 export enum class ReaderInitPhase {
     kInvalid,
@@ -70,6 +71,8 @@ public:
 
     [[nodiscard]] inline PersistenceManager *persistence_manager() noexcept { return persistence_manager_.get(); }
 
+    [[nodiscard]] inline ObjPrefetcher *obj_prefetcher() noexcept { return obj_prefetcher_.get(); }
+
     [[nodiscard]] inline BGTaskProcessor *bg_processor() const noexcept { return bg_processor_.get(); }
 
     [[nodiscard]] inline ObjectStorageProcess *object_storage_processor() const noexcept { return object_storage_processor_.get(); }
@@ -126,6 +129,7 @@ private:
     UniquePtr<WalManager> wal_mgr_{};
     UniquePtr<ObjectStorageProcess> object_storage_processor_{};
     UniquePtr<PersistenceManager> persistence_manager_{};
+    UniquePtr<ObjPrefetcher> obj_prefetcher_{};
     UniquePtr<ResultCacheManager> result_cache_manager_{};
     UniquePtr<BufferManager> buffer_mgr_{};
     UniquePtr<Catalog> catalog_{};
@@ -18,6 +18,7 @@ export module base_memindex;
 
 import stl;
 import memindex_tracer;
+import create_index_info;
 
 namespace infinity {
 
@@ -30,6 +31,8 @@ public:
 
     virtual MemIndexTracerInfo GetInfo() const = 0;
 
+    virtual IndexType GetIndexType() const = 0;
+
     virtual TableIndexEntry *table_index_entry() const = 0;
 
     virtual const ChunkIndexMetaInfo GetChunkIndexMetaInfo() const = 0;
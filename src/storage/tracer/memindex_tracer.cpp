@@ -42,6 +42,8 @@ import mem_index;
 import new_txn;
 import status;
 import defer_op;
+import create_index_info;
+import config;
 
 namespace infinity {
 
@@ -62,6 +64,16 @@ bool MemIndexTracer::TryTriggerDump() {
     return true;
 }
 
+bool MemIndexTracer::TryTriggerQuotaDump() {
+    auto dump_task = MakeDumpTask(true /*over_quota_only*/);
+    if (!dump_task) {
+        return false;
+    }
+    LOG_TRACE(fmt::format("Quota dump triggered!"));
+    TriggerDump(std::move(dump_task));
+    return true;
+}
+
 void MemIndexTracer::DumpDone(SizeT actual_dump_size, BaseMemIndex *mem_index) {
     std::lock_guard lck(mtx_);
     auto iter = proposed_dump_.find(mem_index);
@@ -92,6 +104,15 @@ void MemIndexTracer::DumpFail(BaseMemIndex *mem_index) {
     proposed_dump_.erase(iter);
 }
 
+void MemIndexTracer::DumpFinished(BaseMemIndex *mem_index) {
+    std::lock_guard lck(mtx_);
+    // the dump tasks made out of the tracer are not proposed
+    if (auto iter = proposed_dump_.find(mem_index); iter != proposed_dump_.end()) {
+        acc_proposed_dump_.fetch_sub(iter->second);
+        proposed_dump_.erase(iter);
+    }
+}
+
 Vector<MemIndexTracerInfo> MemIndexTracer::GetMemIndexTracerInfo(Txn *txn) {
     Vector<BaseMemIndex *> mem_indexes = GetUndumpedMemIndexes(txn);
     Vector<MemIndexTracerInfo> info_vec;
@@ -114,9 +135,7 @@ Vector<BaseMemIndex *> MemIndexTracer::GetUndumpedMemIndexes(Txn *txn) {
     Vector<BaseMemIndex *> results;
     Vector<BaseMemIndex *> mem_indexes = GetAllMemIndexes(txn);
     for (auto *mem_index : mem_indexes) {
-        if (auto iter = proposed_dump_.find(mem_index); iter == proposed_dump_.end()) {
-            auto info = mem_index->GetInfo();
-            proposed_dump_.emplace(mem_index, info.mem_used_);
+        if (!proposed_dump_.contains(mem_index)) {
             results.push_back(mem_index);
         }
     }
@@ -127,16 +146,14 @@ Vector<BaseMemIndex *> MemIndexTracer::GetUndumpedMemIndexes(NewTxn *new_txn) {
     Vector<BaseMemIndex *> results;
     Vector<BaseMemIndex *> mem_indexes = GetAllMemIndexes(new_txn);
     for (auto *mem_index : mem_indexes) {
-        if (auto iter = proposed_dump_.find(mem_index); iter == proposed_dump_.end()) {
-            auto info = mem_index->GetInfo();
-            proposed_dump_.emplace(mem_index, info.mem_used_);
+        if (!proposed_dump_.contains(mem_index)) {
             results.push_back(mem_index);
         }
     }
     return results;
 }
 
-UniquePtr<DumpIndexTask> MemIndexTracer::MakeDumpTask() {
+UniquePtr<DumpIndexTask> MemIndexTracer::MakeDumpTask(bool over_quota_only) {
     std::lock_guard lck(mtx_);
 
     auto *new_txn_mgr = InfinityContext::instance().storage()->new_txn_manager();
@@ -157,13 +174,19 @@ UniquePtr<DumpIndexTask> MemIndexTracer::MakeDumpTask() {
     Vector<BaseMemIndex *> mem_indexes = GetUndumpedMemIndexes(new_txn_shared.get());
     Vector<EMVBIndexInMem *> emvb_indexes = GetEMVBMemIndexes(new_txn_shared.get());
     if (!mem_indexes.empty()) {
-        SizeT dump_idx = ChooseDump(mem_indexes);
+        SizeT victim_over_quota = 0;
+        SizeT dump_idx = ChooseDump(mem_indexes, &victim_over_quota);
+        if (over_quota_only && victim_over_quota == 0) {
+            return nullptr;
+        }
         BaseMemIndex *mem_index = mem_indexes[dump_idx];
         MemIndexTracerInfo info = mem_index->GetInfo();
         dump_task = MakeUnique<DumpIndexTask>(mem_index, new_txn_shared);
 
         acc_proposed_dump_.fetch_add(info.mem_used_);
         proposed_dump_[mem_index] = info.mem_used_;
+    } else if (over_quota_only) {
+        return nullptr;
     } else if (!emvb_indexes.empty()) {
         // FIXME: We do not calculate the memory used for each EMVB index,
         // so we choose the first EMVB index to dump.
@@ -178,20 +201,125 @@ UniquePtr<DumpIndexTask> MemIndexTracer::MakeDumpTask() {
     return dump_task;
 }
 
-SizeT MemIndexTracer::ChooseDump(const Vector<BaseMemIndex *> &mem_indexes) {
-    Vector<MemIndexTracerInfo> info_vec;
-    info_vec.reserve(mem_indexes.size());
-    for (auto *mem_index : mem_indexes) {
-        info_vec.push_back(mem_index->GetInfo());
+void MemIndexTracer::SetIndexTypeQuota(IndexType index_type, SizeT quota) {
+    std::lock_guard lck(mtx_);
+    index_type_quota_[static_cast<SizeT>(index_type)] = quota;
+    UpdateQuotaCheckStep();
+}
+
+void MemIndexTracer::SetTableQuota(const String &db_name, const String &table_name, SizeT quota) {
+    std::lock_guard lck(mtx_);
+    String table_key = fmt::format("{}.{}", db_name, table_name);
+    if (quota == 0) {
+        table_quota_.erase(table_key);
+    } else {
+        table_quota_[table_key] = quota;
     }
-    auto max_iter = std::max_element(info_vec.begin(), info_vec.end(), [](const auto &a, const auto &b) { return a.mem_used_ < b.mem_used_; });
-    return std::distance(info_vec.begin(), max_iter);
+    UpdateQuotaCheckStep();
+}
+
+void MemIndexTracer::SetDefaultTableQuota(SizeT quota) {
+    std::lock_guard lck(mtx_);
+    default_table_quota_ = quota;
+    UpdateQuotaCheckStep();
+}
+
+SizeT MemIndexTracer::TableQuota(const String &table_key) const {
+    if (auto iter = table_quota_.find(table_key); iter != table_quota_.end()) {
+        return iter->second;
+    }
+    return default_table_quota_;
+}
+
+void MemIndexTracer::UpdateQuotaCheckStep() {
+    SizeT min_quota = default_table_quota_;
+    auto update_min = [&](SizeT quota) {
+        if (quota != 0 && (min_quota == 0 || quota < min_quota)) {
+            min_quota = quota;
+        }
+    };
+    for (SizeT quota : index_type_quota_) {
+        update_min(quota);
+    }
+    for (const auto &[table_key, quota] : table_quota_) {
+        update_min(quota);
+    }
+    quota_check_step_.store(min_quota == 0 ? 0 : std::max(min_quota / kQuotaCheckFraction, SizeT(1)));
+}
+
+SizeT MemIndexTracer::ChooseDump(const Vector<BaseMemIndex *> &mem_indexes, SizeT *victim_over_quota) {
+    SizeT index_n = mem_indexes.size();
+    Vector<SizeT> mem_used(index_n);
+    Vector<SizeT> type_ids(index_n);
+    Vector<String> table_keys(index_n);
+    Array<SizeT, kIndexTypeCount> type_mem_used{};
+    HashMap<String, Pair<SizeT, SizeT>> table_mem_used; // table -> (memory used, growth since last choice)
+    HashMap<BaseMemIndex *, SizeT> last_mem_used;
+    for (SizeT i = 0; i < index_n; ++i) {
+        BaseMemIndex *mem_index = mem_indexes[i];
+        MemIndexTracerInfo info = mem_index->GetInfo();
+        mem_used[i] = info.mem_used_;
+        type_ids[i] = static_cast<SizeT>(mem_index->GetIndexType());
+        table_keys[i] = fmt::format("{}.{}", *info.db_name_, *info.table_name_);
+
+        SizeT growth = info.mem_used_;
+        if (auto iter = last_mem_used_.find(mem_index); iter != last_mem_used_.end()) {
+            growth = info.mem_used_ > iter->second ? info.mem_used_ - iter->second : 0;
+        }
+        last_mem_used.emplace(mem_index, info.mem_used_);
+
+        type_mem_used[type_ids[i]] += info.mem_used_;
+        auto &[table_used, table_growth] = table_mem_used[table_keys[i]];
+        table_used += info.mem_used_;
+        table_growth += growth;
+    }
+    // forget the dumped mem indexes
+    last_mem_used_ = std::move(last_mem_used);
+
+    // memory over the quota of the index type or the table of the mem index
+    auto over_quota = [&](SizeT i) -> SizeT {
+        SizeT type_over = 0;
+        if (SizeT quota = index_type_quota_[type_ids[i]]; quota != 0 && type_mem_used[type_ids[i]] > quota) {
+            type_over = type_mem_used[type_ids[i]] - quota;
+        }
+        SizeT table_over = 0;
+        if (SizeT quota = TableQuota(table_keys[i]); quota != 0 && table_mem_used[table_keys[i]].first > quota) {
+            table_over = table_mem_used[table_keys[i]].first - quota;
+        }
+        return std::max(type_over, table_over);
+    };
+    auto table_pressure = [&](SizeT i) {
+        const auto &[table_used, table_growth] = table_mem_used[table_keys[i]];
+        return table_used + table_growth;
+    };
+
+    SizeT choose = 0;
+    Tuple<SizeT, SizeT, SizeT> choose_key{};
+    for (SizeT i = 0; i < index_n; ++i) {
+        Tuple<SizeT, SizeT, SizeT> key{over_quota(i), table_pressure(i), mem_used[i]};
+        if (i == 0 || key > choose_key) {
+            choose = i;
+            choose_key = key;
+        }
+    }
+    if (victim_over_quota != nullptr) {
+        *victim_over_quota = std::get<0>(choose_key);
+    }
+    return choose;
 }
 
 BGMemIndexTracer::BGMemIndexTracer(SizeT index_memory_limit, NewTxnManager *txn_mgr) : MemIndexTracer(index_memory_limit), txn_mgr_(txn_mgr) {
 #ifdef INFINITY_DEBUG
     GlobalResourceUsage::IncrObjectCount("BGMemIndexTracer");
 #endif
+    if (Config *config = InfinityContext::instance().config(); config != nullptr) {
+        SizeT dense_quota = config->DenseMemIndexMemoryQuota();
+        SetIndexTypeQuota(IndexType::kHnsw, dense_quota);
+        SetIndexTypeQuota(IndexType::kIVF, dense_quota);
+        SetIndexTypeQuota(IndexType::kBMP, config->SparseMemIndexMemoryQuota());
+        SetIndexTypeQuota(IndexType::kFullText, config->FulltextMemIndexMemoryQuota());
+        SetDefaultTableQuota(config->TableMemIndexMemoryQuota());
+    }
 }
 
 BGMemIndexTracer::~BGMemIndexTracer() {
@@ -20,6 +20,7 @@ import stl;
 import third_party;
 import logger;
 import global_resource_usage;
+import create_index_info;
 
 namespace infinity {
 
@@ -58,11 +59,16 @@ public:
 private:
     bool TryTriggerDump();
 
+    bool TryTriggerQuotaDump();
+
 public:
     void DumpDone(SizeT actual_dump_size, BaseMemIndex *mem_index);
 
     void DumpFail(BaseMemIndex *mem_index);
 
+    // The dump of mem_index by the dump index processor is over, its memory is released with the mem index.
+    void DumpFinished(BaseMemIndex *mem_index);
+
     Vector<MemIndexTracerInfo> GetMemIndexTracerInfo(Txn *txn);
 
     Vector<MemIndexTracerInfo> GetMemIndexTracerInfo(NewTxn *txn);
@@ -75,6 +81,17 @@ public:
 
     SizeT cur_index_memory() const { return cur_index_memory_.load(); }
 
+    // Quotas of the mem indexes of an index type and of a table, 0 means no quota. Every 1 / kQuotaCheckFraction of the
+    // smallest quota of ingestion the mem indexes are checked against the quotas, and the victim of ChooseDump is dumped
+    // if its index type or table is over the quota, even if index_memory_limit_ isn't reached.
+    void SetIndexTypeQuota(IndexType index_type, SizeT quota);
+
+    // The quota of db_name.table_name instead of the default table quota, 0 removes it.
+    void SetTableQuota(const String &db_name, const String &table_name, SizeT quota);
+
+    // The quota of each table without a quota of its own.
+    void SetDefaultTableQuota(SizeT quota);
+
 protected:
     virtual NewTxn *GetTxn() = 0;
 
@@ -86,13 +103,34 @@ protected:
 
     using MemIndexMapIter = HashSet<BaseMemIndex *>::iterator;
 
-    UniquePtr<DumpIndexTask> MakeDumpTask();
+    // Only a victim over the quota of its index type or table is dumped if over_quota_only.
+    UniquePtr<DumpIndexTask> MakeDumpTask(bool over_quota_only = false);
+
+    // Pick the victim among the mem indexes: first the largest one of the index type or the table most over its quota,
+    // otherwise the largest one of the table with the highest memory plus growth since last choice.
+    // So a burst of ingestion on one table does not force dumping the mem indexes of other tables into tiny chunks.
+    // victim_over_quota is set to the memory over the quota of the index type or the table of the victim.
+    SizeT ChooseDump(const Vector<BaseMemIndex *> &mem_indexes, SizeT *victim_over_quota = nullptr);
 
-    static SizeT ChooseDump(const Vector<BaseMemIndex *> &mem_indexes);
+private:
+    SizeT TableQuota(const String &table_key) const;
+
+    void UpdateQuotaCheckStep();
 
 protected:
     std::mutex mtx_;
 
+    static constexpr SizeT kIndexTypeCount = static_cast<SizeT>(IndexType::kDiskAnn) + 1;
+    static constexpr SizeT kQuotaCheckFraction = 8;
+    Array<SizeT, kIndexTypeCount> index_type_quota_{};
+    HashMap<String, SizeT> table_quota_{};
+    SizeT default_table_quota_{};
+    // ingestion between two quota checks, 0 if there is no quota
+    Atomic<SizeT> quota_check_step_ = 0;
+    Atomic<SizeT> quota_check_acc_ = 0;
+    // memory used by each mem index at the last ChooseDump, to estimate the ingestion rate
+    HashMap<BaseMemIndex *, SizeT> last_mem_used_{};
+
     const SizeT index_memory_limit_;
     Atomic<SizeT> cur_index_memory_ = 0;
 
@@ -102,7 +140,14 @@ protected:
 
 inline void MemIndexTracer::IncreaseMemoryUsage(SizeT add) {
     // LOG_TRACE(fmt::format("Add mem used: {}, mem index limit: {}", add, index_memory_limit_));
-    if (add == 0 || index_memory_limit_ == 0) {
+    if (add == 0) {
+        return;
+    }
+    // only the thread which takes the accumulated ingestion checks the quotas
+    if (SizeT step = quota_check_step_.load(); step != 0 && quota_check_acc_.fetch_add(add) + add >= step && quota_check_acc_.exchange(0) >= step) {
+        TryTriggerQuotaDump();
+    }
+    if (index_memory_limit_ == 0) {
         return;
     }
     SizeT old_index_memory = cur_index_memory_.fetch_add(add);
@@ -393,7 +393,11 @@ void WalManager::NewFlush() {
         }
 
         if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
-            cluster_manager->SyncLogs();
+            Status status = cluster_manager->SyncLogs();
+            if (!status.ok()) {
+                // The failed followers are disconnected, they sync the logs of the batch on registration
+                LOG_ERROR(fmt::format("The log batch isn't replicated to a quorum of followers: {}", status.message()));
+            }
         }
 
         // Commit bottom
@@ -848,7 +852,7 @@ Vector<SharedPtr<WalEntry>> WalManager::CollectWalEntries() const {
 }
 
 void WalManager::ReplayWalEntry(const WalEntry &entry, ReplayWalOptions options) {
-    auto [on_startup, is_replay, sync_from_leader] = options;
+    auto [on_startup, is_replay, sync_from_leader, replicate_index] = options;
     for (const auto &cmd : entry.cmds_) {
         LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
         switch (cmd->GetType()) {
@@ -886,7 +890,7 @@ void WalManager::ReplayWalEntry(const WalEntry &entry, ReplayWalOptions options)
                 break;
             }
             case WalCommandType::APPEND: {
-                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_, is_replay);
+                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_, is_replay, replicate_index);
                 break;
             }
             case WalCommandType::DELETE: {
@@ -917,11 +921,11 @@ void WalManager::ReplayWalEntry(const WalEntry &entry, ReplayWalOptions options)
             }
             case WalCommandType::OPTIMIZE: {
                 auto *optimize_cmd = const_cast<WalCmdOptimize *>(static_cast<const WalCmdOptimize *>(cmd.get()));
-                WalCmdOptimizeReplay(*optimize_cmd, entry.txn_id_, entry.commit_ts_);
+                WalCmdOptimizeReplay(*optimize_cmd, entry.txn_id_, entry.commit_ts_, replicate_index);
                 break;
             }
             case WalCommandType::DUMP_INDEX: {
-                WalCmdDumpIndexReplay(*static_cast<WalCmdDumpIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
+                WalCmdDumpIndexReplay(*static_cast<WalCmdDumpIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_, replicate_index);
                 break;
             }
             case WalCommandType::RENAME_TABLE: {
@@ -1179,7 +1183,7 @@ void WalManager::WalCmdCompactReplay(const WalCmdCompact &cmd, TransactionID txn
     }
 }
 
-void WalManager::WalCmdOptimizeReplay(WalCmdOptimize &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+void WalManager::WalCmdOptimizeReplay(WalCmdOptimize &cmd, TransactionID txn_id, TxnTimeStamp commit_ts, bool replicate_index) {
     auto [table_index_entry, status] = storage_->catalog()->GetIndexByName(cmd.db_name_, cmd.table_name_, cmd.index_name_, txn_id, commit_ts);
     if (!status.ok()) {
         String error_message = fmt::format("Wal Replay: Get index failed {}", status.message());
@@ -1189,10 +1193,11 @@ void WalManager::WalCmdOptimizeReplay(WalCmdOptimize &cmd, TransactionID txn_id,
 
     TableEntry *table_entry = table_index_entry->table_index_meta()->table_entry();
     auto *txn_store = fake_txn->GetTxnTableStore(table_entry);
-    table_index_entry->OptIndex(txn_store, std::move(cmd.params_), true /*replay*/);
+    // The chunk files optimized by leader aren't saved again when the index is replicated
+    table_index_entry->OptIndex(txn_store, std::move(cmd.params_), true /*replay*/, !replicate_index /*save_index*/);
 }
 
-void WalManager::WalCmdDumpIndexReplay(WalCmdDumpIndex &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+void WalManager::WalCmdDumpIndexReplay(WalCmdDumpIndex &cmd, TransactionID txn_id, TxnTimeStamp commit_ts, bool replicate_index) {
     LOG_INFO(fmt::format("Replaying dump index: {}", cmd.ToString()));
     auto [table_index_entry, status] = storage_->catalog()->GetIndexByName(cmd.db_name_, cmd.table_name_, cmd.index_name_, txn_id, commit_ts);
     auto *table_entry = table_index_entry->table_index_meta()->GetTableEntry();
@@ -1243,6 +1248,14 @@ void WalManager::WalCmdDumpIndexReplay(WalCmdDumpIndex &cmd, TransactionID txn_i
             LOG_WARN(fmt::format("WalCmdDumpIndexReplay: cannot find chunk id: {} in segment: {}", old_chunk_id, cmd.segment_id_));
         }
     }
+    if (replicate_index && !cmd.chunk_infos_.empty()) {
+        // The rows inserted into the memory index by APPEND are in the chunks dumped by leader now
+        RowID chunk_end_rowid = cmd.chunk_infos_[0].base_rowid_ + cmd.chunk_infos_[0].row_count_;
+        for (const auto &chunk_info : cmd.chunk_infos_) {
+            chunk_end_rowid = std::max(chunk_end_rowid, chunk_info.base_rowid_ + chunk_info.row_count_);
+        }
+        segment_index_entry->MemIndexReplaceReplayWal(chunk_end_rowid, commit_ts);
+    }
 }
 
 void WalManager::WalCmdRenameTableReplay(WalCmdRenameTable &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
@@ -1307,7 +1320,7 @@ void WalManager::WalCmdDropColumnsReplay(WalCmdDropColumns &cmd, TransactionID t
         commit_ts);
 }
 
-void WalManager::WalCmdAppendReplay(const WalCmdAppend &cmd, TransactionID txn_id, TxnTimeStamp commit_ts, bool is_replay) {
+void WalManager::WalCmdAppendReplay(const WalCmdAppend &cmd, TransactionID txn_id, TxnTimeStamp commit_ts, bool is_replay, bool replicate_index) {
     auto [table_entry, table_status] = storage_->catalog()->GetTableByName(cmd.db_name_, cmd.table_name_, txn_id, commit_ts);
     if (!table_status.ok()) {
         String error_message = fmt::format("Wal Replay: Get table failed {}", table_status.message());
@@ -1321,7 +1334,8 @@ void WalManager::WalCmdAppendReplay(const WalCmdAppend &cmd, TransactionID txn_i
     auto append_state = MakeUnique<AppendState>(table_store->GetBlocks());
     table_store->SetAppendState(std::move(append_state));
 
-    Catalog::Append(table_store->GetTableEntry(), fake_txn->TxnID(), table_store, commit_ts, storage_->buffer_manager(), is_replay);
+    // The memory indexes are dumped by leader when the index is replicated
+    Catalog::Append(table_store->GetTableEntry(), fake_txn->TxnID(), table_store, commit_ts, storage_->buffer_manager(), is_replay, replicate_index);
     Catalog::CommitWrite(table_store->GetTableEntry(), fake_txn->TxnID(), commit_ts, table_store->txn_segments(), nullptr);
 }
 
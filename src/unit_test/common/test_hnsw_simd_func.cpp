@@ -0,0 +1,193 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import simd_init;
+import hnsw_simd_func;
+
+using namespace infinity;
+
+// Check the int8 / uint8 / 4-bit kernels of every instruction set the host supports against the BF reference.
+// The dims cover the tails of each register width.
+class HnswSimdFuncTest : public BaseTest {
+protected:
+    static constexpr SizeT kDims[] = {1, 2, 3, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200, 255, 256, 257, 768, 1023};
+    static constexpr SizeT kRound = 8;
+
+    template <typename T>
+    static Vector<T> RandomCodes(SizeT n, std::mt19937 &gen) {
+        std::uniform_int_distribution<i32> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        Vector<T> codes(n);
+        for (auto &code : codes) {
+            code = dist(gen);
+        }
+        return codes;
+    }
+
+    // Random codes, and the extreme ones which overflow a narrow accumulator
+    template <typename T>
+    static Vector<Pair<Vector<T>, Vector<T>>> TestCases(SizeT n, std::mt19937 &gen) {
+        Vector<Pair<Vector<T>, Vector<T>>> cases;
+        for (SizeT i = 0; i < kRound; ++i) {
+            cases.emplace_back(RandomCodes<T>(n, gen), RandomCodes<T>(n, gen));
+        }
+        const Vector<T> min_codes(n, std::numeric_limits<T>::min());
+        const Vector<T> max_codes(n, std::numeric_limits<T>::max());
+        cases.emplace_back(min_codes, max_codes);
+        cases.emplace_back(min_codes, min_codes);
+        cases.emplace_back(max_codes, max_codes);
+        return cases;
+    }
+
+    template <typename T>
+    static void CheckKernel(const char *name, i32 (*func)(const T *, const T *, SizeT), i32 (*ref_func)(const T *, const T *, SizeT)) {
+        std::mt19937 gen(0);
+        for (SizeT dim : kDims) {
+            for (const auto &[v1, v2] : TestCases<T>(dim, gen)) {
+                EXPECT_EQ(func(v1.data(), v2.data(), dim), ref_func(v1.data(), v2.data(), dim)) << name << " dim: " << dim;
+            }
+        }
+    }
+
+    // 4-bit codes of dim dimensions, the padding nibble of an odd dim is 0
+    static void CheckU4Kernel(const char *name, i32 (*func)(const u8 *, const u8 *, SizeT)) {
+        std::mt19937 gen(0);
+        for (SizeT dim : kDims) {
+            const SizeT bytes = (dim + 1) / 2;
+            for (auto [v1, v2] : TestCases<u8>(bytes, gen)) {
+                if (dim % 2 == 1) {
+                    v1.back() &= 0xF;
+                    v2.back() &= 0xF;
+                }
+                EXPECT_EQ(func(v1.data(), v2.data(), dim), U4IPBF(v1.data(), v2.data(), dim)) << name << " dim: " << dim;
+            }
+        }
+    }
+};
+
+TEST_F(HnswSimdFuncTest, I8IP) {
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        CheckKernel<i8>("I8IPSSEResidual", &I8IPSSEResidual, &I8IPBF);
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        CheckKernel<i8>("I8IPAVXResidual", &I8IPAVXResidual, &I8IPBF);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        CheckKernel<i8>("I8IPAVXVNNIResidual", &I8IPAVXVNNIResidual, &I8IPBF);
+    }
+#endif
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        CheckKernel<i8>("I8IPAVX512Residual", &I8IPAVX512Residual, &I8IPBF);
+    }
+#endif
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        CheckKernel<i8>("I8IPAVX512VNNIResidual", &I8IPAVX512VNNIResidual, &I8IPBF);
+    }
+#endif
+}
+
+TEST_F(HnswSimdFuncTest, I8L2) {
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        CheckKernel<i8>("I8L2SSE2Residual", &I8L2SSE2Residual, &I8L2BF);
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        CheckKernel<i8>("I8L2AVX2Residual", &I8L2AVX2Residual, &I8L2BF);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        CheckKernel<i8>("I8L2AVXVNNIResidual", &I8L2AVXVNNIResidual, &I8L2BF);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        CheckKernel<i8>("I8L2AVX512BWResidual", &I8L2AVX512BWResidual, &I8L2BF);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        CheckKernel<i8>("I8L2AVX512VNNIResidual", &I8L2AVX512VNNIResidual, &I8L2BF);
+    }
+#endif
+}
+
+TEST_F(HnswSimdFuncTest, U8L2) {
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        CheckKernel<u8>("U8L2SSE2Residual", &U8L2SSE2Residual, &U8L2BF);
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        CheckKernel<u8>("U8L2AVX2Residual", &U8L2AVX2Residual, &U8L2BF);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        CheckKernel<u8>("U8L2AVXVNNIResidual", &U8L2AVXVNNIResidual, &U8L2BF);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        CheckKernel<u8>("U8L2AVX512BWResidual", &U8L2AVX512BWResidual, &U8L2BF);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        CheckKernel<u8>("U8L2AVX512VNNIResidual", &U8L2AVX512VNNIResidual, &U8L2BF);
+    }
+#endif
+}
+
+TEST_F(HnswSimdFuncTest, U4IP) {
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        CheckU4Kernel("U4IPSSE2", &U4IPSSE2);
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        CheckU4Kernel("U4IPAVX2", &U4IPAVX2);
+    }
+#endif
+#if defined(__AVXVNNI__)
+    if (IsAVXVNNISupported()) {
+        CheckU4Kernel("U4IPAVXVNNI", &U4IPAVXVNNI);
+    }
+#endif
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        CheckU4Kernel("U4IPAVX512BW", &U4IPAVX512BW);
+    }
+#endif
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+    if (IsAVX512BWSupported() && IsAVX512VNNISupported()) {
+        CheckU4Kernel("U4IPAVX512VNNI", &U4IPAVX512VNNI);
+    }
+#endif
+}
@@ -0,0 +1,62 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import parallel_for;
+import infinity_exception;
+import status;
+
+using namespace infinity;
+class ParallelForTest : public BaseTest {};
+
+TEST_F(ParallelForTest, cover_all_ranges) {
+    ThreadPool thread_pool(4);
+    for (SizeT n : {0, 1, 7, 100, 1001}) {
+        for (SizeT task_num : {0, 1, 3, 8, 2000}) {
+            Vector<Atomic<u32>> visit_cnt(n);
+            ParallelFor(thread_pool, n, task_num, [&](SizeT begin, SizeT end) {
+                EXPECT_LE(begin, end);
+                for (SizeT i = begin; i < end; ++i) {
+                    ++visit_cnt[i];
+                }
+            });
+            for (SizeT i = 0; i < n; ++i) {
+                EXPECT_EQ(visit_cnt[i].load(), 1u);
+            }
+        }
+    }
+}
+
+TEST_F(ParallelForTest, rethrow_exception) {
+    ThreadPool thread_pool(4);
+    // the exception thrown by a pool thread and by the caller thread
+    for (SizeT throw_begin : {0, 50}) {
+        Atomic<u32> done_cnt{0};
+        EXPECT_THROW(ParallelFor(thread_pool,
+                                 100,
+                                 4,
+                                 [&](SizeT begin, SizeT end) {
+                                     if (begin == throw_begin) {
+                                         RecoverableError(Status::UnexpectedError("parallel for error"));
+                                     }
+                                     ++done_cnt;
+                                 }),
+                     RecoverableException);
+        // the other ranges are done before ParallelFor returns
+        EXPECT_EQ(done_cnt.load(), 3u);
+    }
+}
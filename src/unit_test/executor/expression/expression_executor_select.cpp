@@ -34,6 +34,24 @@ import selection;
 import logical_type;
 import internal_types;
 import data_type;
+import new_catalog;
+import function_set;
+import scalar_function_set;
+import scalar_function;
+import base_expression;
+import value_expression;
+import reference_expression;
+import function_expression;
+import expression_state;
+import expression_selector;
+import less;
+import greater;
+import greater_equals;
+import and_func;
+import or_func;
+import config;
+import status;
+import kv_store;
 
 using namespace infinity;
 class ExpressionExecutorSelectTest : public BaseTest {};
@@ -137,3 +155,76 @@ TEST_F(ExpressionExecutorSelectTest, test3) {
     EXPECT_EQ(output_true_select->Size(), 0u);
     EXPECT_THROW((*output_true_select)[0], UnrecoverableException);
 }
+
+namespace {
+
+SharedPtr<BaseExpression> MakeFunction(NewCatalog *catalog, const String &name, SharedPtr<BaseExpression> left, SharedPtr<BaseExpression> right) {
+    Vector<SharedPtr<BaseExpression>> arguments{std::move(left), std::move(right)};
+    SharedPtr<FunctionSet> function_set = NewCatalog::GetFunctionSetByName(catalog, name);
+    auto scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+    ScalarFunction function = scalar_function_set->GetMostMatchFunction(arguments);
+    return MakeShared<FunctionExpression>(function, arguments);
+}
+
+SharedPtr<BaseExpression> MakeCompare(NewCatalog *catalog, const String &name, BigIntT value) {
+    return MakeFunction(catalog,
+                        name,
+                        ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0),
+                        MakeShared<ValueExpression>(Value::MakeBigInt(value)));
+}
+
+} // namespace
+
+TEST_F(ExpressionExecutorSelectTest, conjunction) {
+    using namespace infinity;
+    UniquePtr<Config> config_ptr = MakeUnique<Config>();
+    Status status = config_ptr->Init(nullptr, nullptr);
+    EXPECT_TRUE(status.ok());
+    UniquePtr<KVStore> kv_store_ptr = MakeUnique<KVStore>();
+    status = kv_store_ptr->Init(config_ptr->CatalogDir());
+    EXPECT_TRUE(status.ok());
+    UniquePtr<NewCatalog> catalog_ptr = MakeUnique<NewCatalog>(kv_store_ptr.get());
+    NewCatalog *catalog = catalog_ptr.get();
+    RegisterLessFunction(catalog);
+    RegisterGreaterFunction(catalog);
+    RegisterGreaterEqualsFunction(catalog);
+    RegisterAndFunction(catalog);
+    RegisterOrFunction(catalog);
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SharedPtr<ColumnVector> column_ptr = MakeShared<ColumnVector>(data_type);
+    column_ptr->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        column_ptr->AppendValue(Value::MakeBigInt(static_cast<BigIntT>(i)));
+    }
+    DataBlock input_block;
+    input_block.Init({column_ptr});
+
+    // c1 >= 0 AND (c1 < 10 OR c1 > 8180) AND c1 > 2
+    SharedPtr<BaseExpression> or_expr = MakeFunction(catalog, "OR", MakeCompare(catalog, "<", 10), MakeCompare(catalog, ">", 8180));
+    SharedPtr<BaseExpression> and_expr =
+        MakeFunction(catalog, "AND", MakeFunction(catalog, "AND", MakeCompare(catalog, ">=", 0), or_expr), MakeCompare(catalog, ">", 2));
+    Vector<SizeT> expected_rows;
+    for (SizeT i = 3; i < 10; ++i) {
+        expected_rows.push_back(i);
+    }
+    for (SizeT i = 8181; i < row_count; ++i) {
+        expected_rows.push_back(i);
+    }
+
+    ExpressionSelector selector;
+    for (SizeT round = 0; round < 3; ++round) {
+        SharedPtr<ExpressionState> state = ExpressionState::CreateState(and_expr);
+        DataBlock output_block;
+        SizeT selected_count = selector.Select(and_expr, state, &input_block, &output_block, input_block.row_count());
+        ASSERT_EQ(selected_count, expected_rows.size());
+        for (SizeT i = 0; i < selected_count; ++i) {
+            EXPECT_EQ(output_block.SelectedColumn(0)->GetValue(i), Value::MakeBigInt(expected_rows[i]));
+        }
+    }
+
+    // c1 >= 0 passes every row, the selective terms are evaluated first
+    Vector<SizeT> order = selector.TermOrder(and_expr.get(), true, 3);
+    EXPECT_EQ(order.back(), 0u);
+}
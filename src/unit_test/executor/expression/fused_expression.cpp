@@ -0,0 +1,173 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import infinity_exception;
+
+import third_party;
+
+import logger;
+import stl;
+import new_catalog;
+import add;
+import multiply;
+import divide;
+import greater;
+import function_set;
+import scalar_function_set;
+import scalar_function;
+import base_expression;
+import value_expression;
+import reference_expression;
+import function_expression;
+import cast_expression;
+import column_vector;
+import expression_state;
+import expression_evaluator;
+import fused_expression;
+import value;
+import data_block;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+import config;
+import status;
+import kv_store;
+
+using namespace infinity;
+class FusedExpressionTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        config_ptr_ = MakeUnique<Config>();
+        Status status = config_ptr_->Init(nullptr, nullptr);
+        EXPECT_TRUE(status.ok());
+        kv_store_ptr_ = MakeUnique<KVStore>();
+        status = kv_store_ptr_->Init(config_ptr_->CatalogDir());
+        EXPECT_TRUE(status.ok());
+        catalog_ptr_ = MakeUnique<NewCatalog>(kv_store_ptr_.get());
+        RegisterAddFunction(catalog_ptr_.get());
+        RegisterMulFunction(catalog_ptr_.get());
+        RegisterDivFunction(catalog_ptr_.get());
+        RegisterGreaterFunction(catalog_ptr_.get());
+    }
+
+    void TearDown() override {
+        catalog_ptr_.reset();
+        kv_store_ptr_.reset();
+        config_ptr_.reset();
+        BaseTest::TearDown();
+    }
+
+    SharedPtr<BaseExpression> MakeFunction(const String &name, SharedPtr<BaseExpression> left, SharedPtr<BaseExpression> right) {
+        Vector<SharedPtr<BaseExpression>> arguments{std::move(left), std::move(right)};
+        SharedPtr<FunctionSet> function_set = NewCatalog::GetFunctionSetByName(catalog_ptr_.get(), name);
+        auto scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+        ScalarFunction function = scalar_function_set->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(function, arguments);
+    }
+
+    // c0 double with a NULL every 7 rows, c1 bigint in [0, 5)
+    static void MakeInput(DataBlock &input_block, SizeT row_count) {
+        SharedPtr<ColumnVector> double_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kDouble));
+        SharedPtr<ColumnVector> bigint_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBigInt));
+        double_column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        bigint_column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        for (SizeT i = 0; i < row_count; ++i) {
+            double_column->AppendValue(Value::MakeDouble(static_cast<DoubleT>(i) * 0.5 - 100));
+            bigint_column->AppendValue(Value::MakeBigInt(static_cast<BigIntT>(i % 5)));
+        }
+        for (SizeT i = 0; i < row_count; i += 7) {
+            double_column->nulls_ptr_->SetFalse(i);
+        }
+        input_block.Init({double_column, bigint_column});
+    }
+
+    // evaluate expr fused and node by node, the results should be the same
+    static void CheckFused(const SharedPtr<BaseExpression> &expr, DataBlock &input_block) {
+        SharedPtr<FusedExpression> fused_expression = FusedExpression::Compile(expr);
+        ASSERT_NE(fused_expression, nullptr);
+
+        ExpressionEvaluator evaluator;
+        evaluator.Init(&input_block);
+        SharedPtr<ColumnVector> expected = ColumnVector::Make(MakeShared<DataType>(expr->Type()));
+        expected->Initialize();
+        SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+        evaluator.Execute(expr, expr_state, expected);
+
+        SharedPtr<ColumnVector> result = ColumnVector::Make(MakeShared<DataType>(expr->Type()));
+        result->Initialize();
+        Vector<SharedPtr<ExpressionState>> leaf_states = fused_expression->CreateLeafStates();
+        EXPECT_TRUE(fused_expression->Execute(evaluator, leaf_states, result));
+
+        ASSERT_EQ(result->Size(), expected->Size());
+        ASSERT_EQ(result->Size(), input_block.row_count());
+        SizeT null_count = 0;
+        for (SizeT i = 0; i < result->Size(); ++i) {
+            bool valid = expected->nulls_ptr_->IsTrue(i);
+            EXPECT_EQ(result->nulls_ptr_->IsTrue(i), valid);
+            if (valid) {
+                EXPECT_EQ(result->GetValue(i), expected->GetValue(i));
+            } else {
+                ++null_count;
+            }
+        }
+        EXPECT_GT(null_count, 0u);
+    }
+
+private:
+    UniquePtr<Config> config_ptr_;
+    UniquePtr<KVStore> kv_store_ptr_;
+    UniquePtr<NewCatalog> catalog_ptr_;
+};
+
+TEST_F(FusedExpressionTest, arithmetic) {
+    DataBlock input_block;
+    MakeInput(input_block, 2500);
+    auto c0 = ReferenceExpression::Make(DataType(LogicalType::kDouble), "t1", "c0", String(), 0);
+    auto c1 = CastExpression::AddCastToType(ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 1),
+                                            DataType(LogicalType::kDouble));
+
+    // (0.7 * c0 + 0.3 * c1) / c1, NULL when c0 is NULL or c1 is 0
+    auto score = MakeFunction("+",
+                              MakeFunction("*", MakeShared<ValueExpression>(Value::MakeDouble(0.7)), c0),
+                              MakeFunction("*", MakeShared<ValueExpression>(Value::MakeDouble(0.3)), c1));
+    auto expr = MakeFunction("/", score, c1);
+    CheckFused(expr, input_block);
+
+    SharedPtr<FusedExpression> fused_expression = FusedExpression::Compile(expr);
+    EXPECT_EQ(fused_expression->OperationCount(), 4u);
+    EXPECT_EQ(fused_expression->LeafCount(), 3u);
+
+    // a single operation is left to ExpressionEvaluator
+    EXPECT_EQ(FusedExpression::Compile(MakeFunction("+", c0, c1)), nullptr);
+    EXPECT_EQ(FusedExpression::Compile(c0), nullptr);
+}
+
+TEST_F(FusedExpressionTest, compare) {
+    DataBlock input_block;
+    MakeInput(input_block, DEFAULT_VECTOR_SIZE);
+    auto c0 = ReferenceExpression::Make(DataType(LogicalType::kDouble), "t1", "c0", String(), 0);
+    auto c1 = CastExpression::AddCastToType(ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 1),
+                                            DataType(LogicalType::kDouble));
+
+    // c0 * 2 + 1 > c1
+    auto doubled = MakeFunction("*", c0, MakeShared<ValueExpression>(Value::MakeDouble(2)));
+    auto expr = MakeFunction(">", MakeFunction("+", doubled, MakeShared<ValueExpression>(Value::MakeDouble(1))), c1);
+    EXPECT_EQ(expr->Type().type(), LogicalType::kBoolean);
+    CheckFused(expr, input_block);
+}
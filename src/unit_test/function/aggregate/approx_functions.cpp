@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import infinity_exception;
+
+import third_party;
+
+import logger;
+import stl;
+import new_catalog;
+import approx;
+import approx_sketch;
+import function_set;
+import aggregate_function_set;
+import aggregate_function;
+import function;
+import column_expression;
+import value;
+import default_values;
+import data_block;
+import internal_types;
+import logical_type;
+import data_type;
+import config;
+import status;
+import kv_store;
+
+using namespace infinity;
+class ApproxFunctionTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        config_ptr_ = MakeUnique<Config>();
+        Status status = config_ptr_->Init(nullptr, nullptr);
+        EXPECT_TRUE(status.ok());
+        kv_store_ptr_ = MakeUnique<KVStore>();
+        status = kv_store_ptr_->Init(config_ptr_->CatalogDir());
+        EXPECT_TRUE(status.ok());
+        catalog_ptr_ = MakeUnique<NewCatalog>(kv_store_ptr_.get());
+        RegisterApproxFunction(catalog_ptr_.get());
+    }
+
+    void TearDown() override {
+        catalog_ptr_.reset();
+        kv_store_ptr_.reset();
+        config_ptr_.reset();
+        BaseTest::TearDown();
+    }
+
+    AggregateFunction GetFunction(const String &name) {
+        SharedPtr<FunctionSet> function_set = NewCatalog::GetFunctionSetByName(catalog_ptr_.get(), name);
+        EXPECT_EQ(function_set->type_, FunctionType::kAggregate);
+        SharedPtr<AggregateFunctionSet> aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+        SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(DataType(LogicalType::kBigInt), "t1", 1, "c1", 0, 0);
+        return aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+    }
+
+    // Aggregate [begin, end) in blocks of DEFAULT_VECTOR_SIZE
+    static void Aggregate(const AggregateFunction &func, ptr_t state, i64 begin, i64 end, i64 modulo) {
+        Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kBigInt)};
+        for (i64 block_begin = begin; block_begin < end; block_begin += DEFAULT_VECTOR_SIZE) {
+            DataBlock data_block;
+            data_block.Init(column_types);
+            i64 block_end = std::min<i64>(end, block_begin + DEFAULT_VECTOR_SIZE);
+            for (i64 i = block_begin; i < block_end; ++i) {
+                data_block.AppendValue(0, Value::MakeBigInt(i % modulo));
+            }
+            data_block.Finalize();
+            func.update_func_(state, data_block.column_vectors[0]);
+        }
+    }
+
+private:
+    UniquePtr<Config> config_ptr_;
+    UniquePtr<KVStore> kv_store_ptr_;
+    UniquePtr<NewCatalog> catalog_ptr_;
+};
+
+TEST_F(ApproxFunctionTest, hll_sketch_func) {
+    AggregateFunction func = GetFunction("hll_sketch");
+    EXPECT_EQ(func.return_type_, HyperLogLogSketch::SketchType());
+
+    // two partial states with overlapping values, as produced by two tasklets
+    constexpr i64 distinct_count = 100000;
+    auto left_state = func.InitState();
+    auto right_state = func.InitState();
+    func.init_func_(left_state.get());
+    func.init_func_(right_state.get());
+    Aggregate(func, left_state.get(), 0, 120000, distinct_count);
+    Aggregate(func, right_state.get(), 60000, 200000, distinct_count);
+    auto *left = reinterpret_cast<u8 *>(func.finalize_func_(left_state.get()));
+    auto *right = reinterpret_cast<u8 *>(func.finalize_func_(right_state.get()));
+    HyperLogLogSketch::Merge(left, right);
+
+    i64 estimate = HyperLogLogSketch::Estimate(left);
+    EXPECT_NEAR(static_cast<double>(estimate), static_cast<double>(distinct_count), distinct_count * 0.05);
+
+    // small cardinality is almost exact with linear counting
+    auto small_state = func.InitState();
+    func.init_func_(small_state.get());
+    Aggregate(func, small_state.get(), 0, 10000, 100);
+    EXPECT_NEAR(static_cast<double>(HyperLogLogSketch::Estimate(reinterpret_cast<u8 *>(func.finalize_func_(small_state.get())))), 100.0, 2.0);
+}
+
+TEST_F(ApproxFunctionTest, tdigest_sketch_func) {
+    AggregateFunction func = GetFunction("tdigest_sketch");
+    EXPECT_EQ(func.return_type_, TDigestSketch::SketchType());
+
+    constexpr i64 value_count = 100000;
+    auto left_state = func.InitState();
+    auto right_state = func.InitState();
+    func.init_func_(left_state.get());
+    func.init_func_(right_state.get());
+    Aggregate(func, left_state.get(), 0, value_count / 2, value_count);
+    Aggregate(func, right_state.get(), value_count / 2, value_count, value_count);
+    auto *left = reinterpret_cast<double *>(func.finalize_func_(left_state.get()));
+    auto *right = reinterpret_cast<double *>(func.finalize_func_(right_state.get()));
+    EXPECT_LE(static_cast<SizeT>(left[3]), TDigestSketch::kCentroidCapacity);
+    TDigestSketch::Merge(left, right);
+    EXPECT_LE(static_cast<SizeT>(left[3]), TDigestSketch::kCentroidCapacity);
+
+    for (double q : {0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0}) {
+        double result = 0;
+        EXPECT_TRUE(TDigestSketch::Quantile(left, q, result));
+        EXPECT_NEAR(result, q * (value_count - 1), value_count * 0.01);
+    }
+
+    auto empty_state = func.InitState();
+    func.init_func_(empty_state.get());
+    double result = 0;
+    EXPECT_FALSE(TDigestSketch::Quantile(reinterpret_cast<double *>(func.finalize_func_(empty_state.get())), 0.5, result));
+}
@@ -56,6 +56,7 @@ TEST_F(ConfigTest, test1) {
     EXPECT_EQ(config.PeerConnectTimeout(), DEFAULT_PEER_CONNECT_TIMEOUT);
     EXPECT_EQ(config.PeerRecvTimeout(), DEFAULT_PEER_RECV_TIMEOUT);
     EXPECT_EQ(config.PeerSendTimeout(), DEFAULT_PEER_SEND_TIMEOUT);
+    EXPECT_EQ(config.PeerReplicateIndex(), DEFAULT_PEER_REPLICATE_INDEX);
 
     // Log
     EXPECT_EQ(config.LogFileName(), "infinity.log");
@@ -70,12 +71,17 @@ TEST_F(ConfigTest, test1) {
     EXPECT_EQ(config.DataDir(), "/var/infinity/data");
     EXPECT_EQ(config.WALDir(), "/var/infinity/wal");
     EXPECT_EQ(config.StorageType(), StorageType::kLocal);
+    EXPECT_EQ(config.MemIndexDumpWorker(), DEFAULT_MEMINDEX_DUMP_WORKER);
 
     // buffer
     EXPECT_EQ(config.BufferManagerSize(), 8 * 1024l * 1024l * 1024l);
     EXPECT_EQ(config.LRUNum(), 7);
     EXPECT_EQ(config.TempDir(), "/var/infinity/tmp");
     EXPECT_EQ(config.MemIndexMemoryQuota(), 4 * 1024l * 1024l * 1024l);
+    EXPECT_EQ(config.DenseMemIndexMemoryQuota(), 0);
+    EXPECT_EQ(config.SparseMemIndexMemoryQuota(), 0);
+    EXPECT_EQ(config.FulltextMemIndexMemoryQuota(), 0);
+    EXPECT_EQ(config.TableMemIndexMemoryQuota(), 0);
 
     EXPECT_EQ(config.ResultCache(), "off");
     EXPECT_EQ(config.CacheResultNum(), 10000);
@@ -104,6 +110,7 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.PeerConnectTimeout(), 2000);
     EXPECT_EQ(config.PeerRecvTimeout(), 2000);
     EXPECT_EQ(config.PeerSendTimeout(), 2000);
+    EXPECT_EQ(config.PeerReplicateIndex(), true);
 
     EXPECT_EQ(config.LogFileName(), "infinity.log");
     EXPECT_EQ(config.LogDir(), "/var/infinity/log");
@@ -122,12 +129,17 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.ObjectStorageAccessKey(), "minioadmin");
     EXPECT_EQ(config.ObjectStorageSecretKey(), "minioadmin");
     EXPECT_EQ(config.ObjectStorageHttps(), false);
+    EXPECT_EQ(config.MemIndexDumpWorker(), 4);
 
     // buffer
     EXPECT_EQ(config.BufferManagerSize(), 3 * 1024l * 1024l * 1024l);
     EXPECT_EQ(config.LRUNum(), 8);
     EXPECT_EQ(config.TempDir(), "/var/infinity/tmp");
     EXPECT_EQ(config.MemIndexMemoryQuota(), 2 * 1024l * 1024l * 1024l);
+    EXPECT_EQ(config.DenseMemIndexMemoryQuota(), 1024l * 1024l * 1024l);
+    EXPECT_EQ(config.SparseMemIndexMemoryQuota(), 0);
+    EXPECT_EQ(config.FulltextMemIndexMemoryQuota(), 512l * 1024l * 1024l);
+    EXPECT_EQ(config.TableMemIndexMemoryQuota(), 768l * 1024l * 1024l);
 
     EXPECT_EQ(config.ResultCache(), "on");
     EXPECT_EQ(config.CacheResultNum(), 100);
@@ -32,6 +32,10 @@ import column_expr;
 import insert_row_expr;
 import column_def;
 import data_type;
+import infinity_context;
+import session;
+import session_manager;
+import query_context;
 
 using namespace infinity;
 class InfinityTest : public BaseTest {};
@@ -364,4 +368,53 @@ TEST_F(InfinityTest, test2) {
     infinity->LocalDisconnect();
 
     Infinity::LocalUnInit();
-}
\ No newline at end of file
+}
+
+TEST_F(InfinityTest, recycle_query_planners) {
+    using namespace infinity;
+    Infinity::LocalUnInit();
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    {
+        SessionManager *session_mgr = InfinityContext::instance().session_manager();
+        SharedPtr<LocalSession> session = session_mgr->CreateLocalSession();
+        auto make_query_context = [&] {
+            auto query_context = MakeUnique<QueryContext>(session.get(), true);
+            query_context->Init(InfinityContext::instance().config(),
+                                InfinityContext::instance().task_scheduler(),
+                                InfinityContext::instance().storage(),
+                                InfinityContext::instance().resource_manager(),
+                                InfinityContext::instance().session_manager(),
+                                InfinityContext::instance().persistence_manager());
+            return query_context;
+        };
+
+        void *logical_planner = nullptr;
+        for (SizeT i = 0; i < 3; ++i) {
+            UniquePtr<QueryContext> query_context = make_query_context();
+            if (logical_planner == nullptr) {
+                logical_planner = query_context->logical_planner();
+            } else {
+                // the planners of the previous query of the session are reused
+                EXPECT_EQ(query_context->logical_planner(), logical_planner);
+            }
+            QueryResult result = query_context->Query("show databases");
+            EXPECT_TRUE(result.IsOk());
+            EXPECT_EQ(result.result_table_->row_count(), 1);
+        }
+
+        {
+            // a concurrent query of the session builds its own planners
+            UniquePtr<QueryContext> query_context1 = make_query_context();
+            UniquePtr<QueryContext> query_context2 = make_query_context();
+            EXPECT_NE(query_context1->logical_planner(), query_context2->logical_planner());
+            EXPECT_TRUE(query_context2->Query("show databases").IsOk());
+            EXPECT_TRUE(query_context1->Query("show databases").IsOk());
+        }
+        session_mgr->RemoveSessionByID(session->session_id());
+    }
+
+    Infinity::LocalUnInit();
+}
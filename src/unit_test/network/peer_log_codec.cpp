@@ -0,0 +1,95 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import peer_log_codec;
+import status;
+
+using namespace infinity;
+
+class PeerLogCodecTest : public BaseTest {
+protected:
+    static Vector<SharedPtr<String>> LogEntries() {
+        Vector<SharedPtr<String>> log_entries;
+        log_entries.push_back(MakeShared<String>("first log entry"));
+        log_entries.push_back(MakeShared<String>());
+        String binary_entry(1000, '\0');
+        for (SizeT i = 0; i < binary_entry.size(); ++i) {
+            binary_entry[i] = static_cast<char>(i % 256);
+        }
+        log_entries.push_back(MakeShared<String>(std::move(binary_entry)));
+        log_entries.push_back(MakeShared<String>(10000, 'a'));
+        return log_entries;
+    }
+};
+
+TEST_F(PeerLogCodecTest, round_trip) {
+    const Vector<SharedPtr<String>> log_entries = LogEntries();
+    String compressed;
+    ASSERT_TRUE(CompressLogEntries(log_entries, compressed).ok());
+
+    Vector<String> decompressed;
+    Status status = DecompressLogEntries(compressed, log_entries.size(), decompressed);
+    EXPECT_TRUE(status.ok()) << status.message();
+    ASSERT_EQ(decompressed.size(), log_entries.size());
+    for (SizeT i = 0; i < log_entries.size(); ++i) {
+        EXPECT_EQ(decompressed[i], *log_entries[i]);
+    }
+}
+
+TEST_F(PeerLogCodecTest, empty_batch) {
+    String compressed;
+    ASSERT_TRUE(CompressLogEntries({}, compressed).ok());
+
+    Vector<String> decompressed;
+    Status status = DecompressLogEntries(compressed, 0, decompressed);
+    EXPECT_TRUE(status.ok()) << status.message();
+    EXPECT_TRUE(decompressed.empty());
+}
+
+TEST_F(PeerLogCodecTest, wrong_entry_count) {
+    const Vector<SharedPtr<String>> log_entries = LogEntries();
+    String compressed;
+    ASSERT_TRUE(CompressLogEntries(log_entries, compressed).ok());
+
+    Vector<String> decompressed;
+    EXPECT_FALSE(DecompressLogEntries(compressed, log_entries.size() + 1, decompressed).ok());
+    EXPECT_FALSE(DecompressLogEntries(compressed, log_entries.size() - 1, decompressed).ok());
+}
+
+TEST_F(PeerLogCodecTest, truncated_batch) {
+    String compressed;
+    ASSERT_TRUE(CompressLogEntries(LogEntries(), compressed).ok());
+
+    Vector<String> decompressed;
+    EXPECT_FALSE(DecompressLogEntries(compressed.substr(0, 2), 4, decompressed).ok());
+    EXPECT_FALSE(DecompressLogEntries(compressed.substr(0, compressed.size() / 2), 4, decompressed).ok());
+}
+
+TEST_F(PeerLogCodecTest, corrupted_raw_size) {
+    String compressed;
+    ASSERT_TRUE(CompressLogEntries(LogEntries(), compressed).ok());
+
+    Vector<String> decompressed;
+    // the raw size in the header is far larger than the block can hold
+    u32 raw_size = std::numeric_limits<u32>::max();
+    std::memcpy(compressed.data(), &raw_size, sizeof(raw_size));
+    EXPECT_FALSE(DecompressLogEntries(compressed, 4, decompressed).ok());
+    raw_size = 1;
+    std::memcpy(compressed.data(), &raw_size, sizeof(raw_size));
+    EXPECT_FALSE(DecompressLogEntries(compressed, 4, decompressed).ok());
+}
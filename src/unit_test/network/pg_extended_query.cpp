@@ -0,0 +1,179 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bit>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import pg_extended_query;
+import pg_binary_format;
+import status;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import embedding_info;
+import knn_expr;
+
+using namespace infinity;
+
+class PGExtendedQueryTest : public BaseTest {
+protected:
+    static String Literal(const Optional<String> &value, u32 object_id) {
+        auto [literal, status] = ParameterLiteral(value, object_id);
+        EXPECT_TRUE(status.ok()) << status.message();
+        return literal;
+    }
+
+    static bool InvalidLiteral(const String &value, u32 object_id) {
+        auto [literal, status] = ParameterLiteral(value, object_id);
+        return !status.ok();
+    }
+
+    // most significant byte first
+    static String NetworkBytes(u64 bits, SizeT size) {
+        String out;
+        for (SizeT shift = size * 8; shift > 0; shift -= 8) {
+            out.push_back(static_cast<char>(bits >> (shift - 8)));
+        }
+        return out;
+    }
+};
+
+TEST_F(PGExtendedQueryTest, parameter_literal) {
+    EXPECT_EQ(Literal(None, 23), "NULL");
+    EXPECT_EQ(Literal(None, 0), "NULL");
+
+    EXPECT_EQ(Literal("42", 23), "(42)");
+    EXPECT_EQ(Literal("-1.5e3", 701), "(-1.5e3)");
+    EXPECT_TRUE(InvalidLiteral("1; DROP TABLE t", 23));
+    EXPECT_TRUE(InvalidLiteral("", 20));
+
+    EXPECT_EQ(Literal("t", 16), "true");
+    EXPECT_EQ(Literal("false", 16), "false");
+
+    EXPECT_EQ(Literal("{1,2.5,3}", 1021), "[1,2.5,3]");
+    EXPECT_EQ(Literal("[1,2,3]", 1007), "[1,2,3]");
+    EXPECT_TRUE(InvalidLiteral("{a,b}", 1021));
+    EXPECT_EQ(Literal("[ 1, -2 ]", 1022), "[1,-2]");
+    EXPECT_EQ(Literal("{}", 1007), "[]");
+    // a single flat array of numbers, nothing after it
+    EXPECT_TRUE(InvalidLiteral("[1],[2]", 1021));
+    EXPECT_TRUE(InvalidLiteral("[1]]", 1021));
+    EXPECT_TRUE(InvalidLiteral("[[1,2]]", 1021));
+    EXPECT_TRUE(InvalidLiteral("[1,,2]", 1021));
+    EXPECT_TRUE(InvalidLiteral("[1,2,]", 1021));
+    EXPECT_TRUE(InvalidLiteral("{1,2]", 1021));
+    EXPECT_TRUE(InvalidLiteral("[1 2]", 1021));
+
+    // the unspecified type is a string, even when it looks like a number or an array
+    EXPECT_EQ(Literal("42", 0), "'42'");
+    EXPECT_EQ(Literal("[1,2,3]", 0), "'[1,2,3]'");
+    EXPECT_EQ(Literal("it's", 0), "'it''s'");
+    EXPECT_EQ(Literal("abc", 25), "'abc'");
+}
+
+TEST_F(PGExtendedQueryTest, parameter_count) {
+    EXPECT_EQ(ParameterCount("SELECT 1"), 0ul);
+    EXPECT_EQ(ParameterCount("SELECT * FROM t WHERE a = $1 AND b = $2"), 2ul);
+    EXPECT_EQ(ParameterCount("SELECT $3, $1"), 3ul);
+    EXPECT_EQ(ParameterCount("SELECT '$1', $2"), 2ul);
+    EXPECT_EQ(ParameterCount("SELECT 'it''s $1'"), 0ul);
+    EXPECT_EQ(ParameterCount("SELECT $"), 0ul);
+    EXPECT_EQ(ParameterCount("SELECT $12"), 12ul);
+}
+
+TEST_F(PGExtendedQueryTest, bind_parameters) {
+    EXPECT_EQ(BindParameters("SELECT * FROM t WHERE a = $1 AND b = $2", {"(1)", "'x'"}), "SELECT * FROM t WHERE a = (1) AND b = 'x'");
+    EXPECT_EQ(BindParameters("SELECT $2, $1, $2", {"(1)", "(2)"}), "SELECT (2), (1), (2)");
+    // the placeholders in string literals and out of range are kept
+    EXPECT_EQ(BindParameters("SELECT '$1', $1", {"(1)"}), "SELECT '$1', (1)");
+    EXPECT_EQ(BindParameters("SELECT $1, $3", {"(1)"}), "SELECT (1), $3");
+    EXPECT_EQ(BindParameters("SELECT $1", {}), "SELECT $1");
+    // -$1 with a negative parameter isn't a comment
+    EXPECT_EQ(BindParameters("SELECT -$1", {"(-1)"}), "SELECT -(-1)");
+    EXPECT_EQ(BindParameters("SELECT $10, $1", {"(1)", "(2)", "(3)", "(4)", "(5)", "(6)", "(7)", "(8)", "(9)", "(10)"}), "SELECT (10), (1)");
+}
+
+TEST_F(PGExtendedQueryTest, parse_copy_from_stdin) {
+    String table_name;
+    String options;
+    EXPECT_TRUE(ParseCopyFromStdin("COPY t1 FROM STDIN", table_name, options));
+    EXPECT_EQ(table_name, "t1");
+    EXPECT_EQ(options, "");
+
+    EXPECT_TRUE(ParseCopyFromStdin("copy t2 from stdin with (FORMAT csv, DELIMITER ',');\n", table_name, options));
+    EXPECT_EQ(table_name, "t2");
+    EXPECT_EQ(options, "FORMAT csv, DELIMITER ','");
+
+    EXPECT_TRUE(ParseCopyFromStdin("  COPY t3\n FROM\tSTDIN ; ", table_name, options));
+    EXPECT_EQ(table_name, "t3");
+    EXPECT_EQ(options, "");
+
+    EXPECT_FALSE(ParseCopyFromStdin("COPY t1 FROM '/tmp/t1.csv'", table_name, options));
+    EXPECT_FALSE(ParseCopyFromStdin("COPY t1 TO STDOUT", table_name, options));
+    EXPECT_FALSE(ParseCopyFromStdin("SELECT * FROM t1", table_name, options));
+    EXPECT_FALSE(ParseCopyFromStdin("COPY t1 FROM STDIN (FORMAT csv)", table_name, options));
+    EXPECT_FALSE(ParseCopyFromStdin("COPY t1 FROM STDIN WITH (FORMAT csv", table_name, options));
+}
+
+TEST_F(PGExtendedQueryTest, encode_binary) {
+    {
+        ColumnVector column(MakeShared<DataType>(LogicalType::kInteger));
+        column.Initialize();
+        column.AppendValue(Value::MakeInt(0x01020304));
+        column.AppendValue(Value::MakeInt(-2));
+        column.AppendValue(Value::MakeInt(0));
+        column.nulls_ptr_->SetFalse(2);
+        EXPECT_EQ(PGEncodeBinary(column, 0), NetworkBytes(0x01020304, 4));
+        EXPECT_EQ(PGEncodeBinary(column, 1), NetworkBytes(0xFFFFFFFE, 4));
+        EXPECT_FALSE(PGEncodeBinary(column, 2).has_value());
+    }
+    {
+        ColumnVector column(MakeShared<DataType>(LogicalType::kBigInt));
+        column.Initialize();
+        column.AppendValue(Value::MakeBigInt(-1));
+        EXPECT_EQ(PGEncodeBinary(column, 0), String(8, '\xFF'));
+    }
+    {
+        ColumnVector column(MakeShared<DataType>(LogicalType::kBoolean));
+        column.Initialize();
+        column.AppendValue(Value::MakeBool(true));
+        column.AppendValue(Value::MakeBool(false));
+        EXPECT_EQ(PGEncodeBinary(column, 0), String(1, '\x01'));
+        EXPECT_EQ(PGEncodeBinary(column, 1), String(1, '\x00'));
+    }
+    {
+        ColumnVector column(MakeShared<DataType>(LogicalType::kDouble));
+        column.Initialize();
+        column.AppendValue(Value::MakeDouble(1.5));
+        EXPECT_EQ(PGEncodeBinary(column, 0), NetworkBytes(std::bit_cast<u64>(1.5), 8));
+    }
+    {
+        // one dimensional float4[] without nulls
+        auto embedding_info = EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, 2);
+        ColumnVector column(MakeShared<DataType>(LogicalType::kEmbedding, embedding_info));
+        column.Initialize();
+        Vector<float> data{1.0f, -2.0f};
+        column.AppendValue(Value::MakeEmbedding(data));
+        String expected = NetworkBytes(1, 4) + NetworkBytes(0, 4) + NetworkBytes(700, 4) + NetworkBytes(2, 4) + NetworkBytes(1, 4);
+        for (float element : data) {
+            expected += NetworkBytes(4, 4) + NetworkBytes(std::bit_cast<u32>(element), 4);
+        }
+        EXPECT_EQ(PGEncodeBinary(column, 0), expected);
+    }
+}
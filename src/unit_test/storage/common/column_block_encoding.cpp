@@ -0,0 +1,83 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+import base_test;
+import column_block_encoding;
+import stl;
+
+using namespace infinity;
+
+class ColumnBlockEncodingTest : public BaseTest {
+protected:
+    template <typename T>
+    static Vector<char> RoundTrip(const Vector<T> &values) {
+        SizeT size = values.size() * sizeof(T);
+        Vector<char> encoded = ColumnBlockEncoding::Encode(reinterpret_cast<const char *>(values.data()), size, sizeof(T));
+        if (!encoded.empty()) {
+            Vector<T> decoded(values.size());
+            ColumnBlockEncoding::Decode(encoded.data(), encoded.size(), reinterpret_cast<char *>(decoded.data()), size);
+            EXPECT_EQ(decoded, values);
+        }
+        return encoded;
+    }
+};
+
+TEST_F(ColumnBlockEncodingTest, frame_of_reference) {
+    std::mt19937_64 rng(0);
+    Vector<i64> timestamps(8192);
+    for (auto &ts : timestamps) {
+        ts = 1700000000000 + static_cast<i64>(rng() % 100000);
+    }
+    Vector<char> encoded = RoundTrip(timestamps);
+    ASSERT_FALSE(encoded.empty());
+    EXPECT_EQ(static_cast<ColumnBlockEncodingType>(encoded[0]), ColumnBlockEncodingType::kFORBitPack);
+    EXPECT_LT(encoded.size(), timestamps.size() * sizeof(i64) / 3);
+
+    Vector<i8> small(8192);
+    for (auto &v : small) {
+        v = static_cast<i8>(rng() % 8) - 4;
+    }
+    EXPECT_FALSE(RoundTrip(small).empty());
+}
+
+TEST_F(ColumnBlockEncodingTest, run_length) {
+    // a partially filled block: the tail is zero
+    Vector<i32> values(8192, 0);
+    for (i32 i = 0; i < 100; ++i) {
+        values[i] = i - 50;
+    }
+    Vector<char> encoded = RoundTrip(values);
+    ASSERT_FALSE(encoded.empty());
+    EXPECT_EQ(static_cast<ColumnBlockEncodingType>(encoded[0]), ColumnBlockEncodingType::kRLE);
+
+    Vector<i16> constant(8192, 7);
+    EXPECT_FALSE(RoundTrip(constant).empty());
+}
+
+TEST_F(ColumnBlockEncodingTest, plain) {
+    std::mt19937_64 rng(0);
+    Vector<u64> random(8192);
+    for (auto &v : random) {
+        v = rng();
+    }
+    EXPECT_TRUE(RoundTrip(random).empty());
+
+    // 16 bytes values, such as varchar, are not encoded
+    Vector<char> data(16 * 8192, 0);
+    EXPECT_TRUE(ColumnBlockEncoding::Encode(data.data(), data.size(), 16).empty());
+}
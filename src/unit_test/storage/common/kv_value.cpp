@@ -0,0 +1,55 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+
+import base_test;
+import kv_value;
+import stl;
+
+using namespace infinity;
+
+class KVValueTest : public BaseTest {};
+
+TEST_F(KVValueTest, timestamp) {
+    for (TxnTimeStamp ts : {TxnTimeStamp(0), TxnTimeStamp(127), TxnTimeStamp(128), TxnTimeStamp(1745000000123), std::numeric_limits<TxnTimeStamp>::max()}) {
+        String value = KVValue::EncodeTimestamp(ts);
+        EXPECT_TRUE(KVValue::IsBinary(value));
+        EXPECT_EQ(KVValue::DecodeTimestamp(value), ts);
+    }
+    EXPECT_EQ(KVValue::EncodeTimestamp(300).size(), 3u);
+
+    // values written by older versions
+    EXPECT_FALSE(KVValue::IsBinary("123"));
+    EXPECT_EQ(KVValue::DecodeTimestamp("123"), 123u);
+    EXPECT_EQ(KVValue::DecodeTimestamp("0"), 0u);
+    EXPECT_EQ(KVValue::DecodeTimestamp("-1"), std::numeric_limits<TxnTimeStamp>::max());
+}
+
+TEST_F(KVValueTest, id_list) {
+    Vector<Vector<u32>> id_lists = {{}, {0}, {0, 1, 2, 3}, {5, 3, 100000, 7}, {std::numeric_limits<u32>::max(), 0}};
+    for (const auto &ids : id_lists) {
+        String value = KVValue::EncodeIDs(ids);
+        EXPECT_TRUE(KVValue::IsBinary(value));
+        EXPECT_EQ(KVValue::DecodeIDs(value), ids);
+    }
+    // dense sorted ids take one byte each
+    Vector<u32> dense(1000);
+    std::iota(dense.begin(), dense.end(), 0);
+    EXPECT_EQ(KVValue::EncodeIDs(dense).size(), 1 + 2 + dense.size());
+
+    // values written by older versions
+    EXPECT_EQ(KVValue::DecodeIDs("[]"), Vector<u32>());
+    EXPECT_EQ(KVValue::DecodeIDs("[0,2,1]"), Vector<u32>({0, 2, 1}));
+}
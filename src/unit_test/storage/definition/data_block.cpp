@@ -35,6 +35,7 @@ import embedding_info;
 import array_info;
 import knn_expr;
 import data_type;
+import selection;
 
 using namespace infinity;
 
@@ -300,3 +301,61 @@ TEST_P(DataBlockTest, ReadWrite) {
     EXPECT_NE(data_block2, nullptr);
     EXPECT_EQ(data_block == *data_block2, true);
 }
+
+TEST_P(DataBlockTest, selected_block) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kVarchar)};
+    DataBlock input_block;
+    input_block.Init(column_types);
+    constexpr SizeT row_count = 100;
+    for (SizeT i = 0; i < row_count; ++i) {
+        input_block.AppendValue(0, Value::MakeBigInt(i));
+        input_block.AppendValue(1, Value::MakeVarchar(fmt::format("row {} with a long enough varchar", i)));
+    }
+    input_block.Finalize();
+
+    // even rows
+    auto even_select = MakeShared<Selection>();
+    even_select->Initialize(row_count);
+    for (SizeT i = 0; i < row_count; i += 2) {
+        even_select->Append(i);
+    }
+    DataBlock even_block;
+    even_block.InitSelected(&input_block, even_select);
+    EXPECT_TRUE(even_block.HasSelection());
+    EXPECT_EQ(even_block.row_count(), row_count / 2);
+    // column vectors are shared until materialized
+    EXPECT_EQ(even_block.column_vectors[0].get(), input_block.column_vectors[0].get());
+    EXPECT_EQ(even_block.SelectedColumn(0)->Size(), row_count / 2);
+    EXPECT_EQ(even_block.SelectedColumn(0)->GetValue(3), Value::MakeBigInt(6));
+
+    // every third row of the even rows, composed with the selection of even_block
+    auto third_select = MakeShared<Selection>();
+    third_select->Initialize(row_count / 2);
+    for (SizeT i = 0; i < row_count / 2; i += 3) {
+        third_select->Append(i);
+    }
+    DataBlock sixth_block;
+    sixth_block.InitSelected(&even_block, third_select);
+    EXPECT_EQ(sixth_block.row_count(), 17u);
+    sixth_block.Materialize();
+    EXPECT_FALSE(sixth_block.HasSelection());
+    EXPECT_NE(sixth_block.column_vectors[1].get(), input_block.column_vectors[1].get());
+    for (SizeT i = 0; i < sixth_block.row_count(); ++i) {
+        EXPECT_EQ(sixth_block.GetValue(0, i), Value::MakeBigInt(i * 6));
+        EXPECT_EQ(sixth_block.GetValue(1, i), Value::MakeVarchar(fmt::format("row {} with a long enough varchar", i * 6)));
+    }
+
+    // all rows selected, nothing to copy
+    auto all_select = MakeShared<Selection>();
+    all_select->Initialize(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        all_select->Append(i);
+    }
+    DataBlock all_block;
+    all_block.InitSelected(&input_block, all_select);
+    EXPECT_FALSE(all_block.HasSelection());
+    EXPECT_EQ(all_block.row_count(), row_count);
+    EXPECT_EQ(all_block.column_vectors[1].get(), input_block.column_vectors[1].get());
+}
@@ -22,6 +22,10 @@ import doc_iterator;
 import and_iterator;
 import or_iterator;
 import and_not_iterator;
+import must_first_iterator;
+import filter_iterator;
+import blockmax_leaf_iterator;
+import column_length_io;
 import column_index_reader;
 import query_builder;
 import query_node;
@@ -114,6 +118,133 @@ struct MockQueryNode : public TermQueryNode {
     }
 };
 
+// doc iterator with given scores, bm25_score_upper_bound_ is the max of them
+class MockScoredDocIterator : public DocIterator {
+public:
+    MockScoredDocIterator(Vector<RowID> doc_ids, Vector<float> scores) : doc_ids_(std::move(doc_ids)), scores_(std::move(scores)) {
+        bm25_score_upper_bound_ = scores_.empty() ? 0.0f : *std::max_element(scores_.begin(), scores_.end());
+    }
+    ~MockScoredDocIterator() override = default;
+
+    DocIteratorType GetType() const override { return DocIteratorType::kTermDocIterator; }
+    String Name() const override { return "MockScoredDocIterator"; }
+
+    bool Next(RowID doc_id) override {
+        while (idx_ < doc_ids_.size() and doc_ids_[idx_] < doc_id) {
+            ++idx_;
+        }
+        if (idx_ < doc_ids_.size()) {
+            doc_id_ = doc_ids_[idx_];
+            return true;
+        }
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+
+    float Score() override { return scores_[idx_]; }
+
+    void UpdateScoreThreshold(float threshold) override { threshold_ = std::max(threshold_, threshold); }
+
+    void SetBM25ScoreUpperBound(float upper_bound) { bm25_score_upper_bound_ = upper_bound; }
+
+    u32 MatchCount() const override { return DocID() != INVALID_ROWID; }
+
+    void PrintTree(std::ostream &os, const String &prefix, bool is_final = true) const override {
+        os << prefix;
+        os << (is_final ? "└──" : "├──");
+        os << "MockScoredDocIterator (doc_num: " << doc_ids_.size() << ")" << '\n';
+    }
+
+    Vector<RowID> doc_ids_;
+    Vector<float> scores_;
+    u32 idx_ = 0;
+};
+
+// MockScoredDocIterator with block max info, every kBlockSize docs make a block
+class MockBlockMaxDocIterator : public BlockMaxLeafIterator {
+public:
+    static constexpr u32 kBlockSize = 64;
+
+    MockBlockMaxDocIterator(Vector<RowID> doc_ids, Vector<float> scores) : doc_ids_(std::move(doc_ids)), scores_(std::move(scores)) {
+        bm25_score_upper_bound_ = scores_.empty() ? 0.0f : *std::max_element(scores_.begin(), scores_.end());
+    }
+    ~MockBlockMaxDocIterator() override = default;
+
+    DocIteratorType GetType() const override { return DocIteratorType::kTermDocIterator; }
+    String Name() const override { return "MockBlockMaxDocIterator"; }
+
+    void InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&, float, float, float) override {}
+
+    RowID BlockMinPossibleDocID() const override { return block_idx_ == 0 ? RowID(0) : doc_ids_[block_idx_ * kBlockSize - 1] + 1; }
+
+    RowID BlockLastDocID() const override { return doc_ids_[std::min<SizeT>((block_idx_ + 1) * kBlockSize, doc_ids_.size()) - 1]; }
+
+    float BlockMaxBM25Score() override {
+        const auto begin = scores_.begin() + block_idx_ * kBlockSize;
+        const auto end = scores_.begin() + std::min<SizeT>((block_idx_ + 1) * kBlockSize, scores_.size());
+        return *std::max_element(begin, end);
+    }
+
+    bool NextShallow(RowID doc_id) override {
+        ++shallow_cnt_;
+        if (threshold_ > BM25ScoreUpperBound()) {
+            doc_id_ = INVALID_ROWID;
+            return false;
+        }
+        while (true) {
+            while (block_idx_ * kBlockSize < doc_ids_.size() && BlockLastDocID() < doc_id) {
+                ++block_idx_;
+            }
+            if (block_idx_ * kBlockSize >= doc_ids_.size()) {
+                doc_id_ = INVALID_ROWID;
+                return false;
+            }
+            if (threshold_ <= 0.0f || BlockMaxBM25Score() > threshold_) {
+                return true;
+            }
+            doc_id = BlockLastDocID() + 1;
+        }
+    }
+
+    bool Next(RowID doc_id) override {
+        while (true) {
+            while (idx_ < doc_ids_.size() && doc_ids_[idx_] < doc_id) {
+                ++idx_;
+            }
+            if (idx_ >= doc_ids_.size()) {
+                doc_id_ = INVALID_ROWID;
+                return false;
+            }
+            doc_id_ = doc_ids_[idx_];
+            block_idx_ = idx_ / kBlockSize;
+            if (threshold_ <= 0.0f || BlockMaxBM25Score() > threshold_) {
+                return true;
+            }
+            doc_id = BlockLastDocID() + 1;
+        }
+    }
+
+    float BM25Score() override { return scores_[idx_]; }
+
+    float Score() override { return BM25Score(); }
+
+    void UpdateScoreThreshold(float threshold) override { threshold_ = std::max(threshold_, threshold); }
+
+    u32 MatchCount() const override { return DocID() != INVALID_ROWID; }
+
+    void PrintTree(std::ostream &os, const String &prefix, bool is_final = true) const override {
+        os << prefix;
+        os << (is_final ? "└──" : "├──");
+        os << "MockBlockMaxDocIterator (doc_num: " << doc_ids_.size() << ")" << '\n';
+    }
+
+    Vector<RowID> doc_ids_;
+    Vector<float> scores_;
+    u32 idx_ = 0;
+    u32 block_idx_ = 0;
+    u32 shallow_cnt_ = 0;
+};
+
 } // namespace infinity
 
 using namespace infinity;
@@ -469,3 +600,197 @@ TEST_F(QueryBuilderTest, test_and_not2) {
             break;
     }
 }
+
+struct ScoredDocs {
+    Vector<RowID> doc_ids_;
+    Vector<float> scores_;
+};
+
+// about half of the docs in [0, doc_num), with scores in [0, max_score)
+ScoredDocs GetRandomScoredDocs(std::mt19937 &rng, const u32 doc_num, const float max_score) {
+    ScoredDocs docs;
+    std::bernoulli_distribution gen_hit(0.5);
+    std::uniform_real_distribution<float> gen_score(0.0f, max_score);
+    for (u32 doc_id = 0; doc_id < doc_num; ++doc_id) {
+        if (gen_hit(rng)) {
+            docs.doc_ids_.push_back(doc_id);
+            docs.scores_.push_back(gen_score(rng));
+        }
+    }
+    return docs;
+}
+
+enum class ExpectMatch { kOr, kMustFirst, kAnd };
+
+// top n scores of brute force
+Vector<float> ExpectTopN(const Vector<ScoredDocs> &children, const ExpectMatch match, const u32 topn) {
+    Map<RowID, Pair<float, u32>> doc_scores;
+    for (u32 i = 0; i < children.size(); ++i) {
+        for (SizeT j = 0; j < children[i].doc_ids_.size(); ++j) {
+            const RowID doc_id = children[i].doc_ids_[j];
+            if (i == 0 || match != ExpectMatch::kMustFirst || doc_scores.contains(doc_id)) {
+                auto &[score, cnt] = doc_scores[doc_id];
+                score += children[i].scores_[j];
+                ++cnt;
+            }
+        }
+    }
+    Vector<float> result;
+    for (const auto &[doc_id, score_cnt] : doc_scores) {
+        if (match != ExpectMatch::kAnd || score_cnt.second == children.size()) {
+            result.push_back(score_cnt.first);
+        }
+    }
+    std::sort(result.begin(), result.end(), std::greater<float>());
+    result.resize(std::min<SizeT>(result.size(), topn));
+    return result;
+}
+
+// top n search like ExecuteFTSearch, returns the scores in descending order and the number of docs the iterator returned
+Pair<Vector<float>, u32> RunTopN(DocIterator *iter, const u32 topn) {
+    Vector<float> result;
+    u32 doc_cnt = 0;
+    while (iter->Next()) {
+        ++doc_cnt;
+        const float score = iter->Score();
+        if (result.size() == topn && score <= result.back()) {
+            continue;
+        }
+        result.insert(std::upper_bound(result.begin(), result.end(), score, std::greater<float>()), score);
+        if (result.size() > topn) {
+            result.pop_back();
+        }
+        if (result.size() == topn) {
+            iter->UpdateScoreThreshold(result.back());
+        }
+    }
+    return {std::move(result), doc_cnt};
+}
+
+void CheckTopN(const Vector<float> &result, const Vector<float> &expect_result) {
+    ASSERT_EQ(result.size(), expect_result.size());
+    for (SizeT i = 0; i < result.size(); ++i) {
+        EXPECT_NEAR(result[i], expect_result[i], 1e-4);
+    }
+}
+
+// The score threshold pruning of or / must_first iterators shall not change the top n results.
+TEST_F(QueryBuilderTest, test_max_score) {
+    std::random_device rd;
+    std::mt19937 rng{rd()};
+    constexpr u32 child_num = 5;
+    constexpr u32 topn = 10;
+    Vector<ScoredDocs> children_docs;
+    for (u32 i = 0; i < child_num; ++i) {
+        // children with quite different upper bounds
+        children_docs.push_back(GetRandomScoredDocs(rng, DocIDMaxN / 10, 1.0f + i * 2.0f));
+    }
+    auto create_children = [&] {
+        Vector<UniquePtr<DocIterator>> children;
+        for (const auto &docs : children_docs) {
+            children.emplace_back(MakeUnique<MockScoredDocIterator>(docs.doc_ids_, docs.scores_));
+        }
+        return children;
+    };
+    {
+        OrIterator or_iter(create_children());
+        CheckTopN(RunTopN(&or_iter, topn).first, ExpectTopN(children_docs, ExpectMatch::kOr, topn));
+    }
+    {
+        MustFirstIterator must_first_iter(create_children());
+        CheckTopN(RunTopN(&must_first_iter, topn).first, ExpectTopN(children_docs, ExpectMatch::kMustFirst, topn));
+    }
+    {
+        const u32 match_cnt = ExpectTopN(children_docs, ExpectMatch::kAnd, std::numeric_limits<u32>::max()).size();
+        AndIterator and_iter(create_children());
+        auto [result, doc_cnt] = RunTopN(&and_iter, topn);
+        CheckTopN(result, ExpectTopN(children_docs, ExpectMatch::kAnd, topn));
+        // the docs which can't exceed the threshold are skipped
+        EXPECT_LT(doc_cnt, match_cnt);
+    }
+}
+
+// A child without a finite upper bound disables the pruning of and iterator instead of absorbing the bounds of the others.
+TEST_F(QueryBuilderTest, test_max_score_unbounded_child) {
+    std::random_device rd;
+    std::mt19937 rng{rd()};
+    constexpr u32 topn = 10;
+    Vector<ScoredDocs> children_docs;
+    for (u32 i = 0; i < 3; ++i) {
+        children_docs.push_back(GetRandomScoredDocs(rng, DocIDMaxN / 10, 1.0f + i));
+    }
+    for (const float unbounded : {std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity()}) {
+        Vector<UniquePtr<DocIterator>> children;
+        for (u32 i = 0; i < children_docs.size(); ++i) {
+            auto child = MakeUnique<MockScoredDocIterator>(children_docs[i].doc_ids_, children_docs[i].scores_);
+            if (i == 0) {
+                child->SetBM25ScoreUpperBound(unbounded);
+            }
+            children.emplace_back(std::move(child));
+        }
+        AndIterator and_iter(std::move(children));
+        CheckTopN(RunTopN(&and_iter, topn).first, ExpectTopN(children_docs, ExpectMatch::kAnd, topn));
+    }
+}
+
+// And iterator skips the block ranges whose block max scores can't exceed the threshold together.
+TEST_F(QueryBuilderTest, test_max_score_block_max) {
+    std::random_device rd;
+    std::mt19937 rng{rd()};
+    constexpr u32 topn = 10;
+    Vector<ScoredDocs> children_docs;
+    for (u32 i = 0; i < 3; ++i) {
+        children_docs.push_back(GetRandomScoredDocs(rng, DocIDMaxN, 1.0f + i));
+    }
+    Vector<UniquePtr<DocIterator>> children;
+    Vector<MockBlockMaxDocIterator *> leaves;
+    for (const auto &docs : children_docs) {
+        auto child = MakeUnique<MockBlockMaxDocIterator>(docs.doc_ids_, docs.scores_);
+        leaves.push_back(child.get());
+        children.emplace_back(std::move(child));
+    }
+    // a child without block max info
+    ScoredDocs all_docs;
+    for (u32 doc_id = 0; doc_id < DocIDMaxN; ++doc_id) {
+        all_docs.doc_ids_.push_back(doc_id);
+        all_docs.scores_.push_back(0.5f);
+    }
+    children_docs.push_back(all_docs);
+    children.emplace_back(MakeUnique<MockScoredDocIterator>(all_docs.doc_ids_, all_docs.scores_));
+
+    const u32 match_cnt = ExpectTopN(children_docs, ExpectMatch::kAnd, std::numeric_limits<u32>::max()).size();
+    AndIterator and_iter(std::move(children));
+    auto [result, doc_cnt] = RunTopN(&and_iter, topn);
+    CheckTopN(result, ExpectTopN(children_docs, ExpectMatch::kAnd, topn));
+    EXPECT_LT(doc_cnt, match_cnt);
+    for (const auto *leaf : leaves) {
+        EXPECT_GT(leaf->shallow_cnt_, 0u);
+    }
+}
+
+// Filter iterator reports the upper bound of its query, and the query below it still prunes.
+TEST_F(QueryBuilderTest, test_max_score_filter) {
+    std::random_device rd;
+    std::mt19937 rng{rd()};
+    constexpr u32 topn = 10;
+    Vector<ScoredDocs> children_docs;
+    for (u32 i = 0; i < 3; ++i) {
+        children_docs.push_back(GetRandomScoredDocs(rng, DocIDMaxN / 10, 1.0f + i * 2.0f));
+    }
+    Vector<UniquePtr<DocIterator>> children;
+    for (const auto &docs : children_docs) {
+        children.emplace_back(MakeUnique<MockScoredDocIterator>(docs.doc_ids_, docs.scores_));
+    }
+    auto or_iter = MakeUnique<OrIterator>(std::move(children));
+    const float or_ub = or_iter->BM25ScoreUpperBound();
+    auto *or_iter_ptr = or_iter.get();
+    // no filter, every doc passes
+    FilterIterator filter_iter(nullptr, std::move(or_iter));
+    EXPECT_FLOAT_EQ(filter_iter.BM25ScoreUpperBound(), or_ub);
+    EXPECT_TRUE(filter_iter.HasBM25ScoreUpperBound());
+    auto [result, doc_cnt] = RunTopN(&filter_iter, topn);
+    CheckTopN(result, ExpectTopN(children_docs, ExpectMatch::kOr, topn));
+    EXPECT_FLOAT_EQ(filter_iter.Threshold(), result.back());
+    EXPECT_FLOAT_EQ(or_iter_ptr->Threshold(), result.back());
+    EXPECT_LT(doc_cnt, ExpectTopN(children_docs, ExpectMatch::kOr, std::numeric_limits<u32>::max()).size());
+}
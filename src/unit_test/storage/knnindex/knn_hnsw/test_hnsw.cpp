@@ -108,6 +108,44 @@ public:
         }
     }
 
+    template <typename Hnsw>
+    void TestParallelBuild() {
+        int dim = 16;
+        int M = 8;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, element_size);
+        auto [start_i, end_i] = hnsw_index->StoreData(std::move(iter));
+        ThreadPool thread_pool(4);
+        hnsw_index->ParallelBuild(start_i, end_i, thread_pool, 64 /*min_bucket_size*/);
+        hnsw_index->Check();
+
+        KnnSearchOption search_option{.ef_ = 10};
+        int correct = 0;
+        for (int i = 0; i < element_size; ++i) {
+            const float *query = data.get() + i * dim;
+            auto result = hnsw_index->KnnSearchSorted(query, 1, search_option);
+            if (result[0].second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        float correct_rate = float(correct) / element_size;
+        EXPECT_GE(correct_rate, 0.95);
+    }
+
     template <typename Hnsw, typename LoadHnsw>
     void TestLoad() {
         int dim = 16;
@@ -414,3 +452,8 @@ TEST_F(HnswAlgTest, test8) {
     using HnswLoad = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT, false>;
     TestLoad<Hnsw, HnswLoad>();
 }
+
+TEST_F(HnswAlgTest, test9) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+    TestParallelBuild<Hnsw>();
+}
@@ -0,0 +1,80 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import hnsw_filter_cost;
+import stl;
+
+using namespace infinity;
+
+class HnswFilterCostTest : public BaseTest {};
+
+TEST_F(HnswFilterCostTest, prefer_scan) {
+    constexpr SizeT segment_row_count = 1000000;
+    constexpr SizeT topk = 10;
+    constexpr SizeT M = 16;
+
+    // a filter passing most rows is searched in the graph
+    EXPECT_FALSE(HnswFilterCost::PreferScan(segment_row_count, segment_row_count, topk, 0, M));
+    EXPECT_FALSE(HnswFilterCost::PreferScan(segment_row_count, segment_row_count / 10, topk, 0, M));
+    EXPECT_FALSE(HnswFilterCost::PreferScan(segment_row_count, segment_row_count / 10, topk, 200, M));
+    // a selective filter is scanned
+    EXPECT_TRUE(HnswFilterCost::PreferScan(segment_row_count, 1000, topk, 0, M));
+    EXPECT_TRUE(HnswFilterCost::PreferScan(segment_row_count, 0, topk, 0, M));
+    // a larger ef makes the graph search more expensive
+    EXPECT_FALSE(HnswFilterCost::PreferScan(segment_row_count, 30000, topk, 0, M));
+    EXPECT_TRUE(HnswFilterCost::PreferScan(segment_row_count, 30000, topk, 200, M));
+
+    // the cost of the graph search grows when the filter passes fewer rows
+    double prev_cost = 0;
+    for (SizeT filter_row_count = segment_row_count; filter_row_count > 0; filter_row_count /= 10) {
+        double cost = HnswFilterCost::GraphCost(segment_row_count, filter_row_count, topk, 0, M);
+        EXPECT_GE(cost, prev_cost);
+        prev_cost = cost;
+    }
+    EXPECT_EQ(HnswFilterCost::GraphCost(0, 0, topk, 0, M), 0);
+}
+
+TEST_F(HnswFilterCostTest, selectivity_threshold) {
+    struct Case {
+        SizeT segment_row_count;
+        SizeT topk;
+        SizeT ef;
+        SizeT M;
+    };
+    const Vector<Case> cases = {{1000000, 10, 0, 16}, {1000000, 10, 200, 16}, {100000, 100, 0, 32}, {8192, 10, 50, 16}};
+    for (const auto &[segment_row_count, topk, ef, M] : cases) {
+        // scan and graph cost are equal at the threshold F: F + kScanRowCost * N = kGraphDistanceCost * M * (log2(N + 1) + max(ef, topk) * N / F)
+        const double N = segment_row_count;
+        const double b = HnswFilterCost::kScanRowCost * N - HnswFilterCost::kGraphDistanceCost * M * std::log2(N + 1);
+        const double c = HnswFilterCost::kGraphDistanceCost * M * std::max(ef, topk) * N;
+        const double threshold = (-b + std::sqrt(b * b + 4 * c)) / 2;
+        ASSERT_GT(threshold, std::max(ef, topk));
+        ASSERT_LT(threshold, N);
+
+        // the chooser flips from the scan to the graph search once, around the threshold
+        EXPECT_TRUE(HnswFilterCost::PreferScan(segment_row_count, static_cast<SizeT>(threshold * 0.95), topk, ef, M));
+        EXPECT_FALSE(HnswFilterCost::PreferScan(segment_row_count, static_cast<SizeT>(threshold * 1.05) + 1, topk, ef, M));
+        SizeT flip_count = 0;
+        bool prev_prefer_scan = true;
+        for (SizeT filter_row_count = 0; filter_row_count <= segment_row_count; filter_row_count += std::max<SizeT>(segment_row_count / 1000, 1)) {
+            bool prefer_scan = HnswFilterCost::PreferScan(segment_row_count, filter_row_count, topk, ef, M);
+            flip_count += prefer_scan != prev_prefer_scan;
+            prev_prefer_scan = prefer_scan;
+        }
+        EXPECT_EQ(flip_count, 1u);
+        EXPECT_FALSE(prev_prefer_scan);
+    }
+}
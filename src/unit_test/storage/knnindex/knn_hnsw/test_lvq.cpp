@@ -24,6 +24,7 @@ import infinity_exception;
 import hnsw_common;
 import virtual_store;
 import local_file_handle;
+import lvq_vec_store;
 
 using namespace infinity;
 
@@ -198,4 +199,53 @@ TEST_F(HnswLVQTest, test1) {
             CheckStore(lvq_store, data.get());
         }
     }
-}
\ No newline at end of file
+}
+TEST_F(HnswLVQTest, test_lvq4) {
+    using namespace infinity;
+    using LVQ4VecStoreType = LVQL2VecStoreType<float, LVQ4>;
+    using LVQ4DataStore = infinity::DataStore<LVQ4VecStoreType, LabelT>;
+    using CodeTraits = LVQCodeTraits<LVQ4>;
+
+    // odd dim, the last byte of the codes has a padding nibble
+    constexpr size_t dim = 15;
+    auto data = std::make_unique<float[]>(dim * vec_n_);
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> distrib_real(100, 200);
+    for (size_t i = 0; i < dim * vec_n_; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    auto lvq_store = LVQ4DataStore::Make(vec_n_, 1 /*chunk_n*/, dim, 0 /*Mmax0*/, 0 /*Mmax*/);
+    auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, vec_n_);
+    auto [start_i, end_i] = lvq_store.OptAddVec(std::move(iter));
+    EXPECT_EQ(start_i, 0u);
+    EXPECT_EQ(end_i, vec_n_);
+    EXPECT_EQ(CodeTraits::CodeSize(dim), 8u);
+    EXPECT_EQ(lvq_store.vec_store_meta().compress_data_size(), sizeof(std::remove_pointer_t<LVQ4VecStoreType::StoreType>) + 8);
+
+    const auto *mean = lvq_store.vec_store_meta().mean();
+    auto decompress = std::make_unique<float[]>(dim * vec_n_);
+    for (size_t i = 0; i < vec_n_; ++i) {
+        const auto *lvq = lvq_store.GetVec(i);
+        EXPECT_EQ(lvq->compress_vec_[dim / 2] >> 4, 0);
+        for (size_t j = 0; j < dim; ++j) {
+            i32 code = CodeTraits::Get(lvq->compress_vec_, j);
+            EXPECT_GE(code, CodeTraits::MinCode());
+            EXPECT_LE(code, CodeTraits::MaxCode());
+            decompress[i * dim + j] = lvq->scale_ * code + lvq->bias_ + mean[j];
+            EXPECT_LE(std::abs(decompress[i * dim + j] - data[i * dim + j]), lvq->scale_ / 2 + 1e-3);
+        }
+    }
+
+    LVQL2Dist<float, LVQ4> distance(dim);
+    for (size_t i = 0; i < vec_n_; ++i) {
+        for (size_t j = 0; j < vec_n_; ++j) {
+            float expected = 0;
+            for (size_t k = 0; k < dim; ++k) {
+                float diff = decompress[i * dim + k] - decompress[j * dim + k];
+                expected += diff * diff;
+            }
+            EXPECT_NEAR(distance(i, j, lvq_store), expected, std::max(1.0f, expected * 1e-3f));
+        }
+    }
+}
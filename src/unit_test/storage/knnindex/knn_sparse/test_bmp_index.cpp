@@ -92,6 +92,26 @@ protected:
             if (hit_all < total_all * accuracy_all) {
                 EXPECT_TRUE(false);
             }
+
+            // batch search and parallel block-max phase give the same results as single query search
+            Vector<SparseVecRef<DataType, IdxType>> queries;
+            for (SparseMatrixIter iter(query_set); iter.HasNext(); iter.Next()) {
+                queries.push_back(iter.val());
+            }
+            ThreadPool thread_pool(3);
+            BmpSearchOptions parallel_options = options;
+            parallel_options.thread_num_ = 4;
+            parallel_options.thread_pool_ = &thread_pool;
+            auto batch_results = index.SearchKnnBatch(queries, topk, parallel_options);
+            ASSERT_EQ(batch_results.size(), queries.size());
+            for (SizeT i = 0; i < queries.size(); ++i) {
+                auto [indices, scores] = index.SearchKnn(queries[i], topk, options);
+                auto [parallel_indices, parallel_scores] = index.SearchKnn(queries[i], topk, parallel_options);
+                EXPECT_EQ(batch_results[i].first, indices);
+                EXPECT_EQ(batch_results[i].second, scores);
+                EXPECT_EQ(parallel_indices, indices);
+                EXPECT_EQ(parallel_scores, scores);
+            }
         };
         {
             BMPAlg1 index(ncol, block_size);
@@ -171,6 +191,63 @@ TEST_F(BMPIndexTest, test1) {
     }
 }
 
+TEST_F(BMPIndexTest, quantized_block_max) {
+    auto test_func = [&]<typename DataType, typename IdxType, BMPCompressType CompressType>() {
+        using BMPAlg = BMPAlg<DataType, IdxType, CompressType>;
+
+        u32 nrow = 1000;
+        u32 ncol = 1000;
+        f32 sparsity = 0.05;
+        u32 query_n = 100;
+        u32 topk = 10;
+        u32 block_size = 8;
+
+        const SparseMatrix dataset = SparseTestUtil<DataType, IdxType>::GenerateDataset(nrow, ncol, sparsity, 0.0, 10.0);
+        const SparseMatrix query_set = SparseTestUtil<DataType, IdxType>::GenerateDataset(query_n, ncol, sparsity, 0.0, 10.0);
+        const auto [gt_indices_list, gt_scores_list] = SparseTestUtil<DataType, IdxType>::GenerateGroundtruth(dataset, query_set, topk, false);
+
+        BMPAlg index(ncol, block_size);
+        for (SparseMatrixIter iter(dataset); iter.HasNext(); iter.Next()) {
+            index.AddDoc(iter.val(), iter.row_id());
+        }
+
+        // alpha = 1 prunes only blocks whose upper bound can't reach the top k, so the search is exact with either upper bounds
+        BmpSearchOptions options;
+        options.use_lock_ = false;
+        Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> results;
+        for (SparseMatrixIter iter(query_set); iter.HasNext(); iter.Next()) {
+            results.push_back(index.SearchKnn(iter.val(), topk, options));
+        }
+
+        // the quantized block max table is built by Optimize
+        index.Optimize(BMPOptimizeOptions{});
+        u32 hit_all = 0;
+        u32 quantized_hit_all = 0;
+        u32 total_all = 0;
+        for (SparseMatrixIter iter(query_set); iter.HasNext(); iter.Next()) {
+            u32 query_id = iter.row_id();
+            auto [indices, scores] = index.SearchKnn(iter.val(), topk, options);
+            EXPECT_EQ(indices, results[query_id].first);
+            EXPECT_EQ(scores, results[query_id].second);
+
+            const i32 *gt_indices = gt_indices_list.get() + query_id * topk;
+            const DataType *gt_scores = gt_scores_list.get() + query_id * topk;
+            const auto &[raw_indices, raw_scores] = results[query_id];
+            auto [hit, total] = SparseTestUtil<DataType, IdxType>::CheckApproximateKnn(gt_indices, gt_scores, topk, raw_indices, raw_scores);
+            u32 quantized_hit = SparseTestUtil<DataType, IdxType>::CheckApproximateKnn(gt_indices, gt_scores, topk, indices, scores).first;
+            hit_all += hit;
+            quantized_hit_all += quantized_hit;
+            total_all += total;
+        }
+        EXPECT_EQ(quantized_hit_all, hit_all);
+        EXPECT_GE(quantized_hit_all, total_all * 0.99);
+    };
+    test_func.template operator()<f32, i32, BMPCompressType::kCompressed>();
+    test_func.template operator()<f32, i32, BMPCompressType::kRaw>();
+    test_func.template operator()<f64, i32, BMPCompressType::kCompressed>();
+    test_func.template operator()<f32, i16, BMPCompressType::kCompressed>();
+}
+
 TEST_F(BMPIndexTest, test2) {
     using BMPAlg = BMPAlg<f32, i32, BMPCompressType::kCompressed>;
 
@@ -52,6 +52,11 @@ import roaring_bitmap;
 import index_filter_evaluators;
 import index_emvb;
 import constant_expr;
+#ifdef INDEX_HANDLER
+import hnsw_handler;
+#else
+import abstract_hnsw;
+#endif
 
 using namespace infinity;
 
@@ -6824,3 +6829,139 @@ TEST_P(TestTxnDumpMemIndex, test_dump_index_and_compact) {
     }
 
 }
+
+TEST_P(TestTxnDumpMemIndex, dump_hnsw_and_append) {
+    using namespace infinity;
+
+    NewTxnManager *new_txn_mgr = infinity::InfinityContext::instance().storage()->new_txn_manager();
+
+    SharedPtr<String> db_name = std::make_shared<String>("db1");
+    auto column_type_info = MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, 4);
+    auto column_def1 =
+        std::make_shared<ColumnDef>(0, std::make_shared<DataType>(LogicalType::kEmbedding, column_type_info), "col1", std::set<ConstraintType>());
+    auto table_name = std::make_shared<std::string>("tb1");
+    auto table_def = TableDef::Make(db_name, table_name, MakeShared<String>(), {column_def1});
+
+    auto index_name = std::make_shared<std::string>("index1");
+    Vector<InitParameter *> index_parameters;
+    index_parameters.emplace_back(new InitParameter("metric", "l2"));
+    auto index_def = IndexHnsw::Make(index_name, MakeShared<String>(), "file_name", Vector<String>{column_def1->name()}, index_parameters);
+    DeferFn defer_fn([&] {
+        for (auto *parameter : index_parameters) {
+            delete parameter;
+        }
+    });
+
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create db"), TransactionType::kNormal);
+        Status status = txn->CreateDatabase(*db_name, ConflictType::kError, MakeShared<String>());
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create table"), TransactionType::kNormal);
+        Status status = txn->CreateTable(*db_name, std::move(table_def), ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create index"), TransactionType::kNormal);
+        Status status = txn->CreateIndex(*db_name, *table_name, index_def, ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+
+    u32 block_row_cnt = 8192;
+    auto append_a_block = [&] {
+        auto input_block = MakeShared<DataBlock>();
+        auto col1 = ColumnVector::Make(column_def1->type());
+        col1->Initialize();
+        for (u32 i = 0; i < block_row_cnt; ++i) {
+            col1->AppendValue(Value::MakeEmbedding(Vector<float>{1.0f * i, 2.0f, 3.0f, 4.0f}));
+        }
+        input_block->InsertVector(col1, 0);
+        input_block->Finalize();
+
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("append"), TransactionType::kNormal);
+        Status status = txn->Append(*db_name, *table_name, input_block);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    };
+
+    auto check_segment_index = [&](NewTxn *txn, std::function<void(SegmentIndexMeta &)> check) {
+        Optional<DBMeeta> db_meta;
+        Optional<TableMeeta> table_meta;
+        Optional<TableIndexMeeta> table_index_meta;
+        String table_key;
+        String index_key;
+        Status status = txn->GetTableIndexMeta(*db_name, *table_name, *index_name, db_meta, table_meta, table_index_meta, &table_key, &index_key);
+        EXPECT_TRUE(status.ok());
+        SegmentIndexMeta segment_index_meta(0, *table_index_meta);
+        check(segment_index_meta);
+    };
+
+    append_a_block();
+
+    //  t1            dump index (mem index frozen)                   commit (success)
+    //  |--------------|-----------------------------------------------------|
+    //                         |------------------|----------|
+    //                        t2                append     commit (success)
+    auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>(fmt::format("dump mem index {}", *index_name)), TransactionType::kNormal);
+    Status status = txn->DumpMemIndex(*db_name, *table_name, *index_name, 0);
+    EXPECT_TRUE(status.ok());
+    check_segment_index(txn, [&](SegmentIndexMeta &segment_index_meta) {
+        SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+        ASSERT_NE(mem_index, nullptr);
+        EXPECT_EQ(mem_index->GetHnswIndex(), nullptr);
+        ASSERT_NE(mem_index->GetDumpingHnswIndex(), nullptr);
+        EXPECT_EQ(mem_index->GetDumpingHnswIndex()->GetRowCount(), block_row_cnt);
+    });
+
+    // The append isn't blocked by the dump, it goes to a new mem index.
+    append_a_block();
+    check_segment_index(txn, [&](SegmentIndexMeta &segment_index_meta) {
+        SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+        ASSERT_NE(mem_index->GetHnswIndex(), nullptr);
+        EXPECT_EQ(mem_index->GetHnswIndex()->GetBeginRowID(), RowID(0, block_row_cnt));
+        EXPECT_EQ(mem_index->GetHnswIndex()->GetRowCount(), block_row_cnt);
+        EXPECT_NE(mem_index->GetDumpingHnswIndex(), nullptr);
+    });
+
+    status = new_txn_mgr->CommitTxn(txn);
+    EXPECT_TRUE(status.ok());
+
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("check index"), TransactionType::kNormal);
+        check_segment_index(txn, [&](SegmentIndexMeta &segment_index_meta) {
+            SharedPtr<MemIndex> mem_index = segment_index_meta.GetMemIndex();
+            EXPECT_EQ(mem_index->GetDumpingHnswIndex(), nullptr);
+            ASSERT_NE(mem_index->GetHnswIndex(), nullptr);
+            EXPECT_EQ(mem_index->GetHnswIndex()->GetRowCount(), block_row_cnt);
+
+            auto [chunk_ids, status] = segment_index_meta.GetChunkIDs1();
+            EXPECT_TRUE(status.ok());
+            EXPECT_EQ(*chunk_ids, Vector<ChunkID>({0}));
+            ChunkIndexMeta chunk_index_meta(0, segment_index_meta);
+            ChunkIndexMetaInfo *chunk_info = nullptr;
+            status = chunk_index_meta.GetChunkInfo(chunk_info);
+            EXPECT_TRUE(status.ok());
+            EXPECT_EQ(chunk_info->row_cnt_, block_row_cnt);
+            EXPECT_EQ(chunk_info->base_row_id_, RowID(0, 0));
+        });
+
+        Status status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("drop db"), TransactionType::kNormal);
+        Status status = txn->DropDatabase(*db_name, ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+}
@@ -46,6 +46,9 @@ import table_def;
 import internal_types;
 import defer_op;
 import statement_common;
+import meta_key;
+import meta_tree;
+import meta_type;
 
 using namespace infinity;
 
@@ -139,6 +142,78 @@ TEST_P(TestTxnIndex, index_test1) {
     }
 }
 
+TEST_P(TestTxnIndex, index_meta_to_json) {
+    using namespace infinity;
+    NewTxnManager *new_txn_mgr = infinity::InfinityContext::instance().storage()->new_txn_manager();
+    NewCatalog *new_catalog = infinity::InfinityContext::instance().storage()->new_catalog();
+
+    SharedPtr<String> db_name = std::make_shared<String>("db1");
+    auto column_def1 = std::make_shared<ColumnDef>(0, std::make_shared<DataType>(LogicalType::kInteger), "col1", std::set<ConstraintType>());
+    auto table_name = std::make_shared<std::string>("tb1");
+    auto table_def = TableDef::Make(db_name, table_name, MakeShared<String>(), {column_def1});
+    auto index_name = std::make_shared<String>("idx1");
+    auto index_base = IndexSecondary::Make(index_name, MakeShared<String>(), "file_name", {column_def1->name()});
+
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create db"), TransactionType::kNormal);
+        Status status = txn->CreateDatabase(*db_name, ConflictType::kError, MakeShared<String>());
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create table"), TransactionType::kNormal);
+        Status status = txn->CreateTable(*db_name, std::move(table_def), ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("create index"), TransactionType::kNormal);
+        Status status = txn->CreateIndex(*db_name, *table_name, index_base, ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+    {
+        // the append adds the segment to the segment_ids tag of the index
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("append"), TransactionType::kNormal);
+        auto col = ColumnVector::Make(column_def1->type());
+        col->Initialize();
+        for (SizeT i = 0; i < 4; ++i) {
+            col->AppendValue(Value::MakeInt(i));
+        }
+        auto input_block = MakeShared<DataBlock>();
+        input_block->InsertVector(col, 0);
+        input_block->Finalize();
+        Status status = txn->Append(*db_name, *table_name, input_block);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+
+    // the binary id lists are dumped as json arrays
+    bool has_segment_ids = false;
+    for (const auto &meta_key : new_catalog->MakeMetaKeys()) {
+        nlohmann::json json_res;
+        EXPECT_NO_THROW(json_res = meta_key->ToJson());
+        if (meta_key->type_ == MetaType::kTableIndexTag && json_res.contains("segment_ids")) {
+            EXPECT_EQ(json_res["segment_ids"].get<Vector<SegmentID>>(), Vector<SegmentID>({0}));
+            has_segment_ids = true;
+        }
+    }
+    EXPECT_TRUE(has_segment_ids);
+    EXPECT_NO_THROW(new_catalog->MakeMetaTree()->ToJson());
+
+    {
+        auto *txn = new_txn_mgr->BeginTxn(MakeUnique<String>("drop db"), TransactionType::kNormal);
+        Status status = txn->DropDatabase(*db_name, ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        status = new_txn_mgr->CommitTxn(txn);
+        EXPECT_TRUE(status.ok());
+    }
+}
+
 TEST_P(TestTxnIndex, index_test2) {
     using namespace infinity;
     NewTxnManager *new_txn_mgr = infinity::InfinityContext::instance().storage()->new_txn_manager();
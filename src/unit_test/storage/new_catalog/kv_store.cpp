@@ -19,6 +19,7 @@ import stl;
 import third_party;
 import status;
 import kv_store;
+import catalog_snapshot;
 
 using namespace infinity;
 
@@ -481,3 +482,64 @@ TEST_P(TestTxnKVStoreTest, kv_store6) {
     EXPECT_TRUE(status.ok());
 }
 
+
+TEST_P(TestTxnKVStoreTest, catalog_snapshot) {
+    using namespace infinity;
+    const auto rocksdb_tmp_path = fmt::format("{}/rocksdb_transaction_example", GetFullTmpDir());
+    UniquePtr<KVStore> kv_store = MakeUnique<KVStore>();
+    Status status = kv_store->Init(rocksdb_tmp_path);
+    EXPECT_TRUE(status.ok());
+    CatalogSnapshotCache *snapshot_cache = kv_store->snapshot_cache();
+    const String prefix = "catalog|seg|1|2|";
+    EXPECT_EQ(CatalogSnapshotCache::TableKey(prefix), "1|2");
+    EXPECT_EQ(CatalogSnapshotCache::TableKey("catalog|blk|1|2|0|3"), "1|2");
+    EXPECT_EQ(CatalogSnapshotCache::TableKey("catalog|blk_col|1|2|0|3|0|10"), "");
+
+    {
+        UniquePtr<KVInstance> kv_instance = kv_store->GetInstance();
+        EXPECT_TRUE(kv_instance->Put(prefix + "0", "10").ok());
+        EXPECT_TRUE(kv_instance->Put("catalog|seg|1|20|0", "10").ok());
+        EXPECT_TRUE(kv_instance->Commit().ok());
+    }
+
+    UniquePtr<KVInstance> kv_instance1 = kv_store->GetInstance();
+    auto ids1 = kv_instance1->GetCatalogIDs(prefix);
+    EXPECT_EQ(*ids1, CatalogIDList({{0, 10}}));
+    EXPECT_EQ(snapshot_cache->ListCount(), 1u);
+
+    // served from the snapshot
+    UniquePtr<KVInstance> kv_instance2 = kv_store->GetInstance();
+    EXPECT_EQ(kv_instance2->GetCatalogIDs(prefix), ids1);
+
+    UniquePtr<KVInstance> kv_instance3 = kv_store->GetInstance();
+    EXPECT_TRUE(kv_instance3->Put(prefix + "1", "20").ok());
+    // own writes aren't in the snapshot
+    EXPECT_EQ(*kv_instance3->GetCatalogIDs(prefix), CatalogIDList({{0, 10}, {1, 20}}));
+    EXPECT_TRUE(kv_instance3->Commit().ok());
+    EXPECT_EQ(snapshot_cache->ListCount(), 0u);
+
+    // kv_instance2 reads the RocksDB snapshot before the commit
+    EXPECT_EQ(*kv_instance2->GetCatalogIDs(prefix), CatalogIDList({{0, 10}}));
+    EXPECT_EQ(snapshot_cache->ListCount(), 0u);
+
+    UniquePtr<KVInstance> kv_instance4 = kv_store->GetInstance();
+    auto ids4 = kv_instance4->GetCatalogIDs(prefix);
+    EXPECT_EQ(*ids4, CatalogIDList({{0, 10}, {1, 20}}));
+    UniquePtr<KVInstance> kv_instance5 = kv_store->GetInstance();
+    EXPECT_EQ(kv_instance5->GetCatalogIDs(prefix), ids4);
+
+    // a direct write of the key also invalidates the snapshot
+    EXPECT_TRUE(kv_store->Delete(prefix + "0").ok());
+    UniquePtr<KVInstance> kv_instance6 = kv_store->GetInstance();
+    EXPECT_EQ(*kv_instance6->GetCatalogIDs(prefix), CatalogIDList({{1, 20}}));
+
+    kv_instance1->Rollback();
+    kv_instance2->Rollback();
+    kv_instance4->Rollback();
+    kv_instance5->Rollback();
+    kv_instance6->Rollback();
+    status = kv_store->Uninit();
+    EXPECT_TRUE(status.ok());
+    status = kv_store->Destroy(rocksdb_tmp_path);
+    EXPECT_TRUE(status.ok());
+}
@@ -26,6 +26,8 @@ import data_block;
 import column_vector;
 import value;
 import logger;
+import sql_parser;
+import parser_result;
 
 using namespace infinity;
 
@@ -220,6 +222,47 @@ TEST_P(TestIndexRequest, sparse_index_scan) {
     search_vec();
 }
 
+TEST_P(TestIndexRequest, prepared_match_sparse) {
+    {
+        String create_table_sql = "create table t1(c1 int, c2 sparse(float, 100))";
+        UniquePtr<QueryContext> query_context = MakeQueryContext();
+        QueryResult query_result = query_context->Query(create_table_sql);
+        bool ok = HandleQueryResult(query_result);
+        EXPECT_TRUE(ok);
+    }
+    {
+        String append_req_sql = "insert into t1 values(1, [10:1.0, 20:1.0, 30:1.0]), (2, [40:1.0,50:1.0,60:1.0  ])";
+        UniquePtr<QueryContext> query_context = MakeQueryContext();
+        QueryResult query_result = query_context->Query(append_req_sql);
+        bool ok = HandleQueryResult(query_result);
+        EXPECT_TRUE(ok);
+    }
+    // A prepared statement is parsed once and bound again by each execution, the threshold must survive the first one.
+    String search_req_sql = "select c1 from t1 search match sparse (c2, [20:1.0,30:1.0,40:1.0], 'ip', 2) with (threshold = 1.5)";
+    auto parsed_result = MakeShared<ParserResult>();
+    SQLParser parser;
+    parser.Parse(search_req_sql, parsed_result.get());
+    ASSERT_FALSE(parsed_result->IsError());
+    auto search_sparse = [&] {
+        UniquePtr<QueryContext> query_context = MakeQueryContext();
+        QueryResult query_result = query_context->QueryStatement(parsed_result->statements_ptr_->at(0));
+        DataTable *result_table = nullptr;
+        bool ok = HandleQueryResult(query_result, &result_table);
+        EXPECT_TRUE(ok);
+        Vector<Value> values;
+        for (const auto &data_block : result_table->data_blocks_) {
+            for (SizeT i = 0; i < data_block->row_count(); ++i) {
+                values.push_back(data_block->column_vectors[0]->GetValue(i));
+            }
+        }
+        return values;
+    };
+    Vector<Value> first_values = search_sparse();
+    ASSERT_EQ(first_values.size(), 1u);
+    EXPECT_EQ(first_values[0], Value::MakeInt(1));
+    EXPECT_EQ(search_sparse(), first_values);
+}
+
 TEST_P(TestIndexRequest, tensor_index_scan) {
     auto search_tensor = [this] {
         String search_req_sql = "select c1 from t1 search match tensor(c2, [0.4,0.5,0.6,0.7], 'float', 'maxsim', '')";
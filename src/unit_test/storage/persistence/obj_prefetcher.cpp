@@ -0,0 +1,60 @@
+// Copyright(C) 2025 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import obj_prefetcher;
+
+using namespace infinity;
+
+// The remote store isn't initialized in unit test, so the predicted files are not fetched.
+class ObjPrefetcherTest : public BaseTest {};
+
+TEST_F(ObjPrefetcherTest, record_miss) {
+    ObjPrefetcher prefetcher(nullptr);
+    EXPECT_EQ(prefetcher.RecordMiss("a1"), "");
+    EXPECT_EQ(prefetcher.RecordMiss("a1"), "");
+    EXPECT_EQ(prefetcher.RecordMiss("a2"), "");
+
+    EXPECT_EQ(prefetcher.RecordMiss("a1"), "a2");
+    EXPECT_EQ(prefetcher.RecordMiss("a2"), "a1");
+}
+
+TEST_F(ObjPrefetcherTest, record_miss_per_thread) {
+    ObjPrefetcher prefetcher(nullptr);
+    EXPECT_EQ(prefetcher.RecordMiss("a1"), "");
+
+    // the misses of another reader interleave with a1 -> a2
+    Thread reader([&] {
+        EXPECT_EQ(prefetcher.RecordMiss("b1"), "");
+        EXPECT_EQ(prefetcher.RecordMiss("b2"), "");
+    });
+    reader.join();
+
+    EXPECT_EQ(prefetcher.RecordMiss("a2"), "");
+    EXPECT_EQ(prefetcher.RecordMiss("a1"), "a2");
+
+    Thread reader2([&] { EXPECT_EQ(prefetcher.RecordMiss("b1"), "b2"); });
+    reader2.join();
+}
+
+TEST_F(ObjPrefetcherTest, start_stop) {
+    ObjPrefetcher prefetcher(nullptr, 2);
+    prefetcher.Start();
+    prefetcher.Prefetch({"a1", "a2"});
+    prefetcher.Stop();
+    EXPECT_EQ(prefetcher.prefetch_count(), 0ul);
+    prefetcher.Stop();
+}
@@ -44,3 +44,74 @@ TEST_F(ObjectStatMapTest, test1) {
     stat2 = obj_map.GetNoCount("key2");
     EXPECT_EQ(stat2, nullptr);
 }
+
+TEST_F(ObjectStatMapTest, cached_ranges) {
+    ObjStat obj_stat(100, 4, 0, ObjCached::kNotCached);
+    EXPECT_FALSE(obj_stat.RangeCached(Range{.start_ = 0, .end_ = 10}));
+
+    obj_stat.AddCachedRange(Range{.start_ = 10, .end_ = 20});
+    obj_stat.AddCachedRange(Range{.start_ = 40, .end_ = 50});
+    EXPECT_EQ(obj_stat.cached_ranges_.size(), 2);
+    EXPECT_TRUE(obj_stat.RangeCached(Range{.start_ = 12, .end_ = 20}));
+    EXPECT_FALSE(obj_stat.RangeCached(Range{.start_ = 15, .end_ = 25}));
+    EXPECT_FALSE(obj_stat.RangeCached(Range{.start_ = 0, .end_ = 5}));
+
+    // adjacent and overlapping ranges are merged
+    obj_stat.AddCachedRange(Range{.start_ = 20, .end_ = 30});
+    obj_stat.AddCachedRange(Range{.start_ = 25, .end_ = 45});
+    EXPECT_EQ(obj_stat.cached_ranges_.size(), 1);
+    EXPECT_TRUE(obj_stat.RangeCached(Range{.start_ = 10, .end_ = 50}));
+
+    obj_stat.AddCachedRange(Range{.start_ = 0, .end_ = 100});
+    EXPECT_EQ(obj_stat.cached_ranges_.size(), 1);
+    EXPECT_TRUE(obj_stat.RangeCached(Range{.start_ = 0, .end_ = 100}));
+}
+
+TEST_F(ObjectStatMapTest, envict_partial) {
+    SizeT disk_capacity_limit = 10;
+    ObjectStatAccessor_ObjectStorage obj_map(disk_capacity_limit);
+
+    Vector<String> drop_keys;
+    obj_map.PutNew("key1", ObjStat(6, 2, 0), drop_keys);
+    ObjStat *stat1 = obj_map.Get("key1");
+    stat1->cached_ = ObjCached::kPartial;
+    stat1->AddCachedRange(Range{.start_ = 0, .end_ = 2});
+    obj_map.Release("key1", drop_keys);
+    EXPECT_EQ(drop_keys.size(), 0);
+
+    obj_map.PutNew("key2", ObjStat(6, 1, 0), drop_keys);
+    EXPECT_EQ(drop_keys.size(), 1);
+    EXPECT_EQ(drop_keys[0], "key1");
+    stat1 = obj_map.GetNoCount("key1");
+    EXPECT_EQ(stat1->cached_, ObjCached::kNotCached);
+    EXPECT_TRUE(stat1->cached_ranges_.empty());
+}
+
+TEST_F(ObjectStatMapTest, envict_pinned) {
+    SizeT disk_capacity_limit = 10;
+    ObjectStatAccessor_ObjectStorage obj_map(disk_capacity_limit, DiskCachePinPolicy::kIndex);
+
+    Vector<String> drop_keys;
+    ObjStat index_stat(4, 1, 0);
+    index_stat.has_index_ = true;
+    obj_map.PutNew("index1", std::move(index_stat), drop_keys);
+    obj_map.PutNew("data1", ObjStat(4, 1, 0), drop_keys);
+    EXPECT_EQ(drop_keys.size(), 0);
+
+    // the index object is older, but the data object is envicted first
+    obj_map.PutNew("data2", ObjStat(4, 1, 0), drop_keys);
+    EXPECT_EQ(drop_keys.size(), 1);
+    EXPECT_EQ(drop_keys[0], "data1");
+    drop_keys.clear();
+
+    // a pinned object is envicted when there is no unpinned one
+    ObjStat *stat2 = obj_map.Get("data2");
+    EXPECT_NE(stat2, nullptr);
+    ObjStat index_stat2(8, 1, 0);
+    index_stat2.has_index_ = true;
+    obj_map.PutNew("index2", std::move(index_stat2), drop_keys);
+    EXPECT_EQ(drop_keys.size(), 1);
+    EXPECT_EQ(drop_keys[0], "index1");
+    EXPECT_EQ(obj_map.GetNoCount("index1")->cached_, ObjCached::kNotCached);
+    obj_map.Release("data2", drop_keys);
+}
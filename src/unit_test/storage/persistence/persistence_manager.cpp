@@ -6,6 +6,7 @@ import virtual_store;
 import third_party;
 import persist_result_handler;
 import local_file_handle;
+import obj_stat_accessor;
 
 using namespace infinity;
 namespace fs = std::filesystem;
@@ -191,4 +192,26 @@ TEST_F(PersistenceManagerTest, CleanupBasic) {
     for (const auto &obj_path : obj_paths) {
         ASSERT_FALSE(fs::exists(obj_path));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(PersistenceManagerTest, ObjectStorageEnvictUnpinned) {
+    // the localdisk cache of object storage mode holds one of the two objects, the index object is pinned
+    pm_ = MakeUnique<PersistenceManager>(workspace_, file_dir_, ObjSizeLimit, false, 3 * ObjSizeLimit, DiskCachePinPolicy::kIndex);
+    String index_dir = file_dir_ + "/db_1/tbl_1/idx_1";
+    system(("mkdir -p " + index_dir).c_str());
+    String index_path = index_dir + "/index_file";
+    String data_path = file_dir_ + "/data_file";
+    for (const auto &file_path : {index_path, data_path}) {
+        std::ofstream out_file(file_path);
+        out_file << String(2 * ObjSizeLimit, 'a');
+    }
+
+    PersistWriteResult index_result = pm_->Persist(index_path, index_path);
+    ASSERT_TRUE(index_result.obj_addr_.Valid());
+    EXPECT_TRUE(index_result.drop_keys_.empty());
+
+    PersistWriteResult data_result = pm_->Persist(data_path, data_path);
+    ASSERT_TRUE(data_result.obj_addr_.Valid());
+    ASSERT_EQ(data_result.drop_keys_.size(), 1ul);
+    EXPECT_EQ(data_result.drop_keys_[0], data_result.obj_addr_.obj_key_);
+}
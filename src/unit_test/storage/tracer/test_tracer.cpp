@@ -29,6 +29,7 @@ import new_txn;
 import compilation_config;
 import infinity_context;
 import chunk_index_meta;
+import create_index_info;
 
 using namespace infinity;
 
@@ -45,6 +46,8 @@ public:
         return MemIndexTracerInfo(index_name_, table_name_, db_name_, mem_used_, row_count_);
     }
 
+    IndexType GetIndexType() const override { return index_type_; }
+
     TableIndexEntry *table_index_entry() const override { return nullptr; }
 
     void IncreaseMemoryUsage(SizeT usage, SizeT row_cnt);
@@ -64,6 +67,7 @@ public:
     SharedPtr<String> db_name_;
     SharedPtr<String> table_name_;
     SharedPtr<String> index_name_;
+    IndexType index_type_ = IndexType::kSecondary;
 
 private:
     mutable std::mutex mtx_;
@@ -177,6 +181,8 @@ public:
 
     void HandleDump(UniquePtr<DumpIndexTask> task);
 
+    using MemIndexTracer::ChooseDump;
+
 private:
     void DumpRoutine();
 
@@ -300,3 +306,93 @@ TEST_F(MemIndexTracerTest, test2) {
 
     infinity::InfinityContext::instance().UnInit();
 }
+
+TEST_F(MemIndexTracerTest, test_choose_dump) {
+    SizeT memory_limit = 1000;
+    TestCatalog catalog;
+
+    TestMemIndexTracer tracer(memory_limit, catalog, false);
+    catalog.SetTracer(&tracer);
+
+    catalog.AppendMemIndex("hnsw1", 40, 40);
+    catalog.AppendMemIndex("fulltext1", 30, 30);
+    TestMemIndex *hnsw1 = catalog.GetMemIndex("hnsw1");
+    TestMemIndex *fulltext1 = catalog.GetMemIndex("fulltext1");
+    hnsw1->index_type_ = IndexType::kHnsw;
+    hnsw1->table_name_ = MakeShared<String>("table1");
+    fulltext1->index_type_ = IndexType::kFullText;
+    fulltext1->table_name_ = MakeShared<String>("table2");
+
+    Vector<BaseMemIndex *> mem_indexes{hnsw1, fulltext1};
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes), 0ul);
+
+    // burst on table2, the largest index of table2 is chosen although hnsw1 is larger than each of them
+    catalog.AppendMemIndex("fulltext1", 5, 5);
+    catalog.AppendMemIndex("fulltext2", 20, 20);
+    TestMemIndex *fulltext2 = catalog.GetMemIndex("fulltext2");
+    fulltext2->index_type_ = IndexType::kFullText;
+    fulltext2->table_name_ = MakeShared<String>("table2");
+    mem_indexes.push_back(fulltext2);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes), 1ul);
+
+    // an index type over its quota is dumped first
+    tracer.SetIndexTypeQuota(IndexType::kHnsw, 10);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes), 0ul);
+    tracer.SetIndexTypeQuota(IndexType::kHnsw, 0);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes), 1ul);
+}
+
+TEST_F(MemIndexTracerTest, test_quota_dump) {
+    // Earlier cases may leave a dirty infinity instance. Destroy it first.
+    infinity::InfinityContext::instance().UnInit();
+    RemoveDbDirs();
+    std::shared_ptr<std::string> config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_buffer_obj.toml");
+    infinity::InfinityContext::instance().InitPhase1(config_path);
+    infinity::InfinityContext::instance().InitPhase2();
+
+    SizeT memory_limit = 1000;
+    TestCatalog catalog;
+
+    TestMemIndexTracer tracer(memory_limit, catalog, false);
+    catalog.SetTracer(&tracer);
+
+    catalog.AppendMemIndex("hnsw_b", 60, 60);
+    catalog.AppendMemIndex("fulltext_a", 50, 50);
+    TestMemIndex *hnsw_b = catalog.GetMemIndex("hnsw_b");
+    TestMemIndex *fulltext_a = catalog.GetMemIndex("fulltext_a");
+    hnsw_b->index_type_ = IndexType::kHnsw;
+    hnsw_b->table_name_ = MakeShared<String>("tableB");
+    fulltext_a->index_type_ = IndexType::kFullText;
+    fulltext_a->table_name_ = MakeShared<String>("tableA");
+    Vector<BaseMemIndex *> mem_indexes{hnsw_b, fulltext_a};
+
+    // no quota is exceeded, nothing is dumped before the global limit
+    tracer.SetTableQuota("test_db", "tableA", 100);
+    SizeT victim_over_quota = 0;
+    tracer.ChooseDump(mem_indexes, &victim_over_quota);
+    EXPECT_EQ(victim_over_quota, 0ul);
+
+    // a full-text burst on tableA exceeds its table quota far below the global limit, only tableA is dumped
+    catalog.AppendMemIndex("fulltext_a", 80, 80);
+    EXPECT_LT(tracer.cur_index_memory(), memory_limit);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes, &victim_over_quota), 1ul);
+    EXPECT_EQ(victim_over_quota, 30ul);
+
+    // the same with the default table quota
+    tracer.SetTableQuota("test_db", "tableA", 0);
+    tracer.SetDefaultTableQuota(100);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes, &victim_over_quota), 1ul);
+    EXPECT_EQ(victim_over_quota, 30ul);
+
+    // and with the full-text quota, although tableB holds the largest mem index
+    tracer.SetDefaultTableQuota(0);
+    catalog.AppendMemIndex("hnsw_b", 100, 100);
+    tracer.ChooseDump(mem_indexes, &victim_over_quota);
+    EXPECT_EQ(victim_over_quota, 0ul);
+    tracer.SetIndexTypeQuota(IndexType::kFullText, 100);
+    EXPECT_EQ(tracer.ChooseDump(mem_indexes, &victim_over_quota), 1ul);
+    EXPECT_EQ(victim_over_quota, 30ul);
+    tracer.SetIndexTypeQuota(IndexType::kFullText, 0);
+
+    infinity::InfinityContext::instance().UnInit();
+}
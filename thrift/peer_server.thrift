@@ -73,6 +73,8 @@ struct SyncLogRequest {
 1: string node_name,
 2: list<binary> log_entries,
 3: bool on_startup,
+4: binary compressed_log_entries,
+5: i64 log_entry_count,
 }
 
 struct SyncLogResponse {